@@ -12,10 +12,10 @@ inline std::vector<uint8_t> exec_pipe(std::string const& command)
     }
 
     std::vector<uint8_t> result;
+    std::vector<uint8_t> buffer(1 << 16);
     while (!feof(pipe)) {
-        uint8_t buffer[128];
-        size_t count = fread(buffer, 1, sizeof(buffer), pipe);
-        result.insert(result.end(), buffer, buffer + count);
+        size_t count = fread(buffer.data(), 1, buffer.size(), pipe);
+        result.insert(result.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(count));
     }
 
     pclose(pipe);
@@ -1,9 +1,37 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/srs/factories/mmap_prover_crs.hpp"
+#include "barretenberg/srs/streaming_reader.hpp"
 
 namespace {
-std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
+/**
+ * @brief Loads `num_points` g1 points into `out` (or their pippenger point table, if `expand_point_table` is set),
+ * streaming them from the cached `g1_path` if it is large enough, and otherwise from the ignition download, which is
+ * then cached at `g1_path`. In both cases points are decoded in parallel while later bytes are still being read.
+ */
+void load_bn254_g1_data(const std::filesystem::path& g1_path,
+                        size_t num_points,
+                        bb::g1::affine_element* out,
+                        bool expand_point_table)
 {
+    std::vector<uint8_t> raw_bytes;
+    size_t g1_file_size = get_file_size(g1_path);
+
+    if (g1_file_size >= num_points * 64 && g1_file_size % 64 == 0) {
+        vinfo("using cached crs of size ", std::to_string(g1_file_size / 64), " at ", g1_path);
+        std::ifstream file(g1_path, std::ios::binary);
+        auto read_bytes = [&file](uint8_t* dst, size_t size) {
+            file.read(reinterpret_cast<char*>(dst), static_cast<std::streamsize>(size));
+            return static_cast<size_t>(file.gcount());
+        };
+        if (bb::srs::stream_g1_points<bb::curve::BN254>(read_bytes, num_points, raw_bytes, out, expand_point_table) <
+            num_points) {
+            throw std::runtime_error("Failed to read cached g1 data: " + g1_path.string());
+        }
+        return;
+    }
+
+    vinfo("downloading crs...");
     size_t g1_end = num_points * 64 - 1;
 
     std::string url = "https://aztec-ignition.s3.amazonaws.com/MAIN%20IGNITION/flat/g1.dat";
@@ -11,13 +39,19 @@ std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
     // IMPORTANT: this currently uses a shell, DO NOT let user-controlled strings here.
     std::string command = "curl -s -H \"Range: bytes=0-" + std::to_string(g1_end) + "\" '" + url + "'";
 
-    auto data = exec_pipe(command);
-    // Header + num_points * sizeof point.
-    if (data.size() < g1_end) {
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe) {
+        throw std::runtime_error("popen() failed!");
+    }
+    auto read_bytes = [pipe](uint8_t* dst, size_t size) { return fread(dst, 1, size, pipe); };
+    size_t num_read =
+        bb::srs::stream_g1_points<bb::curve::BN254>(read_bytes, num_points, raw_bytes, out, expand_point_table);
+    pclose(pipe);
+    if (num_read < num_points) {
         throw std::runtime_error("Failed to download g1 data.");
     }
 
-    return data;
+    write_file(g1_path, raw_bytes);
 }
 
 std::vector<uint8_t> download_bn254_g2_data()
@@ -34,27 +68,8 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
 {
     std::filesystem::create_directories(path);
 
-    auto g1_path = path / "bn254_g1.dat";
-    size_t g1_file_size = get_file_size(g1_path);
-
-    if (g1_file_size >= num_points * 64 && g1_file_size % 64 == 0) {
-        vinfo("using cached crs of size ", std::to_string(g1_file_size / 64), " at ", g1_path);
-        auto data = read_file(g1_path, g1_file_size);
-        auto points = std::vector<g1::affine_element>(num_points);
-        for (size_t i = 0; i < num_points; ++i) {
-            points[i] = from_buffer<g1::affine_element>(data, i * 64);
-        }
-        return points;
-    }
-
-    vinfo("downloading crs...");
-    auto data = download_bn254_g1_data(num_points);
-    write_file(g1_path, data);
-
     auto points = std::vector<g1::affine_element>(num_points);
-    for (size_t i = 0; i < num_points; ++i) {
-        points[i] = from_buffer<g1::affine_element>(data, i * 64);
-    }
+    load_bn254_g1_data(path / "bn254_g1.dat", num_points, points.data(), /*expand_point_table=*/false);
     return points;
 }
 
@@ -74,4 +89,27 @@ g2::affine_element get_bn254_g2_data(const std::filesystem::path& path)
     write_file(g2_path, data);
     return from_buffer<g2::affine_element>(data.data());
 }
+
+/**
+ * @brief Returns a prover crs backed by a memory mapped, prepared (pippenger point table) copy of the g1 points.
+ * @details The prepared file `bn254_g1_prepared.dat` is (re)generated from `bn254_g1.dat` when it is missing, stale or
+ * too small. Once it exists, loading the crs does no decoding or copying, and concurrent processes share its pages.
+ */
+std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> get_bn254_prover_crs(const std::filesystem::path& path,
+                                                                              size_t num_points)
+{
+    using namespace srs::factories;
+    auto prepared_path = path / "bn254_g1_prepared.dat";
+
+    if (!is_prepared_crs_usable<curve::BN254>(prepared_path, num_points)) {
+        std::filesystem::create_directories(path);
+        auto point_table = std::vector<g1::affine_element>(2 * num_points);
+        load_bn254_g1_data(path / "bn254_g1.dat", num_points, point_table.data(), /*expand_point_table=*/true);
+        vinfo("writing prepared crs of size ", std::to_string(num_points), " to ", prepared_path);
+        write_prepared_crs_point_table<curve::BN254>(prepared_path, point_table.data(), num_points);
+    } else {
+        vinfo("using prepared crs at ", prepared_path);
+    }
+    return std::make_shared<MmapProverCrs<curve::BN254>>(prepared_path, num_points);
+}
 } // namespace bb
\ No newline at end of file
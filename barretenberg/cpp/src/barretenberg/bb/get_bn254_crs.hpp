@@ -3,6 +3,7 @@
 #include "file_io.hpp"
 #include "log.hpp"
 #include <barretenberg/ecc/curves/bn254/g1.hpp>
+#include <barretenberg/srs/factories/crs_factory.hpp>
 #include <barretenberg/srs/io.hpp>
 #include <filesystem>
 #include <fstream>
@@ -11,4 +12,6 @@
 namespace bb {
 std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points);
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
+std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> get_bn254_prover_crs(const std::filesystem::path& path,
+                                                                              size_t num_points);
 } // namespace bb
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "barretenberg/common/map.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/ecc/fields/field.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "barretenberg/stdlib/honk_recursion/verifier/client_ivc_recursive_verifier.hpp"
@@ -49,9 +50,9 @@ const auto current_dir = current_path.filename().string();
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    auto bn254_prover_crs = get_bn254_prover_crs(CRS_PATH, dyadic_circuit_size + 1);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    srs::init_crs_factory_from_prover_crs(bn254_prover_crs, bn254_g2_data);
 }
 
 /**
@@ -1002,6 +1003,11 @@ int main(int argc, char* argv[])
             writeStringToStdout(BB_VERSION);
             return 0;
         }
+        // The variant of the field arithmetic kernels selected for this CPU (see field_kernels.hpp)
+        if (command == "--field_kernel") {
+            writeStringToStdout(field_kernels::field_kernel_name(field_kernels::get_field_kernel()));
+            return 0;
+        }
         if (command == "prove_and_verify") {
             return proveAndVerify(bytecode_path, witness_path) ? 0 : 1;
         }
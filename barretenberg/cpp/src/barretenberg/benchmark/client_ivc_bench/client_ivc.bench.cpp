@@ -70,77 +70,92 @@ class ClientIVCBench : public benchmark::Fixture {
      * folding circuits of unequal size.
      *
      * @param NUM_CIRCUITS Number of function circuits to accumulate
+     * @param pipelined Whether to accumulate with accumulate_async, i.e. to construct the circuits of a round while the
+     * last circuit of the previous round is being folded
      */
-    static void perform_ivc_accumulation_rounds(size_t NUM_CIRCUITS, ClientIVC& ivc, auto& precomputed_vks)
+    static void perform_ivc_accumulation_rounds(size_t NUM_CIRCUITS,
+                                                ClientIVC& ivc,
+                                                auto& precomputed_vks,
+                                                bool pipelined = false)
     {
         size_t TOTAL_NUM_CIRCUITS = NUM_CIRCUITS * 2 - 1;     // need one less kernel than number of function circuits
         ASSERT(precomputed_vks.size() == TOTAL_NUM_CIRCUITS); // ensure presence of a precomputed VK for each circuit
 
+        const auto accumulate = [&](const std::shared_ptr<Builder>& circuit, const auto& precomputed_vk) {
+            if (pipelined) {
+                ivc.accumulate_async(circuit, precomputed_vk);
+            } else {
+                ivc.accumulate(*circuit, precomputed_vk);
+            }
+        };
+
         const size_t size_hint = 1 << 17; // Size hint for reserving wires/selector vector memory in builders
-        std::vector<Builder> initial_function_circuits(2);
+        std::vector<std::shared_ptr<Builder>> initial_function_circuits{ std::make_shared<Builder>(),
+                                                                         std::make_shared<Builder>() };
 
         // Construct 2 starting function circuits in parallel
         {
             BB_OP_COUNT_TIME_NAME("construct_circuits");
             parallel_for(2, [&](size_t circuit_index) {
-                GoblinMockCircuits::construct_mock_function_circuit(initial_function_circuits[circuit_index]);
+                GoblinMockCircuits::construct_mock_function_circuit(*initial_function_circuits[circuit_index]);
             });
         };
 
         // Prepend queue to the first circuit
-        initial_function_circuits[0].op_queue->prepend_previous_queue(*ivc.goblin.op_queue);
+        initial_function_circuits[0]->op_queue->prepend_previous_queue(*ivc.goblin.op_queue);
         // Initialize ivc
-        ivc.accumulate(initial_function_circuits[0], precomputed_vks[0]);
+        accumulate(initial_function_circuits[0], precomputed_vks[0]);
         // Retrieve the queue
-        std::swap(*ivc.goblin.op_queue, *initial_function_circuits[0].op_queue);
+        std::swap(*ivc.goblin.op_queue, *initial_function_circuits[0]->op_queue);
 
         // Prepend queue to the second circuit
-        initial_function_circuits[1].op_queue->prepend_previous_queue(*ivc.goblin.op_queue);
+        initial_function_circuits[1]->op_queue->prepend_previous_queue(*ivc.goblin.op_queue);
         // Accumulate another function circuit
-        ivc.accumulate(initial_function_circuits[1], precomputed_vks[1]);
+        accumulate(initial_function_circuits[1], precomputed_vks[1]);
         // Retrieve the queue
-        std::swap(*ivc.goblin.op_queue, *initial_function_circuits[1].op_queue);
+        std::swap(*ivc.goblin.op_queue, *initial_function_circuits[1]->op_queue);
 
         // Free memory
         initial_function_circuits.clear();
 
         for (size_t circuit_idx = 2; circuit_idx < TOTAL_NUM_CIRCUITS - 1; circuit_idx += 2) {
-            Builder kernel_circuit{ size_hint, ivc.goblin.op_queue };
-            Builder function_circuit{ size_hint };
+            auto kernel_circuit = std::make_shared<Builder>(size_hint, ivc.goblin.op_queue);
+            auto function_circuit = std::make_shared<Builder>(size_hint);
             // Construct function and kernel circuits in parallel
             {
                 BB_OP_COUNT_TIME_NAME("construct_circuits");
                 parallel_for(2, [&](size_t workload_idx) {
                     // workload index is 0 for kernel and 1 for function
                     if (workload_idx == 0) {
-                        GoblinMockCircuits::construct_mock_folding_kernel(kernel_circuit);
+                        GoblinMockCircuits::construct_mock_folding_kernel(*kernel_circuit);
                     } else {
-                        GoblinMockCircuits::construct_mock_function_circuit(function_circuit);
+                        GoblinMockCircuits::construct_mock_function_circuit(*function_circuit);
                     }
                 });
             };
 
             // No need to prepend queue, it's the same after last swap
             // Accumulate kernel circuit
-            ivc.accumulate(kernel_circuit, precomputed_vks[circuit_idx]);
+            accumulate(kernel_circuit, precomputed_vks[circuit_idx]);
 
             // Prepend queue to function circuit
-            function_circuit.op_queue->prepend_previous_queue(*ivc.goblin.op_queue);
+            function_circuit->op_queue->prepend_previous_queue(*ivc.goblin.op_queue);
 
             // Accumulate function circuit
-            ivc.accumulate(function_circuit, precomputed_vks[circuit_idx + 1]);
+            accumulate(function_circuit, precomputed_vks[circuit_idx + 1]);
 
             // Retrieve queue
-            std::swap(*ivc.goblin.op_queue, *function_circuit.op_queue);
+            std::swap(*ivc.goblin.op_queue, *function_circuit->op_queue);
         }
 
         // Final kernel
-        Builder kernel_circuit{ size_hint, ivc.goblin.op_queue };
+        auto kernel_circuit = std::make_shared<Builder>(size_hint, ivc.goblin.op_queue);
         {
             BB_OP_COUNT_TIME_NAME("construct_circuits");
-            GoblinMockCircuits::construct_mock_folding_kernel(kernel_circuit);
+            GoblinMockCircuits::construct_mock_folding_kernel(*kernel_circuit);
         }
-        ivc.accumulate(kernel_circuit, precomputed_vks.back());
+        accumulate(kernel_circuit, precomputed_vks.back());
+        ivc.wait_for_accumulation();
     }
 };
 
@@ -205,6 +220,46 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Accumulate)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark the prover work for the full PG-Goblin IVC protocol, with the construction of each circuit
+ * overlapping the construction and folding of the instance of the previous one
+ *
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, FullPipelined)(benchmark::State& state)
+{
+    ClientIVC ivc;
+
+    auto num_circuits = static_cast<size_t>(state.range(0));
+    auto precomputed_vks = precompute_verification_keys(ivc, num_circuits);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        // Perform a specified number of iterations of function/kernel accumulation
+        perform_ivc_accumulation_rounds(num_circuits, ivc, precomputed_vks, /*pipelined=*/true);
+
+        // Construct IVC scheme proof (fold, decider, merge, eccvm, translator)
+        ivc.prove();
+    }
+}
+
+/**
+ * @brief Benchmark only the accumulation rounds, pipelined
+ *
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, AccumulatePipelined)(benchmark::State& state)
+{
+    ClientIVC ivc;
+
+    auto num_circuits = static_cast<size_t>(state.range(0));
+    auto precomputed_vks = precompute_verification_keys(ivc, num_circuits);
+
+    // Perform a specified number of iterations of function/kernel accumulation
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_ivc_accumulation_rounds(num_circuits, ivc, precomputed_vks, /*pipelined=*/true);
+    }
+}
+
 /**
  * @brief Benchmark only the Decider component
  *
@@ -283,6 +338,8 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Translator)(benchmark::State& state)
 BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, FullStructured)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Accumulate)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, FullPipelined)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, AccumulatePipelined)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Decide)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, ECCVM)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Translator)->Unit(benchmark::kMillisecond)->ARGS;
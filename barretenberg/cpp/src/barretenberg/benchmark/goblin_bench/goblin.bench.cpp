@@ -124,6 +124,22 @@ BENCHMARK_DEFINE_F(GoblinBench, TranslatorProve)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark only the construction of the ECCVM and Translator proofs, which overlap in GoblinProver::prove
+ *
+ */
+BENCHMARK_DEFINE_F(GoblinBench, GoblinProve)(benchmark::State& state)
+{
+    GoblinProver goblin;
+
+    // Perform a specified number of iterations of function/kernel accumulation
+    perform_goblin_accumulation_rounds(state, goblin);
+
+    for (auto _ : state) {
+        goblin.prove();
+    }
+}
+
 #define ARGS                                                                                                           \
     Arg(GoblinBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)                                                                 \
         ->Arg(1 << 0)                                                                                                  \
@@ -138,6 +154,7 @@ BENCHMARK_REGISTER_F(GoblinBench, GoblinFull)->Unit(benchmark::kMillisecond)->AR
 BENCHMARK_REGISTER_F(GoblinBench, GoblinAccumulate)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(GoblinBench, GoblinECCVMProve)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(GoblinBench, TranslatorProve)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(GoblinBench, GoblinProve)->Unit(benchmark::kMillisecond)->ARGS;
 
 } // namespace
 
@@ -2,17 +2,23 @@
 #include "barretenberg/crypto/merkle_tree/array_store.hpp"
 #include "barretenberg/crypto/merkle_tree/hash.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/leaves_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/persistent_leaves_store.hpp"
+#include "barretenberg/crypto/merkle_tree/persistent_store.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <filesystem>
 
 using namespace benchmark;
 using namespace bb::crypto::merkle_tree;
 
 using Poseidon2 = IndexedTree<ArrayStore, LeavesCache, Poseidon2HashPolicy>;
 using Pedersen = IndexedTree<ArrayStore, LeavesCache, PedersenHashPolicy>;
+using PersistentPoseidon2 = IndexedTree<PersistentStore, PersistentLeavesStore, Poseidon2HashPolicy>;
 
 const size_t TREE_DEPTH = 32;
 const size_t MAX_BATCH_SIZE = 128;
+const size_t FILL_BATCH_SIZE = 1 << 16;
 
 namespace {
 auto& random_engine = bb::numeric::get_randomness();
@@ -61,6 +67,49 @@ template <typename TreeType> void single_thread_indexed_tree_bench(State& state)
         perform_batch_insert(tree, values, true);
     }
 }
+/**
+ * @brief The directory of the persistent store holding a tree of `num_leaves` leaves
+ * @details Filling a tree of millions of leaves takes far longer than the benchmark itself, so each tree is filled once
+ * and reused by later runs. The stores are kept under $BB_INDEXED_TREE_BENCH_DIR, or the temporary directory.
+ */
+std::string persistent_store_path(size_t num_leaves)
+{
+    const char* dir = std::getenv("BB_INDEXED_TREE_BENCH_DIR");
+    const std::filesystem::path root =
+        dir != nullptr ? std::filesystem::path(dir) : std::filesystem::temp_directory_path() / "indexed_tree_bench";
+    return (root / std::to_string(num_leaves)).string();
+}
+
+template <typename TreeType> void persistent_indexed_tree_bench(State& state) noexcept
+{
+    const size_t num_leaves = size_t(state.range(0));
+    const size_t batch_size = size_t(state.range(1));
+    const size_t depth = TREE_DEPTH;
+
+    PersistentStore store(persistent_store_path(num_leaves), depth);
+    TreeType tree = TreeType(store, depth);
+    while (size_t(tree.size()) < num_leaves) {
+        std::vector<fr> values(std::min(FILL_BATCH_SIZE, num_leaves - size_t(tree.size())));
+        for (auto& value : values) {
+            value = fr(random_engine.get_random_uint256());
+        }
+        perform_batch_insert(tree, values, false);
+        store.commit();
+    }
+
+    // Each iteration inserts and commits a batch, as when processing a block
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<fr> values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            values[i] = fr(random_engine.get_random_uint256());
+        }
+        state.ResumeTiming();
+        perform_batch_insert(tree, values, false);
+        store.commit();
+    }
+}
+
 BENCHMARK(single_thread_indexed_tree_bench<Pedersen>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -84,4 +133,9 @@ BENCHMARK(multi_thread_indexed_tree_bench<Poseidon2>)
     ->Range(2, MAX_BATCH_SIZE)
     ->Iterations(1000);
 
+BENCHMARK(persistent_indexed_tree_bench<PersistentPoseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 1'000'000, 10'000'000, 100'000'000 }, { 16, MAX_BATCH_SIZE } })
+    ->Iterations(100);
+
 BENCHMARK_MAIN();
\ No newline at end of file
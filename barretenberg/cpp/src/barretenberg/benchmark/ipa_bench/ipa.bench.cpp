@@ -64,6 +64,69 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+constexpr size_t MAX_BATCH_SIZE = 16;
+// Proofs for polynomials of the maximal degree, for the batch verification benchmarks
+std::vector<std::shared_ptr<NativeTranscript>> batch_prover_transcripts;
+std::vector<OpeningClaim<Curve>> batch_opening_claims;
+static void DoBatchSetup(const benchmark::State& state)
+{
+    DoSetup(state);
+    if (!batch_prover_transcripts.empty()) {
+        return;
+    }
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t n = 1 << MAX_POLYNOMIAL_DEGREE_LOG2;
+    for (size_t k = 0; k < MAX_BATCH_SIZE; ++k) {
+        Polynomial<Fr> poly(n);
+        for (size_t i = 0; i < n; ++i) {
+            poly[i] = Fr::random_element(&engine);
+        }
+        auto x = Fr::random_element(&engine);
+        const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+        batch_opening_claims.push_back({ opening_pair, ck->commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA<Curve>::compute_opening_proof(ck, opening_pair, poly, prover_transcript);
+        batch_prover_transcripts.push_back(prover_transcript);
+    }
+}
+
+std::vector<std::shared_ptr<NativeTranscript>> get_batch_verifier_transcripts(size_t batch_size)
+{
+    std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+    for (size_t k = 0; k < batch_size; ++k) {
+        verifier_transcripts.push_back(std::make_shared<NativeTranscript>(batch_prover_transcripts[k]->proof_data));
+    }
+    return verifier_transcripts;
+}
+
+// Verify each of the proofs of a batch on its own, as the baseline for ipa_batch_verify
+void ipa_verify_each(State& state) noexcept
+{
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto verifier_transcripts = get_batch_verifier_transcripts(batch_size);
+        state.ResumeTiming();
+        for (size_t k = 0; k < batch_size; ++k) {
+            auto result = IPA<Curve>::reduce_verify(vk, batch_opening_claims[k], verifier_transcripts[k]);
+            ASSERT(result);
+        }
+    }
+}
+// Verify the proofs of a batch together, with a single MSM
+void ipa_batch_verify(State& state) noexcept
+{
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto verifier_transcripts = get_batch_verifier_transcripts(batch_size);
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_reduce_verify(
+            vk, std::span(batch_opening_claims).subspan(0, batch_size), verifier_transcripts);
+        ASSERT(result);
+    }
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -73,4 +136,14 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_verify_each)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_BATCH_SIZE)
+    ->Setup(DoBatchSetup);
+BENCHMARK(ipa_batch_verify)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_BATCH_SIZE)
+    ->Setup(DoBatchSetup);
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -41,4 +41,67 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+// Hashing independent pairs, as for the nodes of a Merkle tree level, on one core
+constexpr size_t NUM_PAIRS = 1 << 12;
+
+void hash_pairs_bench(State& state) noexcept
+{
+    std::vector<grumpkin::fq> lhs(NUM_PAIRS);
+    std::vector<grumpkin::fq> rhs(NUM_PAIRS);
+    std::vector<grumpkin::fq> output(NUM_PAIRS);
+    for (size_t i = 0; i < NUM_PAIRS; ++i) {
+        lhs[i] = grumpkin::fq::random_element();
+        rhs[i] = grumpkin::fq::random_element();
+    }
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_PAIRS; ++i) {
+            output[i] = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pair(lhs[i], rhs[i]);
+        }
+        DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_PAIRS));
+}
+BENCHMARK(hash_pairs_bench);
+
+void hash_pairs_batch_bench(State& state) noexcept
+{
+    std::vector<grumpkin::fq> lhs(NUM_PAIRS);
+    std::vector<grumpkin::fq> rhs(NUM_PAIRS);
+    std::vector<grumpkin::fq> output(NUM_PAIRS);
+    for (size_t i = 0; i < NUM_PAIRS; ++i) {
+        lhs[i] = grumpkin::fq::random_element();
+        rhs[i] = grumpkin::fq::random_element();
+    }
+    for (auto _ : state) {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs_batch(lhs, rhs, output);
+        DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_PAIRS));
+}
+BENCHMARK(hash_pairs_batch_bench);
+
+// The batched permutation with each field kernel (the argument of the benchmark)
+void permute_batch_bench(State& state) noexcept
+{
+    using Permutation = bb::crypto::Poseidon2Permutation<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+    const auto kernel = static_cast<field_kernels::FieldKernel>(state.range(0));
+    state.SetLabel(field_kernels::field_kernel_name(kernel));
+    if (!field_kernels::is_field_kernel_supported(kernel)) {
+        state.SkipWithError("kernel not supported by this CPU");
+        return;
+    }
+    std::vector<Permutation::State> states(NUM_PAIRS);
+    for (auto& permutation_state : states) {
+        for (auto& x : permutation_state) {
+            x = grumpkin::fq::random_element();
+        }
+    }
+    for (auto _ : state) {
+        Permutation::permute_batch(states, kernel);
+        DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_PAIRS));
+}
+BENCHMARK(permute_batch_bench)->DenseRange(0, 3);
+
 BENCHMARK_MAIN();
\ No newline at end of file
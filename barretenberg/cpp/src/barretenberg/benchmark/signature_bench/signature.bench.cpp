@@ -0,0 +1,127 @@
+#include "barretenberg/crypto/ecdsa/ecdsa.hpp"
+#include "barretenberg/crypto/schnorr/schnorr.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::crypto;
+
+namespace {
+constexpr size_t MAX_NUM_SIGNATURES = 10000;
+
+template <typename Fq, typename Fr, typename G1> struct EcdsaSignatures {
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<ecdsa_signature> signatures;
+
+    EcdsaSignatures()
+    {
+        for (size_t i = 0; i < MAX_NUM_SIGNATURES; ++i) {
+            ecdsa_key_pair<Fr, G1> account;
+            account.private_key = Fr::random_element();
+            account.public_key = G1::one * account.private_key;
+            messages.emplace_back("message " + std::to_string(i));
+            public_keys.emplace_back(account.public_key);
+            signatures.emplace_back(ecdsa_construct_signature<Sha256Hasher, Fq, Fr, G1>(messages.back(), account));
+        }
+    }
+};
+
+struct SchnorrSignatures {
+    std::vector<std::string> messages;
+    std::vector<grumpkin::g1::affine_element> public_keys;
+    std::vector<schnorr_signature> signatures;
+
+    SchnorrSignatures()
+    {
+        for (size_t i = 0; i < MAX_NUM_SIGNATURES; ++i) {
+            schnorr_key_pair<grumpkin::fr, grumpkin::g1> account;
+            account.private_key = grumpkin::fr::random_element();
+            account.public_key = grumpkin::g1::one * account.private_key;
+            messages.emplace_back("message " + std::to_string(i));
+            public_keys.emplace_back(account.public_key);
+            signatures.emplace_back(
+                schnorr_construct_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(messages.back(),
+                                                                                                    account));
+        }
+    }
+};
+
+template <typename T> std::vector<T> prefix(const std::vector<T>& values, const size_t size)
+{
+    return { values.begin(), values.begin() + static_cast<std::ptrdiff_t>(size) };
+}
+
+const EcdsaSignatures<secp256k1::fq, secp256k1::fr, secp256k1::g1>& ecdsa_signatures()
+{
+    static const EcdsaSignatures<secp256k1::fq, secp256k1::fr, secp256k1::g1> signatures;
+    return signatures;
+}
+
+const SchnorrSignatures& schnorr_signatures()
+{
+    static const SchnorrSignatures signatures;
+    return signatures;
+}
+} // namespace
+
+void ecdsa_verify_individually(State& state) noexcept
+{
+    const auto& data = ecdsa_signatures();
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            DoNotOptimize(ecdsa_verify_signature<Sha256Hasher, secp256k1::fq, secp256k1::fr, secp256k1::g1>(
+                data.messages[i], data.public_keys[i], data.signatures[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void ecdsa_verify_batch(State& state) noexcept
+{
+    const auto& data = ecdsa_signatures();
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    const auto messages = prefix(data.messages, num_signatures);
+    const auto public_keys = prefix(data.public_keys, num_signatures);
+    const auto signatures = prefix(data.signatures, num_signatures);
+    for (auto _ : state) {
+        DoNotOptimize(ecdsa_verify_batch<Sha256Hasher, secp256k1::fq, secp256k1::fr, secp256k1::g1>(
+            messages, public_keys, signatures));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void schnorr_verify_individually(State& state) noexcept
+{
+    const auto& data = schnorr_signatures();
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            DoNotOptimize(schnorr_verify_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+                data.messages[i], data.public_keys[i], data.signatures[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void schnorr_verify_batch(State& state) noexcept
+{
+    const auto& data = schnorr_signatures();
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    const auto messages = prefix(data.messages, num_signatures);
+    const auto public_keys = prefix(data.public_keys, num_signatures);
+    const auto signatures = prefix(data.signatures, num_signatures);
+    for (auto _ : state) {
+        DoNotOptimize(schnorr_verify_batch<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+            messages, public_keys, signatures));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ecdsa_verify_individually)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000)->Unit(kMillisecond);
+BENCHMARK(ecdsa_verify_batch)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000)->Unit(kMillisecond);
+BENCHMARK(schnorr_verify_individually)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000)->Unit(kMillisecond);
+BENCHMARK(schnorr_verify_batch)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+/**
+ * @brief Compares the ways a prover can load its monomial CRS:
+ * - legacy: read the whole g1 file, decode it point by point, then build the pippenger point table (MemProverCrs);
+ * - cold: stream the g1 file through the chunked parallel decoder, then write a prepared CRS file;
+ * - warm: map an existing prepared CRS file (MmapProverCrs).
+ */
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include "barretenberg/srs/factories/mmap_prover_crs.hpp"
+#include "barretenberg/srs/streaming_reader.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+using Curve = curve::BN254;
+using AffineElement = Curve::AffineElement;
+
+constexpr size_t MIN_NUM_POINTS_LOG2 = 16;
+constexpr size_t MAX_NUM_POINTS_LOG2 = 20;
+
+const std::filesystem::path g1_path = std::filesystem::temp_directory_path() / "srs_load_bench_g1.dat";
+const std::filesystem::path prepared_path = std::filesystem::temp_directory_path() / "srs_load_bench_prepared.dat";
+
+// Writes 1, 2, 3, ... times the generator in the serialized g1 format. Any valid points will do.
+void DoSetup(const benchmark::State&)
+{
+    const size_t num_points = 1UL << MAX_NUM_POINTS_LOG2;
+    std::vector<Curve::Element> elements(num_points);
+    elements[0] = Curve::Group::one;
+    for (size_t i = 1; i < num_points; ++i) {
+        elements[i] = elements[i - 1] + Curve::Group::one;
+    }
+    Curve::Element::batch_normalize(elements.data(), num_points);
+
+    std::vector<uint8_t> buffer(num_points * srs::SERIALIZED_G1_POINT_SIZE);
+    for (size_t i = 0; i < num_points; ++i) {
+        AffineElement::serialize_to_buffer(AffineElement(elements[i].x, elements[i].y),
+                                           &buffer[i * srs::SERIALIZED_G1_POINT_SIZE],
+                                           /* use legacy field order */ true);
+    }
+    std::ofstream file(g1_path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+}
+
+void DoTeardown(const benchmark::State&)
+{
+    std::filesystem::remove(g1_path);
+    std::filesystem::remove(prepared_path);
+}
+
+void legacy_load(State& state) noexcept
+{
+    const auto num_points = static_cast<size_t>(1 << state.range(0));
+    for (auto _ : state) {
+        std::ifstream file(g1_path, std::ios::binary);
+        std::vector<uint8_t> buffer(num_points * srs::SERIALIZED_G1_POINT_SIZE);
+        file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        std::vector<AffineElement> points(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            points[i] = from_buffer<AffineElement>(buffer, i * srs::SERIALIZED_G1_POINT_SIZE);
+        }
+        srs::factories::MemProverCrs<Curve> crs(points);
+        DoNotOptimize(crs.get_monomial_points());
+    }
+}
+
+void cold_streaming_load(State& state) noexcept
+{
+    const auto num_points = static_cast<size_t>(1 << state.range(0));
+    for (auto _ : state) {
+        std::ifstream file(g1_path, std::ios::binary);
+        auto read_bytes = [&file](uint8_t* dst, size_t size) {
+            file.read(reinterpret_cast<char*>(dst), static_cast<std::streamsize>(size));
+            return static_cast<size_t>(file.gcount());
+        };
+        std::vector<uint8_t> raw_bytes;
+        std::vector<AffineElement> point_table(2 * num_points);
+        srs::stream_g1_points<Curve>(read_bytes, num_points, raw_bytes, point_table.data(), true);
+        srs::factories::write_prepared_crs_point_table<Curve>(prepared_path, point_table.data(), num_points);
+    }
+}
+
+void warm_mmap_load(State& state) noexcept
+{
+    const auto num_points = static_cast<size_t>(1 << state.range(0));
+    if (!srs::factories::is_prepared_crs_usable<Curve>(prepared_path, num_points)) {
+        std::vector<AffineElement> points(num_points, AffineElement(Curve::Group::one));
+        srs::factories::write_prepared_crs<Curve>(prepared_path, points.data(), num_points);
+    }
+    for (auto _ : state) {
+        srs::factories::MmapProverCrs<Curve> crs(prepared_path, num_points);
+        DoNotOptimize(crs.get_monomial_points());
+    }
+}
+} // namespace
+
+BENCHMARK(legacy_load)
+    ->DenseRange(MIN_NUM_POINTS_LOG2, MAX_NUM_POINTS_LOG2, 2)
+    ->Unit(kMillisecond)
+    ->Setup(DoSetup)
+    ->Teardown(DoTeardown);
+BENCHMARK(cold_streaming_load)
+    ->DenseRange(MIN_NUM_POINTS_LOG2, MAX_NUM_POINTS_LOG2, 2)
+    ->Unit(kMillisecond)
+    ->Setup(DoSetup)
+    ->Teardown(DoTeardown);
+BENCHMARK(warm_mmap_load)
+    ->DenseRange(MIN_NUM_POINTS_LOG2, MAX_NUM_POINTS_LOG2, 2)
+    ->Unit(kMillisecond)
+    ->Setup(DoSetup)
+    ->Teardown(DoTeardown);
+
+BENCHMARK_MAIN();
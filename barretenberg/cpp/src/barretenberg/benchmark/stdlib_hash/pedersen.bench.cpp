@@ -117,6 +117,20 @@ void native_pedersen_hash_pair_bench(State& state) noexcept
 }
 BENCHMARK(native_pedersen_hash_pair_bench)->Unit(benchmark::kMillisecond)->MinTime(3);
 
+void native_pedersen_hash_pair_batch_bench(State& state) noexcept
+{
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<std::vector<grumpkin::fq>> inputs(num_pairs);
+    for (auto& input : inputs) {
+        input = { grumpkin::fq::random_element(), grumpkin::fq::random_element() };
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_batch(inputs));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(native_pedersen_hash_pair_batch_bench)->Unit(benchmark::kMillisecond)->Arg(1 << 10)->Arg(1 << 14);
+
 void construct_pedersen_proving_keys_bench(State& state) noexcept
 {
     for (auto _ : state) {
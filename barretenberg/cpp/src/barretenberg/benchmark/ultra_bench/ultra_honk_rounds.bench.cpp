@@ -2,6 +2,7 @@
 
 #include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
 #include "barretenberg/common/op_count_google_bench.hpp"
+#include "barretenberg/goblin/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/ultra_honk/decider_prover.hpp"
 #include "barretenberg/ultra_honk/oink_prover.hpp"
@@ -84,6 +85,69 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
     }                                                                                                                  \
     BENCHMARK(ROUND_##round)->DenseRange(12, 19)->Unit(kMillisecond)
 
+/**
+ * @details Benchmark the relation check rounds over a mock ClientIVC function circuit in a structured trace, where most
+ * rows of the trace are padding. With state.range(0) == 0, Sumcheck visits every row of the trace rather than only the
+ * active rows.
+ */
+BB_PROFILE static void RELATION_CHECK_STRUCTURED(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    MegaCircuitBuilder builder;
+    GoblinMockCircuits::construct_mock_function_circuit(builder);
+    MegaProver prover(std::make_shared<ProverInstance_<MegaFlavor>>(builder, /*is_structured=*/true),
+                      std::make_shared<MegaFlavor::Transcript>());
+
+    OinkProver<MegaFlavor> oink_prover(prover.instance->proving_key, prover.transcript);
+    auto [proving_key, relation_parameters, alphas] = oink_prover.prove();
+    prover.instance->proving_key = std::move(proving_key);
+    prover.instance->relation_parameters = std::move(relation_parameters);
+    prover.instance->alphas = alphas;
+    prover.generate_gate_challenges();
+    if (state.range(0) == 0) {
+        prover.instance->proving_key.active_row_ranges.clear();
+    }
+
+    for (auto _ : state) {
+        DeciderProver_<MegaFlavor> decider_prover(prover.instance, std::make_shared<MegaFlavor::Transcript>());
+        decider_prover.execute_relation_check_rounds();
+    }
+}
+BENCHMARK(RELATION_CHECK_STRUCTURED)->Arg(0)->Arg(1)->Unit(kMillisecond);
+
+/**
+ * @details Benchmark execute_zeromorph_rounds of the DeciderProver on its own: the proof is constructed up to the end
+ * of sumcheck once, and each iteration runs the Zeromorph rounds from a copy of the transcript at that point. Unlike
+ * ROUND_ZEROMORPH, this does not redo the rest of the proof on each iteration, so it is cheap to run with enough
+ * iterations to compare thread counts (see HARDWARE_CONCURRENCY).
+ */
+BB_PROFILE static void ZEROMORPH_ROUNDS(State& state) noexcept
+{
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    auto prover = bb::mock_circuits::get_prover<MegaProver>(
+        &bb::mock_circuits::generate_basic_arithmetic_circuit<MegaCircuitBuilder>, log2_num_gates);
+    OinkProver<MegaFlavor> oink_prover(prover.instance->proving_key, prover.transcript);
+    auto [proving_key, relation_parameters, alphas] = oink_prover.prove();
+    prover.instance->proving_key = std::move(proving_key);
+    prover.instance->relation_parameters = std::move(relation_parameters);
+    prover.instance->alphas = alphas;
+    prover.generate_gate_challenges();
+    DeciderProver_<MegaFlavor> decider_prover(prover.instance, prover.transcript);
+    decider_prover.execute_relation_check_rounds();
+    const MegaFlavor::Transcript transcript_after_sumcheck = *prover.transcript;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        decider_prover.transcript = std::make_shared<MegaFlavor::Transcript>(transcript_after_sumcheck);
+        state.ResumeTiming();
+        decider_prover.execute_zeromorph_rounds();
+    }
+}
+BENCHMARK(ZEROMORPH_ROUNDS)->DenseRange(14, 20, 2)->Unit(kMillisecond);
+
 // Fast rounds take a long time to benchmark because of how we compute statistical significance.
 // Limit to one iteration so we don't spend a lot of time redoing full proofs just to measure this part.
 ROUND_BENCHMARK(PREAMBLE)->Iterations(1);
@@ -0,0 +1,98 @@
+/**
+ * @brief Isolates the wnaf digit generation phase of pippenger (`fixed_wnaf_with_counts_batch`) for each kernel, and
+ * times it as part of `compute_wnaf_states`, which adds the Montgomery conversion and endomorphism split.
+ */
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/wnaf_batch.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::scalar_multiplication;
+
+namespace {
+using Curve = curve::BN254;
+using Fr = Curve::ScalarField;
+
+
+/**
+ * @brief Digit generation for 2^state.range(1) endomorphism scalars (127 bits) with kernel state.range(0), at the
+ * wnaf width pippenger would use.
+ */
+void digit_generation(State& state)
+{
+    const auto kernel = static_cast<WnafKernel>(state.range(0));
+    if (!is_wnaf_kernel_supported(kernel)) {
+        state.SkipWithError("wnaf kernel not supported on this CPU");
+        return;
+    }
+    const size_t num_scalars = 1UL << static_cast<size_t>(state.range(1));
+    const size_t wnaf_bits = get_optimal_bucket_width(num_scalars / 2) + 1;
+    const size_t num_rounds = WNAF_SIZE(wnaf_bits);
+
+    auto& engine = numeric::get_debug_randomness();
+    std::vector<uint64_t> scalars(2 * num_scalars);
+    for (size_t i = 0; i < num_scalars; ++i) {
+        scalars[2 * i] = engine.get_random_uint64();
+        scalars[2 * i + 1] = engine.get_random_uint64() & 0x7fffffffffffffffUL;
+    }
+    std::vector<uint64_t> wnaf(num_rounds * num_scalars);
+    auto skews = std::make_unique<bool[]>(num_scalars);
+    std::vector<uint64_t> round_counts(num_rounds);
+
+    for (auto _ : state) {
+        std::fill(round_counts.begin(), round_counts.end(), 0);
+        fixed_wnaf_with_counts_batch(scalars.data(),
+                                     num_scalars,
+                                     wnaf.data(),
+                                     skews.get(),
+                                     round_counts.data(),
+                                     0,
+                                     num_scalars,
+                                     wnaf_bits,
+                                     kernel);
+        DoNotOptimize(wnaf.data());
+    }
+}
+
+/**
+ * @brief compute_wnaf_states on 2^state.range(0) field scalars, with the kernel selected for this CPU.
+ */
+void wnaf_states(State& state)
+{
+    const size_t num_points = 1UL << static_cast<size_t>(state.range(0));
+    const size_t num_rounds = get_num_rounds(2 * num_points);
+    // Powers of a random element, as sampling each scalar is much slower than the benchmark itself
+    std::vector<Fr> scalars(num_points);
+    const Fr element = Fr::random_element();
+    Fr accumulator = element;
+    for (auto& scalar : scalars) {
+        accumulator *= element;
+        scalar = accumulator;
+    }
+    auto point_schedule = std::make_unique<uint64_t[]>(num_rounds * 2 * num_points);
+    auto skews = std::make_unique<bool[]>(2 * num_points);
+    std::vector<uint64_t> round_counts(num_rounds);
+
+    for (auto _ : state) {
+        scalar_multiplication::compute_wnaf_states<Curve>(
+            point_schedule.get(), skews.get(), round_counts.data(), scalars.data(), num_points);
+        DoNotOptimize(point_schedule.get());
+    }
+}
+} // namespace
+
+BENCHMARK(digit_generation)
+    ->ArgsProduct({ { static_cast<int64_t>(WnafKernel::SCALAR),
+                      static_cast<int64_t>(WnafKernel::AVX2),
+                      static_cast<int64_t>(WnafKernel::AVX512) },
+                    { 18, 20, 22 } })
+    ->Unit(kMillisecond);
+BENCHMARK(wnaf_states)->DenseRange(18, 22, 2)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
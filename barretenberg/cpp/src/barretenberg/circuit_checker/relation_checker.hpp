@@ -0,0 +1,178 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/task_scheduler.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/relations/relation_parameters.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace bb {
+
+/**
+ * @brief Checks that the relations of a flavor hold on its prover polynomials, as computed from a trace
+ *
+ * @details The checks are queued with add_relation (for relations that must vanish on every row) and add_logderivative
+ * (for log-derivative lookups and permutations), and run by `check`, which is meant for debugging and testing
+ * circuits (e.g. the check_circuit of the PIL-generated VMs).
+ *
+ * All checks run concurrently, and the rows of each are split into chunks that are checked in parallel. The rows are
+ * read in place through the flavor's RowView, rather than copied. Once a check fails, the work that could only find a
+ * later failure (in the order in which the checks were added, then by row) is skipped, so that the failure reported is
+ * the same as if the checks were run one after the other.
+ */
+template <typename Flavor> class RelationChecker {
+  public:
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using RowView = typename Flavor::RowView;
+
+    static constexpr size_t ROWS_PER_CHUNK = 1 << 10;
+
+    RelationChecker(ProverPolynomials& polynomials, size_t num_rows)
+        : polynomials(polynomials)
+        , num_rows(num_rows)
+    {}
+
+    /**
+     * @brief Queue the check that each subrelation of `Relation` vanishes on each row
+     */
+    template <typename Relation> void add_relation(const std::string& name, std::string (*debug_label)(int))
+    {
+        checks.emplace_back([this, name, debug_label](size_t check_index) {
+            parallel_for_range(num_chunks(), [&](size_t chunk) {
+                typename Relation::SumcheckArrayOfValuesOverSubrelations result;
+                for (auto& r : result) {
+                    r = 0;
+                }
+                const size_t start = chunk * ROWS_PER_CHUNK;
+                const size_t end = std::min(start + ROWS_PER_CHUNK, num_rows);
+                RowView row(polynomials);
+                for (size_t i = start; i < end; ++i) {
+                    if (is_preceded_by_failure(check_index, i)) {
+                        return;
+                    }
+                    row.set_row(i);
+                    Relation::accumulate(result, row, {}, 1);
+                    for (size_t j = 0; j < result.size(); ++j) {
+                        if (result[j] != 0) {
+                            record_failure(check_index,
+                                           i,
+                                           format("Relation ",
+                                                  name,
+                                                  ", subrelation index ",
+                                                  debug_label(static_cast<int>(j)),
+                                                  " failed at row ",
+                                                  i));
+                            return;
+                        }
+                    }
+                }
+            });
+        });
+    }
+
+    /**
+     * @brief Queue the check of a log-derivative lookup or permutation, which first computes its inverse polynomial
+     */
+    template <typename LogDerivativeSettings>
+    void add_logderivative(const std::string& name, const RelationParameters<FF>& params)
+    {
+        checks.emplace_back([this, name, params](size_t check_index) {
+            if (is_preceded_by_failure(check_index, 0)) {
+                return;
+            }
+            bb::compute_logderivative_inverse<Flavor, LogDerivativeSettings>(polynomials, params, num_rows);
+
+            // The subrelations are checked over the sum of all rows, so each chunk contributes a partial sum
+            using Result = typename LogDerivativeSettings::SumcheckArrayOfValuesOverSubrelations;
+            std::vector<Result> chunk_results(num_chunks());
+            parallel_for_range(num_chunks(), [&](size_t chunk) {
+                Result& result = chunk_results[chunk];
+                for (auto& r : result) {
+                    r = 0;
+                }
+                const size_t end = std::min((chunk + 1) * ROWS_PER_CHUNK, num_rows);
+                RowView row(polynomials);
+                for (size_t i = chunk * ROWS_PER_CHUNK; i < end; ++i) {
+                    row.set_row(i);
+                    LogDerivativeSettings::accumulate(result, row, params, 1);
+                }
+            });
+            for (size_t j = 0; j < std::tuple_size_v<Result>; ++j) {
+                FF sum = 0;
+                for (const auto& result : chunk_results) {
+                    sum += result[j];
+                }
+                if (sum != 0) {
+                    record_failure(check_index, 0, format("Lookup ", name, " failed."));
+                    return;
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Run the queued checks
+     *
+     * @return true if they all pass. Otherwise, throws (or aborts) with a description of the first failure.
+     */
+    bool check()
+    {
+        parallel_for_range(checks.size(), [&](size_t check_index) { checks[check_index](check_index); });
+        if (first_failure.load() != NO_FAILURE) {
+            throw_or_abort(first_failure_message);
+            return false;
+        }
+        return true;
+    }
+
+  private:
+    static constexpr uint64_t NO_FAILURE = std::numeric_limits<uint64_t>::max();
+
+    ProverPolynomials& polynomials;
+    size_t num_rows;
+    std::vector<std::function<void(size_t)>> checks;
+
+    // The position of the first failure found, by check and then by row (see failure_position)
+    std::atomic<uint64_t> first_failure = NO_FAILURE;
+    std::string first_failure_message;
+#ifndef NO_MULTITHREADING
+    std::mutex failure_mutex;
+#endif
+
+    size_t num_chunks() const { return (num_rows + ROWS_PER_CHUNK - 1) / ROWS_PER_CHUNK; }
+
+    uint64_t failure_position(size_t check_index, size_t row) const
+    {
+        return static_cast<uint64_t>(check_index) * (num_rows + 1) + row;
+    }
+
+    bool is_preceded_by_failure(size_t check_index, size_t row) const
+    {
+        return first_failure.load(std::memory_order_relaxed) < failure_position(check_index, row);
+    }
+
+    void record_failure(size_t check_index, size_t row, std::string message)
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(failure_mutex);
+#endif
+        const uint64_t position = failure_position(check_index, row);
+        if (position < first_failure.load()) {
+            first_failure_message = std::move(message);
+            first_failure.store(position);
+        }
+    }
+};
+
+} // namespace bb
@@ -847,4 +847,36 @@ TEST(ultra_circuit_constructor, check_circuit_showcase)
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), true);
 }
 
+// The rows of a large circuit are checked in ranges, concurrently; a failing gate is found wherever it is
+TEST(ultra_circuit_constructor, check_circuit_over_many_row_ranges)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+    std::vector<uint32_t> sum_indices;
+    for (size_t i = 0; i < 5000; ++i) {
+        fr left = fr::random_element();
+        fr right = fr::random_element();
+        uint32_t left_idx = circuit_constructor.add_variable(left);
+        uint32_t right_idx = circuit_constructor.add_variable(right);
+        uint32_t sum_idx = circuit_constructor.add_variable(left + right);
+        circuit_constructor.create_add_gate({ left_idx, right_idx, sum_idx, fr(1), fr(1), fr(-1), fr(0) });
+        sum_indices.push_back(sum_idx);
+    }
+    // Tagged variables, used in gates of many ranges
+    std::vector<uint32_t> range_indices;
+    for (size_t i = 0; i < 3000; ++i) {
+        range_indices.push_back(circuit_constructor.add_variable(fr(i)));
+        circuit_constructor.create_new_range_constraint(range_indices.back(), 3000);
+    }
+    circuit_constructor.create_dummy_constraints(range_indices);
+    EXPECT_TRUE(CircuitChecker::check(circuit_constructor));
+
+    // Break gates in the first and last ranges of the arithmetic block
+    for (size_t gate_idx : { 10UL, 4990UL }) {
+        UltraCircuitBuilder broken_circuit_constructor{ circuit_constructor };
+        uint32_t real_idx = broken_circuit_constructor.real_variable_index[sum_indices[gate_idx]];
+        broken_circuit_constructor.variables[real_idx] += 1;
+        EXPECT_FALSE(CircuitChecker::check(broken_circuit_constructor));
+    }
+}
+
 } // namespace bb
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "ultra_circuit_checker.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include <barretenberg/plonk/proof_system/constants.hpp>
+#include <algorithm>
 #include <unordered_set>
 
 namespace bb {
@@ -22,47 +23,89 @@ template <typename Builder> bool UltraCircuitChecker::check(const Builder& build
     builder.finalize_circuit();
 
     // Construct a hash table for lookup table entries to efficiently determine if a lookup gate is valid
-    LookupHashTable lookup_hash_table;
-    for (const auto& table : builder.lookup_tables) {
-        const FF table_index(table.table_index);
-        for (size_t i = 0; i < table.size(); ++i) {
-            lookup_hash_table.insert({ table.column_1[i], table.column_2[i], table.column_3[i], table_index });
-        }
-    }
+    LookupHashTable lookup_hash_table{ builder };
 
     // Instantiate structs used for checking tag and memory record correctness
-    TagCheckData tag_data;
+    TagCheckData tag_data{ builder };
     MemoryCheckData memory_data{ builder };
 
-    bool result = true;
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/870): Currently we check all relations for each block.
-    // Once sorting is complete, is will be sufficient to check only the relevant relation(s) per block.
-    size_t block_idx = 0;
-    for (auto& block : builder.blocks.get()) {
-        result = result && check_block(builder, block, tag_data, memory_data, lookup_hash_table);
-        if (!result) {
-            info("Failed at block idx = ", block_idx);
-            return false;
+    // Split the blocks into ranges of rows, and determine the relations that can fail in each block
+    auto blocks = builder.blocks.get();
+    std::vector<BlockRelations> block_relations(blocks.size());
+    std::vector<size_t> block_offsets;
+    std::vector<RowRange> ranges;
+    size_t offset = 0;
+    for (size_t block_idx = 0; block_idx < blocks.size(); ++block_idx) {
+        const size_t block_size = blocks[block_idx].size();
+        for (size_t start = 0; start < block_size; start += ROWS_PER_RANGE) {
+            ranges.push_back({ block_idx, start, std::min(start + ROWS_PER_RANGE, block_size), offset });
         }
-        block_idx++;
+        block_offsets.push_back(offset);
+        offset += block_size;
+    }
+    parallel_for_range(blocks.size(), [&](size_t block_idx) {
+        block_relations[block_idx] = get_block_relations<Builder>(blocks[block_idx]);
+    });
+
+    // Check all ranges concurrently
+    FailureData failure;
+    parallel_for_range(ranges.size(), [&](size_t range_idx) {
+        const RowRange& range = ranges[range_idx];
+        check_rows(builder,
+                   blocks[range.block_idx],
+                   block_relations[range.block_idx],
+                   range,
+                   tag_data,
+                   memory_data,
+                   lookup_hash_table,
+                   failure);
+    });
+    if (failure.first_failed_row.load() != FailureData::NO_FAILURE) {
+        info(failure.message, failure.block_row_idx);
+#ifdef CHECK_CIRCUIT_STACKTRACES
+        blocks[failure.block_idx].stack_traces.print(failure.block_row_idx);
+#endif
+        info("Failed at block idx = ", failure.block_idx);
+        return false;
     }
 
     // Tag check is only expected to pass after entire execution trace (all blocks) have been processed
-    result = result && check_tag_data(tag_data);
-    if (!result) {
+    if (!check_tag_data(builder, tag_data, memory_data, block_offsets)) {
         info("Failed tag check.");
         return false;
     }
 
-    return result;
+    return true;
 };
 
+template <typename Builder> UltraCircuitChecker::BlockRelations UltraCircuitChecker::get_block_relations(auto& block)
+{
+    auto is_not_zero = [](auto& selector) {
+        return std::any_of(selector.begin(), selector.end(), [](const FF& value) { return !value.is_zero(); });
+    };
+    BlockRelations relations;
+    relations.arithmetic = is_not_zero(block.q_arith());
+    relations.elliptic = is_not_zero(block.q_elliptic());
+    relations.auxiliary = is_not_zero(block.q_aux());
+    relations.delta_range = is_not_zero(block.q_delta_range());
+    relations.lookup = is_not_zero(block.q_lookup_type());
+    if constexpr (IsMegaBuilder<Builder>) {
+        relations.poseidon_internal = is_not_zero(block.q_poseidon2_internal());
+        relations.poseidon_external = is_not_zero(block.q_poseidon2_external());
+        relations.databus = is_not_zero(block.q_busread());
+    }
+    return relations;
+}
+
 template <typename Builder>
-bool UltraCircuitChecker::check_block(Builder& builder,
-                                      auto& block,
-                                      TagCheckData& tag_data,
-                                      MemoryCheckData& memory_data,
-                                      LookupHashTable& lookup_hash_table)
+void UltraCircuitChecker::check_rows(Builder& builder,
+                                     auto& block,
+                                     const BlockRelations& relations,
+                                     const RowRange& range,
+                                     TagCheckData& tag_data,
+                                     const MemoryCheckData& memory_data,
+                                     const LookupHashTable& lookup_hash_table,
+                                     FailureData& failure)
 {
     // Initialize empty AllValues of the correct Flavor based on Builder type; for input to Relation::accumulate
     auto values = init_empty_values<Builder>();
@@ -71,60 +114,44 @@ bool UltraCircuitChecker::check_block(Builder& builder,
     params.eta_two = memory_data.eta_two;
     params.eta_three = memory_data.eta_three;
 
-    auto report_fail = [&](const char* message, size_t row_idx) {
-        info(message, row_idx);
-#ifdef CHECK_CIRCUIT_STACKTRACES
-        block.stack_traces.print(row_idx);
-#endif
-        return false;
-    };
-
-    // Perform checks on each gate defined in the builder
-    bool result = true;
-    for (size_t idx = 0; idx < block.size(); ++idx) {
+    // Perform checks on each gate in the range. A relation whose selector is zero in the whole block is satisfied.
+    for (size_t idx = range.start; idx < range.end; ++idx) {
+        const size_t row = range.offset + idx;
+        if (failure.is_preceded_by_failure(row)) {
+            return;
+        }
 
-        populate_values(builder, block, values, tag_data, memory_data, idx);
+        populate_values(builder, block, values, memory_data, idx);
+        update_tag_check_data(builder, block, tag_data, idx, row);
 
-        result = result && check_relation<Arithmetic>(values, params);
-        if (!result) {
-            return report_fail("Failed Arithmetic relation at row idx = ", idx);
-        }
-        result = result && check_relation<Elliptic>(values, params);
-        if (!result) {
-            return report_fail("Failed Elliptic relation at row idx = ", idx);
-        }
-        result = result && check_relation<Auxiliary>(values, params);
-        if (!result) {
-            return report_fail("Failed Auxiliary relation at row idx = ", idx);
-        }
-        result = result && check_relation<DeltaRangeConstraint>(values, params);
-        if (!result) {
-            return report_fail("Failed DeltaRangeConstraint relation at row idx = ", idx);
-        }
-        result = result && check_lookup(values, lookup_hash_table);
-        if (!result) {
-            return report_fail("Failed Lookup check relation at row idx = ", idx);
+        const char* message = nullptr;
+        if (relations.arithmetic && !check_relation<Arithmetic>(values, params)) {
+            message = "Failed Arithmetic relation at row idx = ";
+        } else if (relations.elliptic && !check_relation<Elliptic>(values, params)) {
+            message = "Failed Elliptic relation at row idx = ";
+        } else if (relations.auxiliary && !check_relation<Auxiliary>(values, params)) {
+            message = "Failed Auxiliary relation at row idx = ";
+        } else if (relations.delta_range && !check_relation<DeltaRangeConstraint>(values, params)) {
+            message = "Failed DeltaRangeConstraint relation at row idx = ";
+        } else if (relations.lookup && !check_lookup(values, lookup_hash_table)) {
+            message = "Failed Lookup check relation at row idx = ";
         }
         if constexpr (IsMegaBuilder<Builder>) {
-            result = result && check_relation<PoseidonInternal>(values, params);
-            if (!result) {
-                return report_fail("Failed PoseidonInternal relation at row idx = ", idx);
-            }
-            result = result && check_relation<PoseidonExternal>(values, params);
-            if (!result) {
-                return report_fail("Failed PoseidonExternal relation at row idx = ", idx);
-            }
-            result = result && check_databus_read(values, builder);
-            if (!result) {
-                return report_fail("Failed databus read at row idx = ", idx);
+            if (message == nullptr) {
+                if (relations.poseidon_internal && !check_relation<PoseidonInternal>(values, params)) {
+                    message = "Failed PoseidonInternal relation at row idx = ";
+                } else if (relations.poseidon_external && !check_relation<PoseidonExternal>(values, params)) {
+                    message = "Failed PoseidonExternal relation at row idx = ";
+                } else if (relations.databus && !check_databus_read(values, builder)) {
+                    message = "Failed databus read at row idx = ";
+                }
             }
         }
-        if (!result) {
-            return report_fail("Failed at row idx = ", idx);
+        if (message != nullptr) {
+            failure.record(message, range.block_idx, idx, row);
+            return;
         }
     }
-
-    return result;
 };
 
 template <typename Relation> bool UltraCircuitChecker::check_relation(auto& values, auto& params)
@@ -175,11 +202,11 @@ template <typename Builder> bool UltraCircuitChecker::check_databus_read(auto& v
         // Check that the claimed value is present in the calldata/return data at the corresponding index
         FF bus_value;
         if (is_calldata_read) {
-            auto calldata = builder.get_calldata();
+            const auto& calldata = builder.get_calldata();
             bus_value = builder.get_variable(calldata[raw_read_idx]);
         }
         if (is_return_data_read) {
-            auto return_data = builder.get_return_data();
+            const auto& return_data = builder.get_return_data();
             bus_value = builder.get_variable(return_data[raw_read_idx]);
         }
         return (value == bus_value);
@@ -187,78 +214,108 @@ template <typename Builder> bool UltraCircuitChecker::check_databus_read(auto& v
     return true;
 };
 
-bool UltraCircuitChecker::check_tag_data(const TagCheckData& tag_data)
+template <typename Builder>
+bool UltraCircuitChecker::check_tag_data(Builder& builder,
+                                         const TagCheckData& tag_data,
+                                         const MemoryCheckData& memory_data,
+                                         const std::vector<size_t>& block_offsets)
 {
-    return tag_data.left_product == tag_data.right_product;
+    auto blocks = builder.blocks.get();
+    constexpr size_t NUM_WIRES = Builder::NUM_WIRES;
+    constexpr size_t VARIABLES_PER_CHUNK = 1 << 14;
+
+    // Compute the products of (value + γ ⋅ tag) and of (value + γ ⋅ tau[tag]) over chunks of variables
+    const size_t num_variables = tag_data.first_occurrences.size();
+    const size_t num_chunks = (num_variables + VARIABLES_PER_CHUNK - 1) / VARIABLES_PER_CHUNK;
+    std::vector<FF> left_products(num_chunks, FF::one());
+    std::vector<FF> right_products(num_chunks, FF::one());
+    parallel_for_range(num_chunks, [&](size_t chunk) {
+        const size_t end = std::min((chunk + 1) * VARIABLES_PER_CHUNK, num_variables);
+        for (size_t real_index = chunk * VARIABLES_PER_CHUNK; real_index < end; ++real_index) {
+            const uint64_t position = tag_data.first_occurrences[real_index].load(std::memory_order_relaxed);
+            if (position == TagCheckData::NOT_ENCOUNTERED) {
+                continue;
+            }
+            // The value of a variable is the same in each of its wires, except for memory records in the 4th wire
+            FF value = builder.variables[real_index];
+            const auto row = static_cast<size_t>(position / NUM_WIRES);
+            if (position % NUM_WIRES == 3) {
+                const size_t block_idx = static_cast<size_t>(
+                    std::upper_bound(block_offsets.begin(), block_offsets.end(), row) - block_offsets.begin() - 1);
+                value = get_w_4_value(builder, blocks[block_idx], memory_data, row - block_offsets[block_idx]);
+            }
+            uint32_t tag_in = builder.real_variable_tags[real_index];
+            uint32_t tag_out = builder.tau.at(tag_in);
+            left_products[chunk] *= value + tag_data.gamma * FF(tag_in);
+            right_products[chunk] *= value + tag_data.gamma * FF(tag_out);
+        }
+    });
+    FF left_product = FF::one();
+    FF right_product = FF::one();
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        left_product *= left_products[chunk];
+        right_product *= right_products[chunk];
+    }
+    return left_product == right_product;
 };
 
 template <typename Builder>
-void UltraCircuitChecker::populate_values(
-    Builder& builder, auto& block, auto& values, TagCheckData& tag_data, MemoryCheckData& memory_data, size_t idx)
+void UltraCircuitChecker::update_tag_check_data(
+    Builder& builder, auto& block, TagCheckData& tag_data, size_t idx, size_t row)
 {
-    // Function to quickly update tag products and encountered variable set by index and value
-    auto update_tag_check_data = [&](const size_t variable_index, const FF& value) {
-        size_t real_index = builder.real_variable_index[variable_index];
-        // Check to ensure that we are not including a variable twice
-        if (tag_data.encountered_variables.contains(real_index)) {
-            return;
-        }
-        uint32_t tag_in = builder.real_variable_tags[real_index];
-        if (tag_in != DUMMY_TAG) {
-            uint32_t tag_out = builder.tau.at(tag_in);
-            tag_data.left_product *= value + tag_data.gamma * FF(tag_in);
-            tag_data.right_product *= value + tag_data.gamma * FF(tag_out);
-            tag_data.encountered_variables.insert(real_index);
+    size_t wire_idx = 0;
+    for (auto& wire : block.wires) {
+        const size_t real_index = builder.real_variable_index[wire[idx]];
+        if (builder.real_variable_tags[real_index] != DUMMY_TAG) {
+            // Keep the first occurrence in the trace, whichever range finds it first
+            const uint64_t position = row * Builder::NUM_WIRES + wire_idx;
+            auto& first_occurrence = tag_data.first_occurrences[real_index];
+            uint64_t current = first_occurrence.load(std::memory_order_relaxed);
+            while (position < current &&
+                   !first_occurrence.compare_exchange_weak(current, position, std::memory_order_relaxed)) {
+            }
         }
-    };
+        wire_idx++;
+    }
+}
 
-    // A lambda function for computing a memory record term of the form w3 * eta_three + w2 * eta_two + w1 * eta
-    auto compute_memory_record_term =
-        [](const FF& w_1, const FF& w_2, const FF& w_3, const FF& eta, const FF& eta_two, FF& eta_three) {
-            return (w_3 * eta_three + w_2 * eta_two + w_1 * eta);
-        };
+template <typename Builder>
+UltraCircuitChecker::FF UltraCircuitChecker::get_w_4_value(Builder& builder,
+                                                           auto& block,
+                                                           const MemoryCheckData& memory_data,
+                                                           size_t idx)
+{
+    // A memory record term is of the form w3 * eta_three + w2 * eta_two + w1 * eta, plus one for write records.
+    // Note: memory_data contains indices into the block to which RAM/ROM gates were added so we need to check that
+    // we are indexing into the correct block.
+    if (block.has_ram_rom) {
+        const bool is_read = memory_data.read_record_gates.contains(idx);
+        if (is_read || memory_data.write_record_gates.contains(idx)) {
+            FF record = builder.get_variable(block.w_o()[idx]) * memory_data.eta_three +
+                        builder.get_variable(block.w_r()[idx]) * memory_data.eta_two +
+                        builder.get_variable(block.w_l()[idx]) * memory_data.eta;
+            return is_read ? record : record + FF::one();
+        }
+    }
+    return builder.get_variable(block.w_4()[idx]);
+}
 
+template <typename Builder>
+void UltraCircuitChecker::populate_values(
+    Builder& builder, auto& block, auto& values, const MemoryCheckData& memory_data, size_t idx)
+{
     // Set wire values. Wire 4 is treated specially since it may contain memory records
     values.w_l = builder.get_variable(block.w_l()[idx]);
     values.w_r = builder.get_variable(block.w_r()[idx]);
     values.w_o = builder.get_variable(block.w_o()[idx]);
-    // Note: memory_data contains indices into the block to which RAM/ROM gates were added so we need to check that
-    // we are indexing into the correct block before updating the w_4 value.
-    if (block.has_ram_rom && memory_data.read_record_gates.contains(idx)) {
-        values.w_4 = compute_memory_record_term(
-            values.w_l, values.w_r, values.w_o, memory_data.eta, memory_data.eta_two, memory_data.eta_three);
-    } else if (block.has_ram_rom && memory_data.write_record_gates.contains(idx)) {
-        values.w_4 =
-            compute_memory_record_term(
-                values.w_l, values.w_r, values.w_o, memory_data.eta, memory_data.eta_two, memory_data.eta_three) +
-            FF::one();
-    } else {
-        values.w_4 = builder.get_variable(block.w_4()[idx]);
-    }
+    values.w_4 = get_w_4_value(builder, block, memory_data, idx);
 
     // Set shifted wire values. Again, wire 4 is treated specially. On final row, set shift values to zero
     if (idx < block.size() - 1) {
         values.w_l_shift = builder.get_variable(block.w_l()[idx + 1]);
         values.w_r_shift = builder.get_variable(block.w_r()[idx + 1]);
         values.w_o_shift = builder.get_variable(block.w_o()[idx + 1]);
-        if (block.has_ram_rom && memory_data.read_record_gates.contains(idx + 1)) {
-            values.w_4_shift = compute_memory_record_term(values.w_l_shift,
-                                                          values.w_r_shift,
-                                                          values.w_o_shift,
-                                                          memory_data.eta,
-                                                          memory_data.eta_two,
-                                                          memory_data.eta_three);
-        } else if (block.has_ram_rom && memory_data.write_record_gates.contains(idx + 1)) {
-            values.w_4_shift = compute_memory_record_term(values.w_l_shift,
-                                                          values.w_r_shift,
-                                                          values.w_o_shift,
-                                                          memory_data.eta,
-                                                          memory_data.eta_two,
-                                                          memory_data.eta_three) +
-                               FF::one();
-        } else {
-            values.w_4_shift = builder.get_variable(block.w_4()[idx + 1]);
-        }
+        values.w_4_shift = get_w_4_value(builder, block, memory_data, idx + 1);
     } else {
         values.w_l_shift = 0;
         values.w_r_shift = 0;
@@ -266,12 +323,6 @@ void UltraCircuitChecker::populate_values(
         values.w_4_shift = 0;
     }
 
-    // Update tag check data
-    update_tag_check_data(block.w_l()[idx], values.w_l);
-    update_tag_check_data(block.w_r()[idx], values.w_r);
-    update_tag_check_data(block.w_o()[idx], values.w_o);
-    update_tag_check_data(block.w_4()[idx], values.w_4);
-
     // Set selector values
     values.q_m = block.q_m()[idx];
     values.q_c = block.q_c()[idx];
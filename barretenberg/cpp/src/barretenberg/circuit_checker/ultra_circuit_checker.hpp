@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/task_scheduler.hpp"
 #include "barretenberg/relations/auxiliary_relation.hpp"
 #include "barretenberg/relations/delta_range_constraint_relation.hpp"
 #include "barretenberg/relations/ecc_op_queue_relation.hpp"
@@ -11,7 +12,16 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
 
 namespace bb {
 
@@ -35,34 +45,55 @@ class UltraCircuitChecker {
      * check the correctness of lookup gates by simply ensuring that the inputs to those gates are present in the lookup
      * tables attached to the circuit.
      *
+     * The rows of all blocks are split into ranges that are checked concurrently, each against the relations whose
+     * selectors are not zero in its block. The gate reported on failure is the first failing gate of the trace, as when
+     * the rows are checked one after the other.
+     *
      * @tparam Builder
      * @param builder
      */
     template <typename Builder> static bool check(const Builder& builder);
 
   private:
+    static constexpr size_t ROWS_PER_RANGE = 1 << 10;
+
     struct TagCheckData;           // Container for data pertaining to generalized permutation tag check
     struct MemoryCheckData;        // Container for data pertaining to RAM/RAM record check
+    struct FailureData;            // Container for the first failing gate found
+    struct RowRange;               // A range of rows of a block, to be checked as a unit of work
+    struct BlockRelations;         // The relations that can fail in a given block
     using Key = std::array<FF, 4>; // Key type for lookup table hash table
     struct HashFunction;           // Custom hash function for lookup table hash table
-    using LookupHashTable = std::unordered_set<Key, HashFunction>;
+    class LookupHashTable;         // Hash table of all lookup table entries, as shards that are built in parallel
 
     /**
-     * @brief Checks that the provided witness satisfies all gates contained in a single execution trace block
+     * @brief Checks that the provided witness satisfies all gates contained in a range of rows of an execution trace
+     * block, and records the occurrences of tagged variables in these rows
      *
      * @tparam Builder
      * @param builder
      * @param block
+     * @param relations The relations to check in the block
+     * @param range
      * @param tag_data
      * @param memory_data
      * @param lookup_hash_table
+     * @param failure Updated if a gate fails before the first failing gate found so far
      */
     template <typename Builder>
-    static bool check_block(Builder& builder,
-                            auto& block,
-                            TagCheckData& tag_data,
-                            MemoryCheckData& memory_data,
-                            LookupHashTable& lookup_hash_table);
+    static void check_rows(Builder& builder,
+                           auto& block,
+                           const BlockRelations& relations,
+                           const RowRange& range,
+                           TagCheckData& tag_data,
+                           const MemoryCheckData& memory_data,
+                           const LookupHashTable& lookup_hash_table,
+                           FailureData& failure);
+
+    /**
+     * @brief Determine which of the relations have a non-zero selector in some row of a block
+     */
+    template <typename Builder> static BlockRelations get_block_relations(auto& block);
 
     /**
      * @brief Check that a given relation is satisfied for the provided inputs corresponding to a single row
@@ -92,12 +123,22 @@ class UltraCircuitChecker {
     template <typename Builder> static bool check_databus_read(auto& values, Builder& builder);
 
     /**
-     * @brief Check whether the left and right running tag products are equal
+     * @brief Check whether the products of (value + γ ⋅ tag) and (value + γ ⋅ tau[tag]) over the tagged variables
+     * are equal
+     * @details Each tagged variable contributes once, with its value at its first occurrence in the trace. The products
+     * are computed as a parallel reduction over the variables.
      * @note By construction, this is in general only true after the last gate has been processed
      *
+     * @param builder
      * @param tag_data
+     * @param memory_data
+     * @param block_offsets The row of the trace at which each block starts
      */
-    static bool check_tag_data(const TagCheckData& tag_data);
+    template <typename Builder>
+    static bool check_tag_data(Builder& builder,
+                               const TagCheckData& tag_data,
+                               const MemoryCheckData& memory_data,
+                               const std::vector<size_t>& block_offsets);
 
     /**
      * @brief Helper for initializing an empty AllValues container of the right Flavor based on Builder
@@ -111,29 +152,98 @@ class UltraCircuitChecker {
 
     /**
      * @brief Populate the values required to check the correctness of a single "row" of the circuit
-     * @details Populates all wire values (plus shifts) and selectors. Updates running tag product information.
-     * Populates 4th wire with memory records (as needed).
+     * @details Populates all wire values (plus shifts) and selectors. Populates 4th wire with memory records (as
+     * needed).
      *
      * @tparam Builder
      * @param builder
      * @param values
-     * @param tag_data
+     * @param memory_data
      * @param idx
      */
     template <typename Builder>
     static void populate_values(
-        Builder& builder, auto& block, auto& values, TagCheckData& tag_data, MemoryCheckData& memory_data, size_t idx);
+        Builder& builder, auto& block, auto& values, const MemoryCheckData& memory_data, size_t idx);
+
+    /**
+     * @brief Get the value of the 4th wire of a row, which is a memory record for RAM/ROM read and write gates
+     */
+    template <typename Builder>
+    static FF get_w_4_value(Builder& builder, auto& block, const MemoryCheckData& memory_data, size_t idx);
+
+    /**
+     * @brief Record the positions in the trace of the tagged variables in the wires of a row
+     */
+    template <typename Builder>
+    static void update_tag_check_data(Builder& builder, auto& block, TagCheckData& tag_data, size_t idx, size_t row);
 
     /**
-     * @brief Struct for managing the running tag product data for ensuring tag correctness
+     * @brief Struct for managing the data for ensuring tag correctness
+     * @details Each tagged variable contributes to the tag products once, with its value at its first occurrence in
+     * the trace, so the rows record the position (row * NUM_WIRES + wire) of the occurrences of each tagged variable
+     * and only the first one is kept.
      */
     struct TagCheckData {
-        FF left_product = FF::one();           // product of (value + γ ⋅ tag)
-        FF right_product = FF::one();          // product of (value + γ ⋅ tau[tag])
+        static constexpr uint64_t NOT_ENCOUNTERED = std::numeric_limits<uint64_t>::max();
         const FF gamma = FF::random_element(); // randomness for the tag check
 
-        // We need to include each variable only once
-        std::unordered_set<size_t> encountered_variables;
+        // The position of the first occurrence of each real variable, if it is tagged
+        std::vector<std::atomic<uint64_t>> first_occurrences;
+
+        TagCheckData(const auto& builder)
+            : first_occurrences(builder.get_num_variables())
+        {
+            parallel_for_range(
+                first_occurrences.size(), [&](size_t i) { first_occurrences[i].store(NOT_ENCOUNTERED); }, 1 << 14);
+        }
+    };
+
+    /**
+     * @brief Struct for managing the first failing gate found by the checks of concurrent row ranges
+     * @details Once a gate fails, the ranges that could only find a later failure are skipped.
+     */
+    struct FailureData {
+        static constexpr uint64_t NO_FAILURE = std::numeric_limits<uint64_t>::max();
+        std::atomic<uint64_t> first_failed_row = NO_FAILURE; // row of the first failing gate in the trace
+        std::string message;
+        size_t block_idx = 0;
+        size_t block_row_idx = 0;
+#ifndef NO_MULTITHREADING
+        std::mutex mutex;
+#endif
+
+        bool is_preceded_by_failure(size_t row) const { return first_failed_row.load(std::memory_order_relaxed) < row; }
+
+        void record(const char* failure_message, size_t block, size_t block_row, size_t row)
+        {
+#ifndef NO_MULTITHREADING
+            std::unique_lock<std::mutex> lock(mutex);
+#endif
+            if (row < first_failed_row.load()) {
+                message = failure_message;
+                block_idx = block;
+                block_row_idx = block_row;
+                first_failed_row.store(row);
+            }
+        }
+    };
+
+    struct RowRange {
+        size_t block_idx;
+        size_t start;  // first row in the block
+        size_t end;    // row past the last one in the block
+        size_t offset; // row of the trace at which the block starts
+    };
+
+    struct BlockRelations {
+        bool arithmetic = false;
+        bool elliptic = false;
+        bool auxiliary = false;
+        bool delta_range = false;
+        bool lookup = false;
+        bool poseidon_internal = false;
+        bool poseidon_external = false;
+        bool databus = false;
     };
 
     /**
@@ -171,6 +281,63 @@ class UltraCircuitChecker {
             return static_cast<size_t>(result.reduce_once().data[0]);
         }
     };
+
+    /**
+     * @brief Hash table of the entries of all lookup tables of a circuit
+     * @details The entries are split into shards by their hash, and each shard is built by its own thread.
+     */
+    class LookupHashTable {
+      public:
+        static constexpr size_t NUM_SHARDS = 64;
+
+        LookupHashTable(const auto& builder)
+            : shards(NUM_SHARDS)
+        {
+            // The index in the concatenation of all tables of the first entry of each table
+            std::vector<size_t> table_offsets;
+            size_t num_entries = 0;
+            for (const auto& table : builder.lookup_tables) {
+                table_offsets.push_back(num_entries);
+                num_entries += table.size();
+            }
+
+            // Compute the shard of each entry, then insert the entries of each shard
+            std::vector<uint8_t> entry_shards(num_entries);
+            parallel_for_range(builder.lookup_tables.size(), [&](size_t table_idx) {
+                const auto& table = builder.lookup_tables[table_idx];
+                const FF table_index(table.table_index);
+                for (size_t i = 0; i < table.size(); ++i) {
+                    entry_shards[table_offsets[table_idx] + i] = get_shard(
+                        hash_function({ table.column_1[i], table.column_2[i], table.column_3[i], table_index }));
+                }
+            });
+            parallel_for_range(NUM_SHARDS, [&](size_t shard) {
+                for (size_t table_idx = 0; table_idx < builder.lookup_tables.size(); ++table_idx) {
+                    const auto& table = builder.lookup_tables[table_idx];
+                    const FF table_index(table.table_index);
+                    const uint8_t* shards_of_table = &entry_shards[table_offsets[table_idx]];
+                    for (size_t i = 0; i < table.size(); ++i) {
+                        if (shards_of_table[i] == shard) {
+                            shards[shard].insert(
+                                { table.column_1[i], table.column_2[i], table.column_3[i], table_index });
+                        }
+                    }
+                }
+            });
+        }
+
+        bool contains(const Key& key) const { return shards[get_shard(hash_function(key))].contains(key); }
+
+      private:
+        HashFunction hash_function;
+        std::vector<std::unordered_set<Key, HashFunction>> shards;
+
+        // The buckets of a shard are chosen by the low bits of the hash, so the shards are chosen by the high ones
+        static uint8_t get_shard(size_t hash)
+        {
+            return static_cast<uint8_t>((hash >> (8 * sizeof(size_t) - 8)) % NUM_SHARDS);
+        }
+    };
 };
 
 } // namespace bb
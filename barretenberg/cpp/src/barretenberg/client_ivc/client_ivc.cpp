@@ -14,6 +14,64 @@ namespace bb {
  */
 void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<VerificationKey>& precomputed_vk)
 {
+    complete_circuit(circuit);
+
+    // Construct the prover instance for circuit
+    auto instance = std::make_shared<ProverInstance>();
+    instance->construct_from_finalized_circuit(circuit, structured_flag);
+
+    fold_instance(instance, precomputed_vk);
+}
+
+/**
+ * @brief Accumulate a circuit into the IVC scheme as in accumulate, but construct and fold its instance in the
+ * background
+ * @details The recursive verifiers and the merge proof are added to the circuit before returning, as they depend on
+ * the previous accumulation and extend the op queue. The construction of the instance, the computation of its VK and
+ * the folding then run as a task on the scheduler (common/task_scheduler.hpp), while the caller constructs the next
+ * circuit. Since the next circuit has to verify the fold proof of this one, the pipeline is one circuit deep: this
+ * method first waits for the previous accumulation, running its tasks in the meantime. So in addition to the
+ * accumulator, at most one instance is resident at a time, and the memory of the circuit is released as soon as its
+ * instance is constructed.
+ *
+ * Accumulation results (e.g. fold_output, instance_vk) must only be read after wait_for_accumulation, which the
+ * other methods of the scheme call.
+ *
+ * @param circuit Circuit to be accumulated/folded, which must not be modified by the caller afterwards
+ * @param precomputed_vk Optional precomputed VK (otherwise will be computed in the background)
+ */
+void ClientIVC::accumulate_async(std::shared_ptr<ClientCircuit> circuit,
+                                 std::shared_ptr<VerificationKey> precomputed_vk)
+{
+    complete_circuit(*circuit);
+
+    pending_accumulation->run(
+        [this, circuit = std::move(circuit), precomputed_vk = std::move(precomputed_vk)]() mutable {
+            auto instance = std::make_shared<ProverInstance>();
+            instance->construct_from_finalized_circuit(*circuit, structured_flag);
+            circuit.reset();
+
+            fold_instance(instance, precomputed_vk);
+        });
+}
+
+/**
+ * @brief Wait for the accumulation started by accumulate_async (if any) to complete, rethrowing its exception if it
+ * failed
+ */
+void ClientIVC::wait_for_accumulation()
+{
+    pending_accumulation->wait();
+}
+
+/**
+ * @brief Add the recursive verifiers of the previous fold and merge proofs to the circuit, construct its merge proof
+ * and finalize it, i.e. everything up to the construction of its instance
+ */
+void ClientIVC::complete_circuit(ClientCircuit& circuit)
+{
+    wait_for_accumulation();
+
     // If a previous fold proof exists, add a recursive folding verification to the circuit
     if (!fold_output.proof.empty()) {
         BB_OP_COUNT_TIME_NAME("construct_circuits");
@@ -25,8 +83,19 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
     // Construct a merge proof (and add a recursive merge verifier to the circuit if a previous merge proof exists)
     goblin.merge(circuit);
 
-    // Construct the prover instance for circuit
-    prover_instance = std::make_shared<ProverInstance>(circuit, structured_flag);
+    ProverInstance::finalize_circuit(circuit, structured_flag);
+}
+
+/**
+ * @brief Fold the instance into the accumulator, or initialize the accumulators with it if it is the first one
+ *
+ * @note The VK is computed before folding rather than concurrently, since the folding prover replaces the proving key
+ * of the instance that the VK is computed from.
+ */
+void ClientIVC::fold_instance(const std::shared_ptr<ProverInstance>& instance,
+                              const std::shared_ptr<VerificationKey>& precomputed_vk)
+{
+    prover_instance = instance;
 
     // Set the instance verification key from precomputed if available, else compute it
     if (precomputed_vk) {
@@ -53,6 +122,7 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
  */
 ClientIVC::Proof ClientIVC::prove()
 {
+    wait_for_accumulation();
     return { fold_output.proof, decider_prove(), goblin.prove() };
 }
 
@@ -112,6 +182,8 @@ std::vector<std::shared_ptr<ClientIVC::VerificationKey>> ClientIVC::precompute_f
         vkeys.emplace_back(instance_vk);
     }
 
+    wait_for_accumulation();
+
     // Reset the scheme so it can be reused for actual accumulation, maintaining the structured trace flag as is
     bool structured = structured_flag;
     *this = ClientIVC();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/goblin/goblin.hpp"
 #include "barretenberg/goblin/mock_circuits.hpp"
 #include "barretenberg/protogalaxy/decider_verifier.hpp"
@@ -72,6 +73,11 @@ class ClientIVC {
 
     void accumulate(ClientCircuit& circuit, const std::shared_ptr<VerificationKey>& precomputed_vk = nullptr);
 
+    void accumulate_async(std::shared_ptr<ClientCircuit> circuit,
+                          std::shared_ptr<VerificationKey> precomputed_vk = nullptr);
+
+    void wait_for_accumulation();
+
     Proof prove();
 
     bool verify(Proof& proof, const std::vector<std::shared_ptr<VerifierInstance>>& verifier_instances);
@@ -81,5 +87,14 @@ class ClientIVC {
     HonkProof decider_prove() const;
 
     std::vector<std::shared_ptr<VerificationKey>> precompute_folding_verification_keys(std::vector<ClientCircuit>);
+
+  private:
+    // The construction and folding of the instance of the last circuit passed to accumulate_async, if still running
+    std::unique_ptr<TaskGroup> pending_accumulation = std::make_unique<TaskGroup>();
+
+    void complete_circuit(ClientCircuit& circuit);
+
+    void fold_instance(const std::shared_ptr<ProverInstance>& instance,
+                       const std::shared_ptr<VerificationKey>& precomputed_vk);
 };
 } // namespace bb
\ No newline at end of file
@@ -213,3 +213,44 @@ TEST_F(ClientIVCTests, StructuredPrecomputedVKs)
 
     EXPECT_TRUE(prove_and_verify(ivc));
 };
+
+/**
+ * @brief Accumulate circuits asynchronously, constructing each circuit while the previous one is being folded
+ *
+ */
+TEST_F(ClientIVCTests, AsyncAccumulation)
+{
+    ClientIVC ivc;
+
+    size_t NUM_CIRCUITS = 4;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        ivc.accumulate_async(std::make_shared<Builder>(create_mock_circuit(ivc)));
+    }
+
+    EXPECT_TRUE(prove_and_verify(ivc));
+};
+
+/**
+ * @brief Check that an invalid fold proof is caught when accumulating asynchronously, as with accumulate
+ *
+ */
+TEST_F(ClientIVCTests, AsyncAccumulationFailure)
+{
+    ClientIVC ivc;
+
+    ivc.accumulate_async(std::make_shared<Builder>(create_mock_circuit(ivc)));
+    ivc.accumulate_async(std::make_shared<Builder>(create_mock_circuit(ivc)));
+
+    // Tamper with the fold proof once it has been constructed
+    ivc.wait_for_accumulation();
+    for (auto& val : ivc.fold_output.proof) {
+        if (val > 0) {
+            val += 1;
+            break;
+        }
+    }
+
+    ivc.accumulate_async(std::make_shared<Builder>(create_mock_circuit(ivc)));
+
+    EXPECT_FALSE(prove_and_verify(ivc));
+};
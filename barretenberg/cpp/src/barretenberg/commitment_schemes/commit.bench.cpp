@@ -25,7 +25,115 @@ template <typename Curve> void bench_commit(::benchmark::State& state)
     }
 }
 
+template <typename Curve> Polynomial<typename Curve::ScalarField> random_polynomial(const size_t num_points)
+{
+    Polynomial<typename Curve::ScalarField> polynomial(num_points);
+    for (auto& coefficient : polynomial) {
+        coefficient = Curve::ScalarField::random_element();
+    }
+    return polynomial;
+}
+
+template <typename Curve> void bench_commit_random(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomial = random_polynomial<Curve>(num_points);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->commit(polynomial));
+    }
+}
+
+// Commits with a key whose fixed-base tables hold state.range(1) copies of the pippenger point table.
+template <typename Curve> void bench_commit_fixed_base(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    const auto num_tables = static_cast<size_t>(state.range(1));
+    auto fixed_base_key = create_commitment_key<Curve>(num_points);
+    fixed_base_key->enable_fixed_base_msm(num_tables * 2 * num_points * sizeof(typename Curve::AffineElement));
+    const auto polynomial = random_polynomial<Curve>(num_points);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fixed_base_key->commit(polynomial));
+    }
+}
+
+// Commits to a polynomial with one nonzero coefficient in every state.range(1), half of them ones (as in a selector or
+// a structured trace), with commit and with commit_sparse.
+template <typename Curve> Polynomial<typename Curve::ScalarField> sparse_polynomial(const size_t num_points,
+                                                                                   const size_t period)
+{
+    Polynomial<typename Curve::ScalarField> polynomial(num_points);
+    for (size_t i = 0; i < num_points; i += period) {
+        polynomial[i] = (i / period) % 2 == 0 ? Curve::ScalarField::one() : Curve::ScalarField::random_element();
+    }
+    return polynomial;
+}
+
+template <typename Curve> void bench_commit_sparse_dense_path(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomial = sparse_polynomial<Curve>(num_points, static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->commit(polynomial));
+    }
+}
+
+template <typename Curve> void bench_commit_sparse(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomial = sparse_polynomial<Curve>(num_points, static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->commit_sparse(polynomial));
+    }
+}
+
+// Commits to a round of state.range(1) random polynomials of size 2^state.range(0), one at a time or as a batch.
+template <typename Curve> void bench_commit_round(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<typename Curve::ScalarField>> polynomials;
+    for (int64_t i = 0; i < state.range(1); ++i) {
+        polynomials.push_back(random_polynomial<Curve>(num_points));
+    }
+    for (auto _ : state) {
+        for (const auto& polynomial : polynomials) {
+            benchmark::DoNotOptimize(key->commit(polynomial));
+        }
+    }
+}
+
+template <typename Curve> void bench_commit_round_batch(::benchmark::State& state)
+{
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<typename Curve::ScalarField>> polynomials;
+    for (int64_t i = 0; i < state.range(1); ++i) {
+        polynomials.push_back(random_polynomial<Curve>(num_points));
+    }
+    const std::vector<std::span<const typename Curve::ScalarField>> spans(polynomials.begin(), polynomials.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->commit_batch(spans));
+    }
+}
+
 BENCHMARK(bench_commit<curve::BN254>)->DenseRange(10, MAX_LOG_NUM_POINTS)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_random<curve::BN254>)->DenseRange(16, 22, 2)->Unit(benchmark::kMillisecond);
+// 8 tables of 2^22 points would take 4GB
+BENCHMARK(bench_commit_fixed_base<curve::BN254>)
+    ->ArgsProduct({ benchmark::CreateDenseRange(16, 20, 2), { 2, 4, 8 } })
+    ->Args({ 22, 2 })
+    ->Args({ 22, 4 })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_round<curve::BN254>)
+    ->ArgsProduct({ { 12, 16, 20 }, { 8, 20 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_round_batch<curve::BN254>)
+    ->ArgsProduct({ { 12, 16, 20 }, { 8, 20 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sparse_dense_path<curve::BN254>)
+    ->ArgsProduct({ { 16, 20 }, { 2, 16, 256 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sparse<curve::BN254>)
+    ->ArgsProduct({ { 16, 20 }, { 2, 16, 256 } })
+    ->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
@@ -8,17 +8,23 @@
  */
 
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/ref_span.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/batch_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
-#include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -34,11 +40,14 @@ template <class Curve> class CommitmentKey {
 
     using Fr = typename Curve::ScalarField;
     using Commitment = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
 
   public:
     scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
+    // Optional precomputed tables for committing against the (fixed) srs points, see `enable_fixed_base_msm`
+    std::shared_ptr<scalar_multiplication::FixedBaseMsm<Curve>> fixed_base_msm;
 
     CommitmentKey() = delete;
 
@@ -72,9 +81,202 @@ template <class Curve> class CommitmentKey {
         BB_OP_COUNT_TIME();
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
+        if (fixed_base_msm && fixed_base_msm->is_effective(degree)) {
+            return fixed_base_msm->multiply(polynomial.data(), degree);
+        }
         return scalar_multiplication::pippenger_unsafe<Curve>(
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
+
+    /**
+     * @brief Commits to p(X) through its window of coefficients only, the others being zero (see Polynomial)
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit(const Polynomial<Fr>& polynomial)
+    {
+        ASSERT(polynomial.size() <= srs->get_monomial_size());
+        const size_t start = polynomial.start_index();
+        if (start == 0) {
+            return commit(polynomial.coeffs());
+        }
+        BB_OP_COUNT_TIME();
+        const auto coeffs = polynomial.coeffs();
+        if (coeffs.empty()) {
+            return Commitment::infinity();
+        }
+        // The pippenger point table holds two points (the point and its endomorphism) per coefficient
+        return scalar_multiplication::pippenger_unsafe<Curve>(const_cast<Fr*>(coeffs.data()),
+                                                              srs->get_monomial_points() + 2 * start,
+                                                              coeffs.size(),
+                                                              pippenger_runtime_state);
+    };
+
+    /**
+     * @brief Commits to a polynomial whose coefficients are mostly zero or one, e.g. a selector, a databus column or
+     * a structured trace column that is mostly padding.
+     *
+     * @details The support of the polynomial is found in one parallel pass. Points whose coefficient is one are summed
+     * directly, and only the remaining nonzero coefficients (and their points) are gathered into a pippenger MSM, so
+     * the cost is proportional to the density of the polynomial rather than to its size. Dense polynomials are
+     * committed with `commit`.
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit_sparse(std::span<const Fr> polynomial) { return commit_sparse(polynomial, 0); }
+
+    /**
+     * @brief Commits to a polynomial whose coefficients are mostly zero or one, scanning its window only.
+     */
+    Commitment commit_sparse(const Polynomial<Fr>& polynomial)
+    {
+        ASSERT(polynomial.size() <= srs->get_monomial_size());
+        return commit_sparse(polynomial.coeffs(), polynomial.start_index());
+    }
+
+    /**
+     * @brief Commits to several polynomials at once, sharing pippenger's thread dispatch and batched affine additions
+     * between the MSMs (see `pippenger_batch_unsafe`). Prefer this over a sequence of `commit` calls in a prover round.
+     *
+     * @param polynomials univariate polynomials pₖ(X) = ∑ᵢ aₖᵢ⋅Xⁱ
+     * @return Commitments Cₖ = [pₖ(x)] = ∑ᵢ aₖᵢ⋅Gᵢ
+     */
+    std::vector<Commitment> commit_batch(std::span<const std::span<const Fr>> polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        std::vector<Element> results(polynomials.size());
+        std::vector<std::span<const Fr>> batch;
+        std::vector<size_t> batch_indices;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            ASSERT(polynomials[i].size() <= srs->get_monomial_size());
+            if (fixed_base_msm && fixed_base_msm->is_effective(polynomials[i].size())) {
+                results[i] = fixed_base_msm->multiply(polynomials[i].data(), polynomials[i].size());
+            } else {
+                batch.push_back(polynomials[i]);
+                batch_indices.push_back(i);
+            }
+        }
+        auto batch_results = scalar_multiplication::pippenger_batch_unsafe<Curve>(batch, srs->get_monomial_points());
+        for (size_t j = 0; j < batch_indices.size(); ++j) {
+            results[batch_indices[j]] = batch_results[j];
+        }
+        return std::vector<Commitment>(results.begin(), results.end());
+    }
+
+    /**
+     * @brief Commits to several polynomials at once, through their windows of coefficients only. Those whose window
+     * starts at zero share a batch, the others are committed to one by one.
+     *
+     * @param polynomials univariate polynomials pₖ(X) = ∑ᵢ aₖᵢ⋅Xⁱ
+     * @return Commitments Cₖ = [pₖ(x)] = ∑ᵢ aₖᵢ⋅Gᵢ
+     */
+    std::vector<Commitment> commit_batch(RefSpan<Polynomial<Fr>> polynomials)
+    {
+        std::vector<Commitment> results(polynomials.size());
+        std::vector<std::span<const Fr>> batch;
+        std::vector<size_t> batch_indices;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            ASSERT(polynomials[i].size() <= srs->get_monomial_size());
+            if (polynomials[i].start_index() == 0) {
+                batch.push_back(polynomials[i].coeffs());
+                batch_indices.push_back(i);
+            } else {
+                results[i] = commit(polynomials[i]);
+            }
+        }
+        auto batch_results = commit_batch(batch);
+        for (size_t j = 0; j < batch_indices.size(); ++j) {
+            results[batch_indices[j]] = batch_results[j];
+        }
+        return results;
+    }
+
+    /**
+     * @brief Precomputes shifted copies of the srs points, so that `commit` can use the fixed-base MSM engine
+     * whenever it is expected to beat pippenger.
+     *
+     * @details Trades memory for speed: the more copies fit in the budget, the fewer bucket accumulation passes each
+     * commitment needs (see scalar_multiplication::FixedBaseMsm). A budget that does not fit at least two copies of
+     * the pippenger point table leaves the key unchanged.
+     *
+     * @param memory_budget Maximum size in bytes of the precomputed tables.
+     */
+    void enable_fixed_base_msm(const size_t memory_budget)
+    {
+        const size_t num_points = std::min(srs->get_monomial_size(), pippenger_runtime_state.num_points / 2);
+        if (scalar_multiplication::FixedBaseMsm<Curve>::get_max_num_shifts(num_points, memory_budget) < 2) {
+            fixed_base_msm = nullptr;
+            return;
+        }
+        fixed_base_msm = std::make_shared<scalar_multiplication::FixedBaseMsm<Curve>>(
+            srs->get_monomial_points(), num_points, memory_budget);
+    }
+
+  private:
+    // Commits to the polynomial whose coefficients from `start_index` on are `polynomial`, see `commit_sparse`
+    Commitment commit_sparse(std::span<const Fr> polynomial, const size_t start_index)
+    {
+        BB_OP_COUNT_TIME();
+        const size_t degree = polynomial.size();
+        ASSERT(start_index + degree <= srs->get_monomial_size());
+        Commitment* point_table = srs->get_monomial_points() + 2 * start_index;
+
+        // Sum the points with unit coefficients and record the indices of the other nonzero coefficients
+        const size_t num_threads = calculate_num_threads(degree);
+        std::vector<std::vector<size_t>> thread_support(num_threads);
+        std::vector<Element> thread_unit_sums(num_threads);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = (thread_idx * degree) / num_threads;
+            const size_t end = ((thread_idx + 1) * degree) / num_threads;
+            thread_unit_sums[thread_idx].self_set_infinity();
+            for (size_t i = start; i < end; ++i) {
+                if (polynomial[i].is_zero()) {
+                    continue;
+                }
+                if (polynomial[i] == Fr::one()) {
+                    thread_unit_sums[thread_idx] += point_table[2 * i];
+                } else {
+                    thread_support[thread_idx].push_back(i);
+                }
+            }
+        });
+
+        std::vector<size_t> thread_offsets(num_threads + 1, 0);
+        Element unit_sum;
+        unit_sum.self_set_infinity();
+        for (size_t i = 0; i < num_threads; ++i) {
+            thread_offsets[i + 1] = thread_offsets[i] + thread_support[i].size();
+            unit_sum += thread_unit_sums[i];
+        }
+        const size_t num_nonzero = thread_offsets[num_threads];
+        // If most coefficients need the MSM anyway, gathering them is not worth the copy.
+        if (2 * num_nonzero > degree) {
+            if (start_index == 0) {
+                return commit(polynomial);
+            }
+            return scalar_multiplication::pippenger_unsafe<Curve>(
+                const_cast<Fr*>(polynomial.data()), point_table, degree, pippenger_runtime_state);
+        }
+
+        // Gather the remaining scalars and their (pippenger point table) points
+        std::vector<Fr> scalars(num_nonzero);
+        auto points = scalar_multiplication::point_table_alloc<Commitment>(num_nonzero);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            Commitment* thread_points = points.get() + 2 * thread_offsets[thread_idx];
+            for (size_t j = 0; j < thread_support[thread_idx].size(); ++j) {
+                const size_t i = thread_support[thread_idx][j];
+                scalars[thread_offsets[thread_idx] + j] = polynomial[i];
+                thread_points[2 * j] = point_table[2 * i];
+                thread_points[2 * j + 1] = point_table[2 * i + 1];
+            }
+        });
+
+        Element result = scalar_multiplication::pippenger_unsafe<Curve>(
+            scalars.data(), points.get(), num_nonzero, pippenger_runtime_state);
+        return result + unit_sum;
+    }
 };
 
 } // namespace bb
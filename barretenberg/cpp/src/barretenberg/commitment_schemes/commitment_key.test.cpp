@@ -0,0 +1,95 @@
+#include "commitment_key.test.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+
+namespace bb {
+
+template <class Curve> class CommitmentKeyTest : public CommitmentTest<Curve> {
+  public:
+    using Fr = typename Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    // A polynomial with roughly 1 in `period` nonzero coefficients, alternating between one and a random value
+    Polynomial sparse_polynomial(const size_t n, const size_t period)
+    {
+        Polynomial p(n);
+        for (size_t i = 0; i < n; i += period) {
+            p[i] = (i / period) % 2 == 0 ? Fr::one() : this->random_element();
+        }
+        return p;
+    }
+};
+
+using CommitmentKeyTestParams = ::testing::Types<curve::BN254, curve::Grumpkin>;
+TYPED_TEST_SUITE(CommitmentKeyTest, CommitmentKeyTestParams);
+
+TYPED_TEST(CommitmentKeyTest, CommitSparseMatchesCommit)
+{
+    const size_t n = COMMITMENT_TEST_NUM_POINTS;
+    for (size_t period : std::array<size_t, 5>{ 1, 2, 3, 17, 1000 }) {
+        auto polynomial = this->sparse_polynomial(n, period);
+        EXPECT_EQ(this->ck()->commit_sparse(polynomial), this->commit(polynomial));
+    }
+}
+
+TYPED_TEST(CommitmentKeyTest, CommitSparseSelector)
+{
+    using Fr = typename TypeParam::ScalarField;
+    const size_t n = COMMITMENT_TEST_NUM_POINTS;
+    typename TestFixture::Polynomial selector(n);
+    for (size_t i = n / 4; i < n / 2; ++i) {
+        selector[i] = Fr::one();
+    }
+    EXPECT_EQ(this->ck()->commit_sparse(selector), this->commit(selector));
+}
+
+TYPED_TEST(CommitmentKeyTest, CommitSparseDense)
+{
+    auto polynomial = this->random_polynomial(COMMITMENT_TEST_NUM_POINTS);
+    EXPECT_EQ(this->ck()->commit_sparse(polynomial), this->commit(polynomial));
+}
+
+TYPED_TEST(CommitmentKeyTest, CommitSparseZero)
+{
+    typename TestFixture::Polynomial zero(COMMITMENT_TEST_NUM_POINTS);
+    EXPECT_TRUE(this->ck()->commit_sparse(zero).is_point_at_infinity());
+}
+
+// A polynomial that only stores a window of its coefficients commits to the same point as the dense one
+TYPED_TEST(CommitmentKeyTest, CommitWindowedPolynomial)
+{
+    using Polynomial = typename TestFixture::Polynomial;
+    const size_t n = COMMITMENT_TEST_NUM_POINTS;
+    Polynomial windowed(n, 100, 300);
+    Polynomial dense(n);
+    for (size_t i = 100; i < 300; ++i) {
+        windowed[i] = i % 2 == 0 ? this->random_element() : 1;
+        dense[i] = windowed[i];
+    }
+    const auto expected = this->ck()->commit(std::span(dense));
+    EXPECT_EQ(this->ck()->commit(windowed), expected);
+    EXPECT_EQ(this->ck()->commit_sparse(windowed), expected);
+    EXPECT_EQ(this->ck()->commit_batch(RefArray{ windowed, dense }), (std::vector{ expected, expected }));
+
+    EXPECT_TRUE(this->ck()->commit(Polynomial(n, 100, 100)).is_point_at_infinity());
+}
+
+TYPED_TEST(CommitmentKeyTest, CommitBatchMatchesCommit)
+{
+    using Fr = typename TypeParam::ScalarField;
+    std::vector<typename TestFixture::Polynomial> polynomials;
+    for (size_t n : std::array<size_t, 6>{ COMMITMENT_TEST_NUM_POINTS, 1, 0, 100, 1000, COMMITMENT_TEST_NUM_POINTS }) {
+        polynomials.push_back(this->random_polynomial(n));
+    }
+    polynomials.push_back(this->sparse_polynomial(COMMITMENT_TEST_NUM_POINTS, 17));
+
+    auto commitments =
+        this->ck()->commit_batch(std::vector<std::span<const Fr>>(polynomials.begin(), polynomials.end()));
+    ASSERT_EQ(commitments.size(), polynomials.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        EXPECT_EQ(commitments[i], this->commit(polynomials[i]));
+    }
+}
+
+} // namespace bb
@@ -82,6 +82,20 @@ template <typename Curve_> class IPA {
    using Polynomial = bb::Polynomial<Fr>;
    using VerifierAccumulator = bool;
 
+   /**
+    * @brief An IPA proof that has been verified up to its final check, ⟨a₀⋅s, G⟩ = C₀ - a₀⋅b₀⋅U (see
+    * reduce_verify_internal), which requires an MSM over the SRS. Deferred openings of many proofs can be checked
+    * together, with a single MSM, by verify_deferred.
+    */
+   struct DeferredOpening {
+       // The inverses of the round challenges u_j, from which the vector s is computed
+       std::vector<Fr> round_challenges_inv;
+       // The final coefficient a₀ received from the prover
+       Fr a_zero;
+       // C₀ - a₀⋅b₀⋅U, which ⟨a₀⋅s, G⟩ must equal
+       GroupElement expected_msm;
+   };
+
 // These allow access to internal functions so that we can never use a mock transcript unless it's fuzzing or testing of IPA specifically
 #ifdef IPA_TEST
    FRIEND_TEST(IPATest, ChallengesAreZero);
@@ -332,11 +346,29 @@ template <typename Curve_> class IPA {
      *9. Receive \f$\vec{a}_{0}\f$ of length 1
      *10. Compute \f$C_{right}=a_{0}G_{s}+a_{0}b_{0}U\f$
      *11. Check that \f$C_{right} = C_0\f$. If they match, return true. Otherwise return false.
+     *
+     * Steps 1 to 6 and 9 are done by reduce_verify_deferred, and the others, which involve the MSM over the SRS, by
+     * verify_deferred.
      */
     static VerifierAccumulator reduce_verify_internal(const std::shared_ptr<VK>& vk,
                                                       const OpeningClaim<Curve>& opening_claim,
                                                       auto& transcript)
         requires(!Curve::is_stdlib_type)
+    {
+        const DeferredOpening opening = reduce_verify_deferred(vk, opening_claim, transcript);
+        return verify_deferred(vk, std::span<const DeferredOpening>(&opening, 1));
+    }
+
+    /**
+     * @brief Natively verify a proof, except for the MSM over the SRS, which is returned as a DeferredOpening
+     *
+     * @details Costs O(log n) group operations. The opening is only known to be valid once it has been checked by
+     * verify_deferred, typically together with the openings of other proofs.
+     */
+    static DeferredOpening reduce_verify_deferred(const std::shared_ptr<VK>& vk,
+                                                  const OpeningClaim<Curve>& opening_claim,
+                                                  auto& transcript)
+        requires(!Curve::is_stdlib_type)
     {
         // Step 1.
         // Receive polynomial_degree + 1 = d from the prover
@@ -399,70 +431,88 @@ template <typename Curve_> class IPA {
                                    opening_claim.opening_pair.challenge.pow(1 << i));
         }
 
-        // Step 7.
-        // Construct vector s
-        std::vector<Fr> s_vec(poly_length);
-
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/857): This code is not efficient as its
-        // O(nlogn). This can be optimized to be linear by computing a tree of products. Its very readable, so we're
-        // leaving it unoptimized for now.
-        run_loop_in_parallel_if_effective(
-            poly_length,
-            [&s_vec, &round_challenges_inv, log_poly_degree](size_t start, size_t end) {
-                for (size_t i = start; i < end; i++) {
-                    Fr s_vec_scalar = Fr::one();
-                    for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
-                        auto bit = (i >> j) & 1;
-                        bool b = static_cast<bool>(bit);
-                        if (b) {
-                            s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
-                        }
-                    }
-                    s_vec[i] = s_vec_scalar;
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/log_poly_degree);
-
-        auto* srs_elements = vk->get_monomial_points();
-
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_length);
-
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        run_loop_in_parallel_if_effective(
-            poly_length,
-            [&G_vec_local, srs_elements](size_t start, size_t end) {
-                for (size_t i = start * 2; i < end * 2; i += 2) {
-                    G_vec_local[i >> 1] = srs_elements[i];
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/0,
-            /*finite_field_inversions_per_iteration=*/0,
-            /*group_element_additions_per_iteration=*/0,
-            /*group_element_doublings_per_iteration=*/0,
-            /*scalar_multiplications_per_iteration=*/0,
-            /*sequential_copy_ops_per_iteration=*/1);
-
-        // Step 8.
-        // Compute G₀
-        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_length, vk->pippenger_runtime_state);
-
         // Step 9.
         // Receive a₀ from the prover
         auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
 
-        // Step 10.
-        // Compute C_right
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+        // The remaining check is ⟨a₀⋅s, G⟩ = C₀ - a₀⋅b₀⋅U
+        return { .round_challenges_inv = std::move(round_challenges_inv),
+                 .a_zero = a_zero,
+                 .expected_msm = C_zero - aux_generator * (a_zero * b_zero) };
+    }
 
-        // Step 11.
-        // Check if C_right == C₀
-        return (C_zero.normalize() == right_hand_side.normalize());
+    /**
+     * @brief Compute the vector s of step 7, scaled by `scalar`
+     *
+     * @details Entry i is the product of the inverses selected by the bits of i, so the entries 2^j to 2^{j+1} - 1 are
+     * the first 2^j entries times the inverse selected by bit j. This takes n multiplications, instead of n log n.
+     */
+    static std::vector<Fr> compute_s_vector(std::span<const Fr> round_challenges_inv, const Fr& scalar)
+        requires(!Curve::is_stdlib_type)
+    {
+        const size_t log_poly_degree = round_challenges_inv.size();
+        std::vector<Fr> s_vec(size_t(1) << log_poly_degree);
+        s_vec[0] = scalar;
+        for (size_t j = 0; j < log_poly_degree; j++) {
+            const size_t half = size_t(1) << j;
+            const Fr& challenge_inv = round_challenges_inv[log_poly_degree - 1 - j];
+            run_loop_in_parallel_if_effective(
+                half,
+                [&s_vec, &challenge_inv, half](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        s_vec[half + i] = s_vec[i] * challenge_inv;
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/0,
+                /*finite_field_multiplications_per_iteration=*/1);
+        }
+        return s_vec;
+    }
+
+    /**
+     * @brief Check the deferred openings of any number of proofs with a single MSM over the SRS
+     *
+     * @details The checks ⟨a₀⋅s, G⟩ = C₀ - a₀⋅b₀⋅U of the openings are combined with random scalars rₖ (r₀ = 1) into
+     * ⟨∑ₖ rₖ⋅a₀ₖ⋅sₖ, G⟩ = ∑ₖ rₖ⋅(C₀ₖ - a₀ₖ⋅b₀ₖ⋅Uₖ), which fails with negligible probability if any of them does. Each
+     * opening adds O(n) field operations and one scalar multiplication to the cost of the shared MSM.
+     *
+     * @return true if all openings are valid (or there are none)
+     */
+    static bool verify_deferred(const std::shared_ptr<VK>& vk, std::span<const DeferredOpening> openings)
+        requires(!Curve::is_stdlib_type)
+    {
+        if (openings.empty()) {
+            return true;
+        }
+        size_t msm_size = 0;
+        for (const auto& opening : openings) {
+            msm_size = std::max(msm_size, size_t(1) << opening.round_challenges_inv.size());
+        }
+
+        std::vector<Fr> msm_scalars(msm_size, Fr::zero());
+        GroupElement expected_msm = GroupElement::infinity();
+        for (size_t k = 0; k < openings.size(); k++) {
+            const DeferredOpening& opening = openings[k];
+            // A single opening needs no randomization
+            const Fr batching_scalar = k == 0 ? Fr::one() : Fr::random_element();
+            const std::vector<Fr> s_vec =
+                compute_s_vector(opening.round_challenges_inv, batching_scalar * opening.a_zero);
+            run_loop_in_parallel_if_effective(
+                s_vec.size(),
+                [&msm_scalars, &s_vec](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        msm_scalars[i] += s_vec[i];
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/1);
+            expected_msm += opening.expected_msm * batching_scalar;
+        }
+
+        // The SRS stored in the verification key is the result after applying the pippenger point table, which is
+        // what pippenger expects.
+        GroupElement msm = bb::scalar_multiplication::pippenger<Curve>(
+            msm_scalars.data(), vk->get_monomial_points(), msm_size, vk->pippenger_runtime_state);
+        return msm.normalize() == expected_msm.normalize();
     }
     /**
      * @brief  Recursively verify the correctness of an IPA proof. Unlike native verification, there is no
@@ -629,6 +679,32 @@ template <typename Curve_> class IPA {
     {
         return reduce_verify_internal(vk, opening_claim, transcript);
     }
+
+    /**
+     * @brief Verify the proofs of several opening claims together, with a single MSM over the SRS
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims The claims, each containing a commitment C and an opening pair \f$(\beta, f(\beta))\f$
+     * @param transcripts The transcript of the proof of each claim
+     *
+     * @return true/false depending on if all the proofs verify
+     *
+     * @remark To check the proofs even later, or together with proofs that are only available later, keep the results
+     * of reduce_verify_deferred and check them with verify_deferred.
+     */
+    static bool batch_reduce_verify(const std::shared_ptr<VK>& vk,
+                                    std::span<const OpeningClaim<Curve>> opening_claims,
+                                    std::span<const std::shared_ptr<NativeTranscript>> transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        ASSERT(opening_claims.size() == transcripts.size());
+        std::vector<DeferredOpening> openings;
+        openings.reserve(opening_claims.size());
+        for (size_t i = 0; i < opening_claims.size(); i++) {
+            openings.push_back(reduce_verify_deferred(vk, opening_claims[i], transcripts[i]));
+        }
+        return verify_deferred(vk, openings);
+    }
 };
 
 } // namespace bb
\ No newline at end of file
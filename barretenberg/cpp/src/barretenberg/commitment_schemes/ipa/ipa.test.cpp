@@ -232,6 +232,62 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+// Proofs of polynomials of different sizes verify together, and a single invalid one fails the batch
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<std::shared_ptr<NativeTranscript>> proofs;
+    for (size_t n : { 2UL, 16UL, 128UL, 16UL }) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, this->commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+        proofs.push_back(prover_transcript);
+    }
+    const auto verify = [&](const std::vector<OpeningClaim<Curve>>& claims) {
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (const auto& proof : proofs) {
+            verifier_transcripts.push_back(std::make_shared<NativeTranscript>(proof->proof_data));
+        }
+        return IPA::batch_reduce_verify(this->vk(), claims, verifier_transcripts);
+    };
+
+    EXPECT_TRUE(verify(opening_claims));
+    EXPECT_TRUE(IPA::verify_deferred(this->vk(), {}));
+
+    for (size_t i = 0; i < opening_claims.size(); i++) {
+        auto claims = opening_claims;
+        claims[i].opening_pair.evaluation += Fr::one();
+        EXPECT_FALSE(verify(claims));
+    }
+}
+
+// Deferring the final check gives the same result as verifying a proof directly
+TEST_F(IPATest, DeferredVerifyMatchesReduceVerify)
+{
+    using IPA = IPA<Curve>;
+    const size_t n = 64;
+    auto poly = this->random_polynomial(n);
+    auto [x, eval] = this->random_eval(poly);
+    const OpeningPair<Curve> opening_pair = { x, eval };
+    const OpeningClaim<Curve> opening_claim{ opening_pair, this->commit(poly) };
+    auto prover_transcript = std::make_shared<NativeTranscript>();
+    IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+
+    auto verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+    const auto opening = IPA::reduce_verify_deferred(this->vk(), opening_claim, verifier_transcript);
+    EXPECT_EQ(opening.round_challenges_inv.size(), numeric::get_msb(n));
+    EXPECT_TRUE(IPA::verify_deferred(this->vk(), std::span(&opening, 1)));
+    EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
+
+    auto wrong_opening = opening;
+    wrong_opening.a_zero += Fr::one();
+    EXPECT_FALSE(IPA::verify_deferred(this->vk(), std::span(&wrong_opening, 1)));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -4,6 +4,7 @@
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/transcript/transcript.hpp"
@@ -28,6 +29,40 @@ template <class FF> inline std::vector<FF> powers_of_challenge(const FF challeng
     return challenge_powers;
 };
 
+/**
+ * @brief Add the linear combination ∑ᵢ scalarsᵢ⋅polynomialsᵢ to `result`, with polynomial i starting at index
+ * offsetsᵢ of the result (0 if no offsets are given)
+ * @details Runs in one parallel pass over the result, in which each chunk of the result is accumulated into from all of
+ * the polynomials while it is in cache. This replaces a pass over the result (and often a temporary polynomial) per
+ * term of the combination.
+ */
+template <class FF>
+inline void add_linear_combination(std::span<FF> result,
+                                   std::span<const std::span<const FF>> polynomials,
+                                   std::span<const FF> scalars,
+                                   std::span<const size_t> offsets = {})
+{
+    // Chunks of a few thousand coefficients stay in the L2 cache while they are accumulated into
+    constexpr size_t CHUNK_SIZE = size_t(1) << 12;
+    ASSERT(scalars.size() == polynomials.size());
+    ASSERT(offsets.empty() || offsets.size() == polynomials.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        ASSERT((offsets.empty() ? 0 : offsets[i]) + polynomials[i].size() <= result.size());
+    }
+    const size_t num_chunks = (result.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * CHUNK_SIZE;
+        const size_t end = std::min(start + CHUNK_SIZE, result.size());
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            const size_t offset = offsets.empty() ? 0 : offsets[i];
+            const size_t term_end = std::min(end, offset + polynomials[i].size());
+            for (size_t j = std::max(start, offset); j < term_end; ++j) {
+                result[j] += scalars[i] * polynomials[i][j - offset];
+            }
+        }
+    });
+}
+
 /**
  * @brief Prover for ZeroMorph multilinear PCS
  *
@@ -39,6 +74,9 @@ template <typename PCS> class ZeroMorphProver_ {
     using Commitment = typename Curve::AffineElement;
     using Polynomial = bb::Polynomial<FF>;
 
+    // Levels of the quotient computation smaller than this are computed on one thread
+    static constexpr size_t MIN_PARALLEL_QUOTIENT_SIZE = size_t(1) << 10;
+
     // TODO(#742): Set this N_max to be the number of G1 elements in the mocked zeromorph SRS once it's in place.
     // (Then, eventually, set it based on the real SRS). For now we set it to be larger then the Client IVC recursive
     // verifier circuit.
@@ -61,6 +99,9 @@ template <typename PCS> class ZeroMorphProver_ {
      *          Compute q_{n-3} of size N/(2^3) by
      *          q_{n-3}[l] = f[N/2^3 + l] - f[l]. Repeat similarly until you reach q_0.
      *
+     *          The update of f and the computation of the next quotient are done in place, in a parallel pass per
+     *          level.
+     *
      * @param polynomial Multilinear polynomial f(X_0, ..., X_{d-1})
      * @param u_challenge Multivariate challenge u = (u_0, ..., u_{d-1})
      * @return std::vector<Polynomial> The quotients q_k
@@ -72,42 +113,39 @@ template <typename PCS> class ZeroMorphProver_ {
         ASSERT(log_N == u_challenge.size());
 
         // Define the vector of quotients q_k, k = 0, ..., log_N-1
-        std::vector<Polynomial> quotients;
-        for (size_t k = 0; k < log_N; ++k) {
-            size_t size = 1 << k;
-            quotients.emplace_back(Polynomial(size)); // degree 2^k - 1
-        }
+        std::vector<Polynomial> quotients(log_N);
 
         // Compute the coefficients of q_{n-1}
         size_t size_q = 1 << (log_N - 1);
-        Polynomial q{ size_q };
-        for (size_t l = 0; l < size_q; ++l) {
-            q[l] = polynomial[size_q + l] - polynomial[l];
-        }
-
-        quotients[log_N - 1] = q.share();
-
-        std::vector<FF> f_k;
-        f_k.resize(size_q);
-
-        std::vector<FF> g(polynomial.data().get(), polynomial.data().get() + size_q);
+        quotients[log_N - 1] = Polynomial(size_q, DontZeroMemory::FLAG);
+        run_loop_in_parallel(
+            size_q,
+            [&](size_t start, size_t end) {
+                for (size_t l = start; l < end; ++l) {
+                    quotients[log_N - 1][l] = polynomial[size_q + l] - polynomial[l];
+                }
+            },
+            MIN_PARALLEL_QUOTIENT_SIZE);
 
-        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0
+        // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0. The lower half of `polynomial`, which is
+        // our own copy, holds f_k.
         for (size_t k = 1; k < log_N; ++k) {
-            // Compute f_k
-            for (size_t l = 0; l < size_q; ++l) {
-                f_k[l] = g[l] + u_challenge[log_N - k] * q[l];
-            }
-
+            const Polynomial& q = quotients[log_N - k];
+            const FF u = u_challenge[log_N - k];
             size_q = size_q / 2;
-            q = Polynomial{ size_q };
-
-            for (size_t l = 0; l < size_q; ++l) {
-                q[l] = f_k[size_q + l] - f_k[l];
-            }
-
-            quotients[log_N - k - 1] = q.share();
-            g = f_k;
+            Polynomial next_q(size_q, DontZeroMemory::FLAG);
+            // Each thread updates f_k over the ranges [l, l + size_q/threads) of both halves, then reads them back
+            run_loop_in_parallel(
+                size_q,
+                [&](size_t start, size_t end) {
+                    for (size_t l = start; l < end; ++l) {
+                        polynomial[l] += u * q[l];
+                        polynomial[size_q + l] += u * q[size_q + l];
+                        next_q[l] = polynomial[size_q + l] - polynomial[l];
+                    }
+                },
+                MIN_PARALLEL_QUOTIENT_SIZE);
+            quotients[log_N - k - 1] = std::move(next_q);
         }
 
         return quotients;
@@ -133,19 +171,17 @@ template <typename PCS> class ZeroMorphProver_ {
         auto result = Polynomial(N);
 
         // Compute \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
-        size_t k = 0;
-        auto scalar = FF(1); // y^k
-        for (auto& quotient : quotients) {
-            // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k -
-            // 1}) then accumulating them, we simply accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1
+        // Rather than explicitly computing the shifts of q_k by N - d_k - 1 (i.e. multiplying q_k by X^{N - d_k - 1})
+        // then accumulating them, we simply accumulate y^k*q_k into \hat{q} at the index offset N - d_k - 1
+        std::vector<FF> scalars = powers_of_challenge(y_challenge, std::max(quotients.size(), size_t(2)));
+        scalars.resize(quotients.size());
+        std::vector<size_t> offsets;
+        for (size_t k = 0; k < quotients.size(); ++k) {
             auto deg_k = static_cast<size_t>((1 << k) - 1);
-            size_t offset = N - deg_k - 1;
-            for (size_t idx = 0; idx < deg_k + 1; ++idx) {
-                result[offset + idx] += scalar * quotient[idx];
-            }
-            scalar *= y_challenge; // update batching scalar y^k
-            k++;
+            offsets.push_back(N - deg_k - 1);
         }
+        std::vector<std::span<const FF>> terms(quotients.begin(), quotients.end());
+        add_linear_combination<FF>(result, terms, scalars, offsets);
 
         return result;
     }
@@ -173,16 +209,19 @@ template <typename PCS> class ZeroMorphProver_ {
         // Initialize partially evaluated degree check polynomial \zeta_x to \hat{q}
         auto result = batched_quotient;
 
+        std::vector<FF> scalars;
         auto y_power = FF(1); // y^k
         for (size_t k = 0; k < log_N; ++k) {
             // Accumulate y^k * x^{N - d_k - 1} * q_k into \hat{q}
             auto deg_k = static_cast<size_t>((1 << k) - 1);
             auto x_power = x_challenge.pow(N - deg_k - 1); // x^{N - d_k - 1}
 
-            result.add_scaled(quotients[k], -y_power * x_power);
+            scalars.push_back(-y_power * x_power);
 
             y_power *= y_challenge; // update batching scalar y^k
         }
+        std::vector<std::span<const FF>> terms(quotients.begin(), quotients.end());
+        add_linear_combination<FF>(result, terms, scalars);
 
         return result;
     }
@@ -219,9 +258,14 @@ template <typename PCS> class ZeroMorphProver_ {
         size_t N = f_batched.size();
         size_t log_N = quotients.size();
 
+        // The terms of Z_x, accumulated in a single pass at the end
+        std::vector<std::span<const FF>> terms;
+        std::vector<FF> scalars;
+
         // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i
         auto result = g_batched;
-        result.add_scaled(f_batched, x_challenge);
+        terms.emplace_back(f_batched);
+        scalars.push_back(x_challenge);
 
         // Compute Z_x -= v * x * \Phi_n(x)
         auto phi_numerator = x_challenge.pow(N) - 1; // x^N - 1
@@ -245,7 +289,8 @@ template <typename PCS> class ZeroMorphProver_ {
             scalar *= x_challenge;
             scalar *= FF(-1);
 
-            result.add_scaled(quotients[k], scalar);
+            terms.emplace_back(quotients[k]);
+            scalars.push_back(scalar);
         }
 
         // If necessary, add to Z_x the contribution related to concatenated polynomials:
@@ -258,10 +303,12 @@ template <typename PCS> class ZeroMorphProver_ {
                 x_challenge.pow(MINICIRCUIT_N); // power of x used to shift polynomials to the right
             auto running_shift = x_challenge;
             for (size_t i = 0; i < concatenation_groups_batched.size(); i++) {
-                result.add_scaled(concatenation_groups_batched[i], running_shift);
+                terms.emplace_back(concatenation_groups_batched[i]);
+                scalars.push_back(running_shift);
                 running_shift *= x_to_minicircuit_N;
             }
         }
+        add_linear_combination<FF>(result, terms, scalars);
 
         return result;
     }
@@ -309,6 +356,27 @@ template <typename PCS> class ZeroMorphProver_ {
         return batched_polynomial;
     }
 
+    // The windows of the polynomials, which are added to a linear combination at their start_indices
+    static std::vector<std::span<const FF>> to_spans(RefSpan<Polynomial> polynomials)
+    {
+        std::vector<std::span<const FF>> spans;
+        spans.reserve(polynomials.size());
+        for (auto& polynomial : polynomials) {
+            spans.emplace_back(std::as_const(polynomial).coeffs());
+        }
+        return spans;
+    }
+
+    static std::vector<size_t> start_indices(RefSpan<Polynomial> polynomials)
+    {
+        std::vector<size_t> indices;
+        indices.reserve(polynomials.size());
+        for (auto& polynomial : polynomials) {
+            indices.emplace_back(polynomial.start_index());
+        }
+        return indices;
+    }
+
     /**
      * @brief Prove a set of multilinear evaluation claims for unshifted polynomials f_i and to-be-shifted
      * polynomials g_i
@@ -345,57 +413,69 @@ template <typename PCS> class ZeroMorphProver_ {
         // v = sum_{i=0}^{m-1}\rho^i*f_i(u) + sum_{i=0}^{l-1}\rho^{m+i}*h_i(u).
         // Note: g_batched is formed from the to-be-shifted polynomials, but the batched evaluation incorporates the
         // evaluations produced by sumcheck of h_i = g_i_shifted.
+        // Each batch is computed in a single pass over the result (see add_linear_combination).
         FF batched_evaluation{ 0 };
-        Polynomial f_batched(N); // batched unshifted polynomials
         FF batching_scalar{ 1 };
-        for (auto [f_poly, f_eval] : zip_view(f_polynomials, f_evaluations)) {
-            f_batched.add_scaled(f_poly, batching_scalar);
+        std::vector<FF> f_scalars;
+        for (auto f_eval : f_evaluations) {
+            f_scalars.push_back(batching_scalar);
             batched_evaluation += batching_scalar * f_eval;
             batching_scalar *= rho;
         }
+        Polynomial f_batched(N); // batched unshifted polynomials
+        add_linear_combination<FF>(f_batched, to_spans(f_polynomials), f_scalars, start_indices(f_polynomials));
 
-        Polynomial g_batched{ N }; // batched to-be-shifted polynomials
-        for (auto [g_poly, g_shift_eval] : zip_view(g_polynomials, g_shift_evaluations)) {
-            g_batched.add_scaled(g_poly, batching_scalar);
+        std::vector<FF> g_scalars;
+        for (auto g_shift_eval : g_shift_evaluations) {
+            g_scalars.push_back(batching_scalar);
             batched_evaluation += batching_scalar * g_shift_eval;
             batching_scalar *= rho;
-        };
+        }
+        Polynomial g_batched{ N }; // batched to-be-shifted polynomials
+        add_linear_combination<FF>(g_batched, to_spans(g_polynomials), g_scalars, start_indices(g_polynomials));
 
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
+        std::vector<FF> concatenation_scalars;
+        for (size_t i = 0; i < num_groups; ++i) {
+            concatenation_scalars.push_back(batching_scalar);
+            batched_evaluation += batching_scalar * concatenated_evaluations[i];
+            batching_scalar *= rho;
+        }
         // Concatenated polynomials
         Polynomial concatenated_batched(N);
+        add_linear_combination<FF>(concatenated_batched,
+                                   to_spans(concatenated_polynomials),
+                                   concatenation_scalars,
+                                   start_indices(concatenated_polynomials));
 
-        // construct concatention_groups_batched
+        // construct concatention_groups_batched, from the j-th element of each group
         std::vector<Polynomial> concatenation_groups_batched;
-        for (size_t i = 0; i < num_chunks_per_group; ++i) {
-            concatenation_groups_batched.push_back(Polynomial(N));
-        }
-        // for each group
-        for (size_t i = 0; i < num_groups; ++i) {
-            concatenated_batched.add_scaled(concatenated_polynomials[i], batching_scalar);
-            // for each element in a group
-            for (size_t j = 0; j < num_chunks_per_group; ++j) {
-                concatenation_groups_batched[j].add_scaled(concatenation_groups[i][j], batching_scalar);
+        for (size_t j = 0; j < num_chunks_per_group; ++j) {
+            std::vector<std::span<const FF>> group_elements;
+            for (size_t i = 0; i < num_groups; ++i) {
+                group_elements.emplace_back(concatenation_groups[i][j]);
             }
-            batched_evaluation += batching_scalar * concatenated_evaluations[i];
-            batching_scalar *= rho;
+            concatenation_groups_batched.emplace_back(N);
+            add_linear_combination<FF>(concatenation_groups_batched.back(), group_elements, concatenation_scalars);
         }
 
         // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
         // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
-        Polynomial f_polynomial = f_batched;
-        f_polynomial += g_batched.shifted();
-        f_polynomial += concatenated_batched;
+        Polynomial f_polynomial(N);
+        const std::array<FF, 3> ones{ FF(1), FF(1), FF(1) };
+        add_linear_combination<FF>(
+            f_polynomial,
+            std::array<std::span<const FF>, 3>{ f_batched, g_batched.shifted(), concatenated_batched },
+            ones);
 
         // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
         auto quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
 
         // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
-        std::vector<Commitment> q_k_commitments;
-        q_k_commitments.reserve(log_N);
+        auto q_k_commitments =
+            commitment_key->commit_batch(std::vector<std::span<const FF>>(quotients.begin(), quotients.end()));
         for (size_t idx = 0; idx < log_N; ++idx) {
-            q_k_commitments[idx] = commitment_key->commit(quotients[idx]);
             std::string label = "ZM:C_q_" + std::to_string(idx);
             transcript->send_to_verifier(label, q_k_commitments[idx]);
         }
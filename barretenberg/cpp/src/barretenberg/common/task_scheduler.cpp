@@ -0,0 +1,337 @@
+#include "task_scheduler.hpp"
+#include "thread.hpp"
+
+#ifndef NO_MULTITHREADING
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace bb {
+
+class TaskScheduler {
+  public:
+    TaskScheduler(size_t num_workers);
+    TaskScheduler(const TaskScheduler& other) = delete;
+    TaskScheduler(TaskScheduler&& other) = delete;
+    ~TaskScheduler();
+
+    TaskScheduler& operator=(const TaskScheduler& other) = delete;
+    TaskScheduler& operator=(TaskScheduler&& other) = delete;
+
+    static TaskScheduler& get()
+    {
+        static TaskScheduler scheduler(get_num_cpus() - 1);
+        return scheduler;
+    }
+
+    size_t num_threads() const { return workers_.size() + 1; }
+
+    void push(Task task);
+    void wait(TaskGroup& group);
+    void wake_all();
+
+  private:
+    // Number of attempts to find a task, yielding in between, before an idle thread parks
+    static constexpr size_t NUM_STEAL_ROUNDS = 64;
+    static constexpr size_t NO_WORKER = static_cast<size_t>(-1);
+
+    struct alignas(64) TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::thread> workers_;
+    // One queue per worker, and a last one that is shared by all other threads
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    // Incremented (under sleep_mutex_) whenever a parked thread may have something to do
+    uint64_t epoch_ = 0;
+    std::atomic<size_t> num_sleeping_ = 0;
+    bool stop_ = false;
+
+    static thread_local size_t worker_index;
+
+    BB_NO_PROFILE void worker_loop(size_t worker_index);
+
+    size_t own_queue() const { return worker_index == NO_WORKER ? workers_.size() : worker_index; }
+    bool pop(Task& task);
+    bool steal(Task& task);
+    bool find_task(Task& task) { return pop(task) || steal(task); }
+    static void execute(const Task& task);
+    void wake_one();
+};
+
+thread_local size_t TaskScheduler::worker_index = TaskScheduler::NO_WORKER;
+
+TaskScheduler::TaskScheduler(size_t num_workers)
+{
+    queues_.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        queues_.emplace_back(std::make_unique<TaskQueue>());
+    }
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers_.emplace_back(&TaskScheduler::worker_loop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    sleep_condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void TaskScheduler::push(Task task)
+{
+    auto& queue = *queues_[own_queue()];
+    {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    wake_one();
+}
+
+bool TaskScheduler::pop(Task& task)
+{
+    auto& queue = *queues_[own_queue()];
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool TaskScheduler::steal(Task& task)
+{
+    // Start from a different victim on each thread, so that thieves do not all contend for the same queue
+    static thread_local size_t victim = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    const size_t self = own_queue();
+    for (size_t i = 0; i < queues_.size(); ++i) {
+        victim = (victim + 1) % queues_.size();
+        if (victim == self) {
+            continue;
+        }
+        auto& queue = *queues_[victim];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::execute(const Task& task)
+{
+    TaskGroup& group = *task.group;
+    // This thread may be waiting for tasks of its own, which resume with its TaskLocals once this one is done
+    TaskLocals locals = std::exchange(task_locals(), task.locals);
+#ifndef __wasm__
+    try {
+#endif
+        task.execute(task.context, task.begin, task.end);
+#ifndef __wasm__
+    } catch (...) {
+        if (!group.has_exception_.exchange(true)) {
+            group.exception_ = std::current_exception();
+        }
+    }
+#endif
+    task_locals() = std::move(locals);
+    group.finish_task();
+}
+
+void TaskScheduler::wake_one()
+{
+    // A thread that is about to park increments num_sleeping_ before its last look at the queues. So either it sees
+    // the task that was just pushed, or we see it here.
+    if (num_sleeping_.load() == 0) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        ++epoch_;
+    }
+    sleep_condition_.notify_one();
+}
+
+void TaskScheduler::wake_all()
+{
+    if (num_sleeping_.load() == 0) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        ++epoch_;
+    }
+    sleep_condition_.notify_all();
+}
+
+void TaskScheduler::wait(TaskGroup& group)
+{
+    Task task;
+    size_t round = 0;
+    while (group.pending_.load() != 0) {
+        if (find_task(task)) {
+            execute(task);
+            round = 0;
+            continue;
+        }
+        // The remaining tasks of the group are running on other threads
+        if (++round < NUM_STEAL_ROUNDS) {
+            std::this_thread::yield();
+            continue;
+        }
+        round = 0;
+        uint64_t epoch = 0;
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            epoch = epoch_;
+        }
+        num_sleeping_.fetch_add(1);
+        if (find_task(task)) {
+            num_sleeping_.fetch_sub(1);
+            execute(task);
+            continue;
+        }
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_condition_.wait(lock, [&] { return epoch_ != epoch || group.pending_.load() == 0; });
+        }
+        num_sleeping_.fetch_sub(1);
+    }
+}
+
+void TaskScheduler::worker_loop(size_t index)
+{
+    worker_index = index;
+    Task task;
+    size_t round = 0;
+    while (true) {
+        if (find_task(task)) {
+            execute(task);
+            round = 0;
+            continue;
+        }
+        if (++round < NUM_STEAL_ROUNDS) {
+            std::this_thread::yield();
+            continue;
+        }
+        round = 0;
+        uint64_t epoch = 0;
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            if (stop_) {
+                break;
+            }
+            epoch = epoch_;
+        }
+        num_sleeping_.fetch_add(1);
+        if (find_task(task)) {
+            num_sleeping_.fetch_sub(1);
+            execute(task);
+            continue;
+        }
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_condition_.wait(lock, [&] { return epoch_ != epoch || stop_; });
+        }
+        num_sleeping_.fetch_sub(1);
+    }
+}
+
+size_t get_num_scheduler_threads()
+{
+    return TaskScheduler::get().num_threads();
+}
+
+void TaskGroup::spawn(Task task)
+{
+    task.group = this;
+    task.locals = task_locals();
+    pending_.fetch_add(1);
+    TaskScheduler::get().push(std::move(task));
+}
+
+void TaskGroup::wait_for_tasks()
+{
+    if (pending_.load() != 0) {
+        TaskScheduler::get().wait(*this);
+    }
+}
+
+void TaskGroup::finish_task()
+{
+    // The group may be destroyed as soon as the count reaches zero, so it must not be accessed afterwards
+    if (pending_.fetch_sub(1) == 1) {
+        TaskScheduler::get().wake_all();
+    }
+}
+
+} // namespace bb
+
+#else
+
+namespace bb {
+
+size_t get_num_scheduler_threads()
+{
+    return 1;
+}
+
+void TaskGroup::spawn(Task task)
+{
+    // Runs the task right away, but still defers its exception to `wait`
+#ifndef __wasm__
+    try {
+#endif
+        task.execute(task.context, task.begin, task.end);
+#ifndef __wasm__
+    } catch (...) {
+        if (!has_exception_.exchange(true)) {
+            exception_ = std::current_exception();
+        }
+    }
+#endif
+}
+
+void TaskGroup::wait_for_tasks() {}
+
+void TaskGroup::finish_task() {}
+
+} // namespace bb
+
+#endif
+
+namespace bb {
+
+TaskLocals& task_locals()
+{
+    static thread_local TaskLocals locals;
+    return locals;
+}
+
+void TaskGroup::wait()
+{
+    wait_for_tasks();
+    if (has_exception_.load()) {
+        has_exception_ = false;
+        std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+}
+
+} // namespace bb
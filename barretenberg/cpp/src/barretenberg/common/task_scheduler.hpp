@@ -0,0 +1,181 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * A work-stealing task scheduler, on which parallel_for and run_loop_in_parallel are built.
+ *
+ * The scheduler owns get_num_cpus() - 1 worker threads, each with its own deque of tasks. A thread pushes the tasks it
+ * spawns to the back of its deque and takes its own work from the back, while idle threads steal from the front of
+ * other deques. Threads that are not workers (e.g. the main thread) push to a shared deque, which is also stolen from.
+ * A worker that finds nothing to steal parks on a condition variable until a task is spawned.
+ *
+ * Work is forked into a TaskGroup and joined with TaskGroup::wait. A thread that waits for a group runs queued tasks
+ * until the group completes, so that parallel regions can be nested (e.g. a parallel_for inside a task, or inside an
+ * iteration of another parallel_for) without blocking a worker or oversubscribing the cpus, and independent stages of
+ * work can share the cpus. The tasks it runs meanwhile may belong to any group, so a thread must not hold a mutex
+ * while it waits (e.g. across a parallel_for): a task that takes the same mutex would deadlock.
+ *
+ * Loops are split lazily: a range is halved, and one half is made stealable, until it is no larger than the grain size.
+ * Loop bodies are templates, so that an iteration is a direct call rather than a call through a std::function.
+ *
+ * A task runs with the TaskLocals that the thread spawning it had, whichever thread executes it.
+ */
+namespace bb {
+
+class TaskGroup;
+class PolynomialArena;
+
+/**
+ * @brief State that is scoped to a computation rather than to a thread: a task inherits the TaskLocals of the thread
+ * that spawns it, and they are installed on the thread that executes it for the duration of the task.
+ * @details So a computation that sets them sees them in all the tasks it forks, but not in the unrelated tasks that
+ * share the scheduler (or that a thread waiting for its own tasks may run meanwhile).
+ */
+struct TaskLocals {
+    // The arena of the innermost PolynomialArena::Scope, see polynomials/polynomial_arena.hpp
+    std::shared_ptr<PolynomialArena> polynomial_arena;
+};
+
+/**
+ * @brief The TaskLocals of the calling thread, i.e. of the task it is running, if any.
+ */
+TaskLocals& task_locals();
+
+/**
+ * @brief A unit of work for the scheduler: the iterations [begin, end) of the loop described by `context`.
+ */
+struct Task {
+    void (*execute)(void* context, size_t begin, size_t end) = nullptr;
+    void* context = nullptr;
+    size_t begin = 0;
+    size_t end = 0;
+    TaskGroup* group = nullptr;
+    // Set by TaskGroup::spawn
+    TaskLocals locals;
+};
+
+/**
+ * @brief A set of tasks that are forked with `run` and joined with `wait`.
+ * @details The destructor waits for the tasks that are still running, but does not rethrow their exceptions.
+ */
+class TaskGroup {
+  public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup(TaskGroup&& other) = delete;
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    TaskGroup& operator=(TaskGroup&& other) = delete;
+    ~TaskGroup() { wait_for_tasks(); }
+
+    /**
+     * @brief Forks `func()`, which may run on any thread (including the one that calls `wait`).
+     */
+    template <typename Func> void run(Func&& func)
+    {
+        using Function = std::decay_t<Func>;
+        auto* function = new Function(std::forward<Func>(func));
+        spawn(Task{ .execute =
+                        [](void* context, size_t, size_t) {
+                            std::unique_ptr<Function> owned(static_cast<Function*>(context));
+                            (*owned)();
+                        },
+                    .context = function,
+                    .begin = 0,
+                    .end = 1,
+                    .group = this,
+                    .locals = {} });
+    }
+
+    /**
+     * @brief Queues `task` as part of this group, with the TaskLocals of the calling thread. Its context must outlive
+     * the group's `wait`.
+     */
+    void spawn(Task task);
+
+    /**
+     * @brief Runs queued tasks until all tasks of the group have completed, then rethrows the first exception thrown
+     * by one of them.
+     * @details The tasks that are run may belong to other groups, so the caller must not hold a mutex.
+     */
+    void wait();
+
+  private:
+    friend class TaskScheduler;
+
+    void wait_for_tasks();
+    void finish_task();
+
+    std::atomic<size_t> pending_ = 0;
+    std::atomic<bool> has_exception_ = false;
+    std::exception_ptr exception_;
+};
+
+namespace detail {
+template <typename Func> struct ParallelLoop {
+    Func* func;
+    size_t grain_size;
+    TaskGroup group;
+
+    static void execute(void* context, size_t begin, size_t end)
+    {
+        auto& loop = *static_cast<ParallelLoop*>(context);
+        while (end - begin > loop.grain_size) {
+            const size_t middle = begin + (end - begin) / 2;
+            loop.group.spawn(Task{ .execute = &ParallelLoop::execute,
+                                   .context = context,
+                                   .begin = middle,
+                                   .end = end,
+                                   .group = nullptr,
+                                   .locals = {} });
+            end = middle;
+        }
+        for (size_t i = begin; i < end; ++i) {
+            (*loop.func)(i);
+        }
+    }
+};
+} // namespace detail
+
+/**
+ * @brief The number of threads that run tasks: the workers and the calling thread.
+ */
+size_t get_num_scheduler_threads();
+
+/**
+ * @brief Runs `func(i)` for i in [0, num_iterations) on the scheduler, in chunks of at least `grain_size` iterations.
+ * May be called from within a task or another loop.
+ */
+template <typename Func> void parallel_for_range(size_t num_iterations, Func&& func, size_t grain_size = 1)
+{
+#ifndef NO_MULTITHREADING
+    if (num_iterations > grain_size && get_num_scheduler_threads() > 1) {
+        detail::ParallelLoop<std::remove_reference_t<Func>> loop{ &func, grain_size == 0 ? 1 : grain_size, {} };
+        detail::ParallelLoop<std::remove_reference_t<Func>>::execute(&loop, 0, num_iterations);
+        loop.group.wait();
+        return;
+    }
+#else
+    static_cast<void>(grain_size);
+#endif
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+}
+
+/**
+ * @brief Runs the given functions concurrently and returns once all of them have completed.
+ */
+template <typename Func, typename... Funcs> void parallel_invoke(Func&& func, Funcs&&... funcs)
+{
+    TaskGroup group;
+    (group.run([&funcs]() { funcs(); }), ...);
+    func();
+    group.wait();
+}
+
+} // namespace bb
@@ -0,0 +1,88 @@
+#include "task_scheduler.hpp"
+#include "thread.hpp"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace bb;
+
+TEST(TaskScheduler, ParallelForRunsEachIterationOnce)
+{
+    for (size_t num_iterations : { 0UL, 1UL, 7UL, 1000UL }) {
+        std::vector<size_t> counts(num_iterations);
+        parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+        EXPECT_EQ(counts, std::vector<size_t>(num_iterations, 1));
+    }
+}
+
+TEST(TaskScheduler, RunLoopInParallelCoversRange)
+{
+    std::vector<size_t> counts(1001);
+    run_loop_in_parallel(counts.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            counts[i]++;
+        }
+    });
+    EXPECT_EQ(counts, std::vector<size_t>(counts.size(), 1));
+}
+
+TEST(TaskScheduler, NestedLoops)
+{
+    constexpr size_t outer = 16;
+    constexpr size_t inner = 64;
+    std::vector<std::atomic<size_t>> sums(outer);
+    parallel_for(outer, [&](size_t i) {
+        parallel_for_range(inner, [&](size_t j) { sums[i].fetch_add(j); });
+    });
+    for (const auto& sum : sums) {
+        EXPECT_EQ(sum.load(), inner * (inner - 1) / 2);
+    }
+}
+
+TEST(TaskScheduler, ForkJoin)
+{
+    // Recursive fork/join, where each waiting task runs other tasks in the meantime
+    const auto sum = [](const auto& self, size_t begin, size_t end) -> size_t {
+        if (end - begin <= 8) {
+            size_t result = 0;
+            for (size_t i = begin; i < end; ++i) {
+                result += i;
+            }
+            return result;
+        }
+        const size_t middle = begin + (end - begin) / 2;
+        size_t left = 0;
+        size_t right = 0;
+        parallel_invoke([&] { left = self(self, begin, middle); }, [&] { right = self(self, middle, end); });
+        return left + right;
+    };
+    EXPECT_EQ(sum(sum, 0, 10000), size_t(10000 * 9999 / 2));
+
+    TaskGroup group;
+    std::vector<size_t> results(10);
+    for (size_t i = 0; i < results.size(); ++i) {
+        group.run([&results, i] { results[i] = i * i; });
+    }
+    group.wait();
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], i * i);
+    }
+}
+
+TEST(TaskScheduler, PropagatesExceptions)
+{
+    EXPECT_THROW(parallel_for(100,
+                              [](size_t i) {
+                                  if (i == 77) {
+                                      throw std::runtime_error("iteration failed");
+                                  }
+                              }),
+                 std::runtime_error);
+
+    TaskGroup group;
+    group.run([] { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    // The exception is only rethrown once
+    group.wait();
+}
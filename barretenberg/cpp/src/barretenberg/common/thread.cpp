@@ -6,8 +6,8 @@
  * we had scattered throughout our code. It provides a clean abstraction for the work division strategy we use (we
  * used OMP's`"#pragma omp parallel for` everywhere).
  *
- * The first implementation was `parallel_for_spawning`. You can read a description of each implementation in the
- * relevant source file, but parallel_for_spawning is the simplest approach imaginable.
+ * The first implementation was `parallel_for_spawning`, the simplest approach imaginable (each implementation was
+ * described in its own source file, see the git history of common/parallel_for_*.cpp).
  * Once WASM was working, I checked its performance in native code by running it against the polynomials benchmarks.
  * In doing so, OMP outperformed it significantly (at least for FFT algorithms). This set me on a course to try
  * and understand why and to provide a suitable alternative. Ultimately I found solutions that compared to OMP with
@@ -34,41 +34,19 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the above run one flat loop at a time, through a std::function, and the calling thread of a nested
+ * parallel_for would block a worker. parallel_for now runs on the work-stealing scheduler of task_scheduler.hpp, which
+ * lets parallel regions nest and run concurrently (e.g. independent prover stages), and whose templated entry points
+ * call the loop body directly. The previous backends (spawning, moody, queued, atomic_pool and mutex_pool, as well as
+ * OMP, which was the default unless NO_OMP_MULTITHREADING was defined) have been removed, and there is no longer a
+ * choice of backend.
+ *
+ * As a thread that waits for a parallel_for runs other queued tasks meanwhile, which may be unrelated to the loop and
+ * may take locks of their own, callers must not hold a mutex across a call to parallel_for (or run_loop_in_parallel).
  */
 
 namespace bb {
-// 64 core aws r5.
-// pippenger run: pippenger_bench/1048576
-// coset_fft run: coset_fft_bench_parallel/4194304
-// proof run: 2m gate ultraplonk. average of 5.
-
-// pippenger: 179ms
-// coset_fft: 54776us
-// proof: 11.33s
-void parallel_for_omp(size_t num_iterations, const std::function<void(size_t)>& func);
-
-// pippenger: 163ms
-// coset_fft: 59993us
-// proof: 11.11s
-void parallel_for_moody(size_t num_iterations, const std::function<void(size_t)>& func);
-
-// pippenger: 154ms
-// coset_fft: 92997us
-// proof: 10.84s
-void parallel_for_spawning(size_t num_iterations, const std::function<void(size_t)>& func);
-
-// pippenger: 178ms
-// coset_fft: 70207us
-// proof: 11.55s
-void parallel_for_queued(size_t num_iterations, const std::function<void(size_t)>& func);
-
-// pippenger: 152ms
-// coset_fft: 56658us
-// proof: 11.28s
-void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(size_t)>& func);
-
-void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
-
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -76,15 +54,7 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
         func(i);
     }
 #else
-#ifndef NO_OMP_MULTITHREADING
-    parallel_for_omp(num_iterations, func);
-#else
-    // parallel_for_spawning(num_iterations, func);
-    // parallel_for_moody(num_iterations, func);
-    // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
-    // parallel_for_queued(num_iterations, func);
-#endif
+    parallel_for_range(num_iterations, func);
 #endif
 }
 
@@ -103,30 +73,8 @@ void run_loop_in_parallel(size_t num_points,
                           const std::function<void(size_t, size_t)>& func,
                           size_t no_multhreading_if_less_or_equal)
 {
-    if (num_points <= no_multhreading_if_less_or_equal) {
-        func(0, num_points);
-        return;
-    }
-    // Get number of cpus we can split into
-    const size_t num_cpus = get_num_cpus();
-
-    // Compute the size of a single chunk
-    const size_t chunk_size = (num_points / num_cpus) + (num_points % num_cpus == 0 ? 0 : 1);
-    // Parallelize over chunks
-    parallel_for(num_cpus, [num_points, chunk_size, &func](size_t chunk_index) {
-        // If num_points is small, sometimes we need fewer CPUs
-        if (chunk_size * chunk_index > num_points) {
-            return;
-        }
-        // Compute the current chunk size (can differ in case it's the last chunk)
-        size_t current_chunk_size = std::min(num_points - (chunk_size * chunk_index), chunk_size);
-        if (current_chunk_size == 0) {
-            return;
-        }
-        size_t start = chunk_index * chunk_size;
-        size_t end = chunk_index * chunk_size + current_chunk_size;
-        func(start, end);
-    });
+    run_loop_in_parallel<const std::function<void(size_t, size_t)>&>(
+        num_points, func, no_multhreading_if_less_or_equal);
 };
 
 /**
@@ -1,4 +1,5 @@
 #pragma once
+#include "task_scheduler.hpp"
 #include <atomic>
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
@@ -19,11 +20,57 @@ inline size_t get_num_cpus_pow2()
     return static_cast<size_t>(1ULL << numeric::get_msb(get_num_cpus()));
 }
 
+/**
+ * @brief Runs func(i) for each i in [0, num_iterations) in parallel on the work-stealing scheduler.
+ * @details The calling thread runs queued tasks, not necessarily of this loop, until the loop is done. So it must not
+ * hold a mutex that those tasks may take, i.e. no mutex should be held across a parallel loop.
+ */
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
 void run_loop_in_parallel(size_t num_points,
                           const std::function<void(size_t, size_t)>& func,
                           size_t no_multhreading_if_less_or_equal = 0);
 
+/**
+ * @brief Runs func(i) for each i in [0, num_iterations) in parallel on the work-stealing scheduler. Unlike the
+ * std::function overload, the loop body is called directly.
+ */
+template <typename Func> void parallel_for(size_t num_iterations, Func&& func)
+{
+    parallel_for_range(num_iterations, func);
+}
+
+/**
+ * @brief Split a loop into several loops running in parallel
+ *
+ * @details Splits the num_points into get_num_cpus() chunks and calls func(start, end) for each of them, on the
+ * work-stealing scheduler. Unlike the std::function overload, the loop function is called directly.
+ * @param no_multhreading_if_less_or_equal If num points is less or equal to this value, run without parallelization
+ */
+template <typename Func>
+void run_loop_in_parallel(size_t num_points, Func&& func, size_t no_multhreading_if_less_or_equal = 0)
+{
+    if (num_points <= no_multhreading_if_less_or_equal) {
+        func(size_t(0), num_points);
+        return;
+    }
+    // Get number of cpus we can split into
+    const size_t num_cpus = get_num_cpus();
+
+    // Compute the size of a single chunk
+    const size_t chunk_size = (num_points / num_cpus) + (num_points % num_cpus == 0 ? 0 : 1);
+    // Parallelize over chunks
+    parallel_for_range(num_cpus, [num_points, chunk_size, &func](size_t chunk_index) {
+        // If num_points is small, sometimes we need fewer CPUs
+        if (chunk_size * chunk_index >= num_points) {
+            return;
+        }
+        // Compute the current chunk size (can differ in case it's the last chunk)
+        const size_t start = chunk_index * chunk_size;
+        const size_t end = start + std::min(num_points - start, chunk_size);
+        func(start, end);
+    });
+}
+
 template <typename FunctionType>
     requires(std::is_same_v<FunctionType, std::function<void(size_t, size_t)>> ||
              std::is_same_v<FunctionType, std::function<void(size_t, size_t, size_t)>>)
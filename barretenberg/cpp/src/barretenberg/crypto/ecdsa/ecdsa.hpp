@@ -7,6 +7,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include <array>
 #include <string>
+#include <vector>
 
 namespace bb::crypto {
 template <typename Fr, typename G1> struct ecdsa_key_pair {
@@ -36,6 +37,11 @@ bool ecdsa_verify_signature(const std::string& message,
                             const typename G1::affine_element& public_key,
                             const ecdsa_signature& signature);
 
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_batch(const std::vector<std::string>& messages,
+                                     const std::vector<typename G1::affine_element>& public_keys,
+                                     const std::vector<ecdsa_signature>& signatures);
+
 inline bool operator==(ecdsa_signature const& lhs, ecdsa_signature const& rhs)
 {
     return lhs.r == rhs.r && lhs.s == rhs.s && lhs.v == rhs.v;
@@ -179,3 +179,67 @@ TEST(ecdsa, verify_signature_secp256r1_sha256_NIST_1)
         ecdsa_verify_signature<Sha256Hasher, secp256r1::fq, secp256r1::fr, secp256r1::g1>(message, public_key, sig);
     EXPECT_EQ(result, true);
 }
+
+TEST(ecdsa, verify_batch_secp256r1_sha256)
+{
+    const size_t num_signatures = 32;
+    std::vector<std::string> messages;
+    std::vector<secp256r1::g1::affine_element> public_keys;
+    std::vector<ecdsa_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        ecdsa_key_pair<secp256r1::fr, secp256r1::g1> account;
+        account.private_key = secp256r1::fr::random_element();
+        account.public_key = secp256r1::g1::one * account.private_key;
+        messages.emplace_back("The quick brown dog jumped over the lazy fox " + std::to_string(i));
+        public_keys.emplace_back(account.public_key);
+        signatures.emplace_back(ecdsa_construct_signature<Sha256Hasher, secp256r1::fq, secp256r1::fr, secp256r1::g1>(
+            messages.back(), account));
+    }
+
+    std::vector<bool> result = ecdsa_verify_batch<Sha256Hasher, secp256r1::fq, secp256r1::fr, secp256r1::g1>(
+        messages, public_keys, signatures);
+
+    EXPECT_EQ(result, std::vector<bool>(num_signatures, true));
+}
+
+TEST(ecdsa, verify_batch_identifies_invalid_signatures)
+{
+    const size_t num_signatures = 40;
+    std::vector<std::string> messages;
+    std::vector<secp256k1::g1::affine_element> public_keys;
+    std::vector<ecdsa_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        ecdsa_key_pair<secp256k1::fr, secp256k1::g1> account;
+        account.private_key = secp256k1::fr::random_element();
+        account.public_key = secp256k1::g1::one * account.private_key;
+        messages.emplace_back("The quick brown dog jumped over the lazy fox " + std::to_string(i));
+        public_keys.emplace_back(account.public_key);
+        signatures.emplace_back(ecdsa_construct_signature<Sha256Hasher, secp256k1::fq, secp256k1::fr, secp256k1::g1>(
+            messages.back(), account));
+    }
+    std::vector<bool> expected(num_signatures, true);
+
+    // Invalid signatures: a different message, a different public key, a modified s and a zero r
+    messages[3] = "The quick brown fox jumped over the lazy dog.";
+    expected[3] = false;
+    std::swap(public_keys[10], public_keys[11]);
+    expected[10] = false;
+    expected[11] = false;
+    signatures[22].s[31] ^= 1;
+    expected[22] = false;
+    signatures[39].r.fill(0);
+    expected[39] = false;
+    // Valid signatures with a wrong or malformed recovery id, whose nonce is not the one recovered from v
+    signatures[17].v = signatures[17].v == 27 ? 28 : 27;
+    signatures[30].v = 0;
+
+    std::vector<bool> result = ecdsa_verify_batch<Sha256Hasher, secp256k1::fq, secp256k1::fr, secp256k1::g1>(
+        messages, public_keys, signatures);
+
+    EXPECT_EQ(result, expected);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        EXPECT_EQ(result[i],
+                  (ecdsa_verify_signature<Sha256Hasher, secp256k1::fq, secp256k1::fr, secp256k1::g1>(
+                      messages[i], public_keys[i], signatures[i])));
+    }
+}
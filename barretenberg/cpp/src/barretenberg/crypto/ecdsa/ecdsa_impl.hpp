@@ -2,8 +2,13 @@
 
 #include "../hmac/hmac.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
+#include <limits>
+#include <span>
+#include <vector>
+
 namespace bb::crypto {
 
 template <typename Hash, typename Fq, typename Fr, typename G1>
@@ -170,4 +175,220 @@ bool ecdsa_verify_signature(const std::string& message,
     Fr result(Rx);
     return result == r;
 }
+
+/**
+ * @brief Compute Σ scalars[i]⋅points[i] with the bucket method, the windows of the scalars being split between threads
+ *
+ * @details The pippenger of ecc/scalar_multiplication is only instantiated for BN254 and Grumpkin, while ECDSA is
+ * mostly used over secp256k1 and secp256r1.
+ */
+template <typename Fr, typename G1>
+typename G1::element ecdsa_multi_scalar_mul(const std::vector<typename G1::affine_element>& points,
+                                            const std::vector<Fr>& scalars)
+{
+    using element = typename G1::element;
+    ASSERT(points.size() == scalars.size());
+    const size_t num_points = points.size();
+    const size_t num_bits = static_cast<size_t>(uint256_t(Fr::modulus).get_msb()) + 1;
+
+    std::vector<uint256_t> exponents(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        exponents[i] = uint256_t(scalars[i]);
+    }
+
+    // Each window costs an addition per point, and two per bucket to sum its buckets
+    size_t window_bits = 1;
+    size_t min_cost = std::numeric_limits<size_t>::max();
+    for (size_t bits = 1; bits <= 16; ++bits) {
+        const size_t cost = ((num_bits + bits - 1) / bits) * (num_points + (2UL << bits));
+        if (cost < min_cost) {
+            min_cost = cost;
+            window_bits = bits;
+        }
+    }
+    const size_t num_windows = (num_bits + window_bits - 1) / window_bits;
+
+    std::vector<element> window_sums(num_windows);
+    parallel_for(num_windows, [&](size_t window) {
+        std::vector<element> buckets((1UL << window_bits) - 1, element::infinity());
+        const size_t start = window * window_bits;
+        const size_t end = std::min(start + window_bits, num_bits);
+        for (size_t i = 0; i < num_points; ++i) {
+            const auto digit = static_cast<size_t>(exponents[i].slice(start, end).data[0]);
+            if (digit != 0) {
+                buckets[digit - 1] += points[i];
+            }
+        }
+        // Σ d⋅B_d, as the sum of the running sums of the buckets from the highest one
+        element running_sum = element::infinity();
+        element sum = element::infinity();
+        for (size_t j = buckets.size(); j-- > 0;) {
+            running_sum += buckets[j];
+            sum += running_sum;
+        }
+        window_sums[window] = sum;
+    });
+
+    element result = window_sums[num_windows - 1];
+    for (size_t window = num_windows - 1; window-- > 0;) {
+        for (size_t j = 0; j < window_bits; ++j) {
+            result.self_dbl();
+        }
+        result += window_sums[window];
+    }
+    return result;
+}
+
+/**
+ * @brief Verify a batch of signatures, with the same result as ecdsa_verify_signature for each of them
+ *
+ * @details The nonce R of a signature is recovered from r and v as in ecdsa_recover_public_key, so that a signature
+ * holds if R = z/s⋅G + r/s⋅Q. These equations are combined with random scalars ρᵢ into
+ *
+ *      (Σ ρᵢ⋅zᵢ/sᵢ)⋅G + Σ ρᵢ⋅rᵢ/sᵢ⋅Qᵢ - Σ ρᵢ⋅Rᵢ = 0
+ *
+ * and checked with one multi-scalar multiplication, after hashing the messages in parallel and inverting the s values
+ * in a batch. When the check fails, the batch is split in two halves which are checked again, down to a few signatures,
+ * which are verified one by one. So a few invalid signatures in a large batch are found in O(log n) checks.
+ *
+ * The signatures whose nonce cannot be recovered, e.g. because v is not in {27, 28, 29, 30}, are verified one by one,
+ * since ecdsa_verify_signature does not use v.
+ *
+ * @warning Unlike ecdsa_verify_signature, a signature whose s value is high is rejected rather than throwing.
+ *
+ * @return whether each signature is valid
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_batch(const std::vector<std::string>& messages,
+                                     const std::vector<typename G1::affine_element>& public_keys,
+                                     const std::vector<ecdsa_signature>& signatures)
+{
+    using affine_element = typename G1::affine_element;
+    using serialize::read;
+    // Smaller batches are verified one signature at a time
+    constexpr size_t MIN_BATCH_SIZE = 4;
+
+    const size_t num_signatures = signatures.size();
+    ASSERT(messages.size() == num_signatures && public_keys.size() == num_signatures);
+
+    enum Status : uint8_t { REJECTED, BATCHED, SINGLE, ACCEPTED };
+    std::vector<uint8_t> status(num_signatures, REJECTED);
+    std::vector<Fr> r_values(num_signatures);
+    std::vector<Fr> s_values(num_signatures);
+    std::vector<Fr> z_values(num_signatures);
+    std::vector<affine_element> nonces(num_signatures);
+
+    const uint256_t mod = uint256_t(Fr::modulus);
+    run_loop_in_parallel(num_signatures, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            const ecdsa_signature& sig = signatures[i];
+            uint256_t r_uint;
+            uint256_t s_uint;
+            const auto* r_buf = &sig.r[0];
+            const auto* s_buf = &sig.s[0];
+            read(r_buf, r_uint);
+            read(s_buf, s_uint);
+            if (!public_keys[i].on_curve() || (r_uint >= mod) || (s_uint >= mod) || (r_uint == 0) || (s_uint == 0) ||
+                (s_uint * 2 > mod)) {
+                continue;
+            }
+            if (public_keys[i].is_point_at_infinity()) {
+                status[i] = SINGLE;
+                continue;
+            }
+            const uint256_t nonce_x = (sig.v == 29 || sig.v == 30) ? r_uint + mod : r_uint;
+            std::optional<affine_element> nonce;
+            if ((sig.v >= 27 && sig.v <= 30) && nonce_x < uint256_t(Fq::modulus)) {
+                nonce = affine_element::derive_from_x_coordinate(Fq(nonce_x), (sig.v & 1) != 0);
+            }
+            if (!nonce.has_value()) {
+                status[i] = SINGLE;
+                continue;
+            }
+
+            std::vector<uint8_t> message_buffer(messages[i].begin(), messages[i].end());
+            auto ev = Hash::hash(message_buffer);
+            z_values[i] = Fr::serialize_from_buffer(&ev[0]);
+            r_values[i] = Fr(r_uint);
+            s_values[i] = Fr(s_uint);
+            nonces[i] = nonce.value();
+            status[i] = BATCHED;
+        }
+    });
+
+    std::vector<size_t> batched;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        if (status[i] == BATCHED) {
+            batched.push_back(i);
+        }
+    }
+    std::vector<Fr> s_inverses(batched.size());
+    for (size_t k = 0; k < batched.size(); ++k) {
+        s_inverses[k] = s_values[batched[k]];
+    }
+    Fr::batch_invert(std::span<Fr>(s_inverses));
+    // The scalars of G and Q in the equation of each signature
+    std::vector<Fr> u1_values(batched.size());
+    std::vector<Fr> u2_values(batched.size());
+    for (size_t k = 0; k < batched.size(); ++k) {
+        u1_values[k] = z_values[batched[k]] * s_inverses[k];
+        u2_values[k] = r_values[batched[k]] * s_inverses[k];
+    }
+
+    // Check the signatures batched[start..end), whose ranges are split in two when their check fails
+    std::vector<std::pair<size_t, size_t>> pending;
+    if (!batched.empty()) {
+        pending.emplace_back(0, batched.size());
+    }
+    while (!pending.empty()) {
+        const auto [start, end] = pending.back();
+        pending.pop_back();
+        if (end - start < MIN_BATCH_SIZE) {
+            for (size_t k = start; k < end; ++k) {
+                status[batched[k]] = SINGLE;
+            }
+            continue;
+        }
+        std::vector<affine_element> points;
+        std::vector<Fr> scalars;
+        points.reserve(2 * (end - start) + 1);
+        scalars.reserve(2 * (end - start) + 1);
+        Fr generator_scalar = Fr::zero();
+        for (size_t k = start; k < end; ++k) {
+            const Fr batching_scalar = k == start ? Fr::one() : Fr::random_element();
+            generator_scalar += batching_scalar * u1_values[k];
+            points.emplace_back(public_keys[batched[k]]);
+            scalars.emplace_back(batching_scalar * u2_values[k]);
+            points.emplace_back(nonces[batched[k]]);
+            scalars.emplace_back(-batching_scalar);
+        }
+        points.emplace_back(G1::affine_one);
+        scalars.emplace_back(generator_scalar);
+        if (ecdsa_multi_scalar_mul<Fr, G1>(points, scalars).is_point_at_infinity()) {
+            for (size_t k = start; k < end; ++k) {
+                status[batched[k]] = ACCEPTED;
+            }
+        } else {
+            const size_t middle = start + (end - start) / 2;
+            pending.emplace_back(start, middle);
+            pending.emplace_back(middle, end);
+        }
+    }
+
+    run_loop_in_parallel(num_signatures, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            if (status[i] == SINGLE) {
+                const bool valid =
+                    ecdsa_verify_signature<Hash, Fq, Fr, G1>(messages[i], public_keys[i], signatures[i]);
+                status[i] = valid ? ACCEPTED : REJECTED;
+            }
+        }
+    });
+
+    std::vector<bool> result(num_signatures);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        result[i] = status[i] == ACCEPTED;
+    }
+    return result;
+}
 } // namespace bb::crypto
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace bb::crypto {
+/**
+ * @brief Precomputed multiples of a fixed generator, for scalar multiplications without doublings
+ *
+ * @details A scalar is written in signed base 2^WINDOW_BITS, with digits in [-2^(WINDOW_BITS-1), 2^(WINDOW_BITS-1)].
+ *          For each window k, the table holds d.2^(WINDOW_BITS.k).[g] for d = 1, ..., 2^(WINDOW_BITS-1) in affine
+ *          form, so that a multiplication is the sum of one (possibly negated) table point per non-zero digit:
+ *          NUM_WINDOWS mixed additions, instead of the ~256 doublings and additions of a variable-base multiplication.
+ *
+ *          With WINDOW_BITS = 5 a table has 52 * 16 points, i.e. 52KB for Grumpkin.
+ *
+ * @tparam Curve
+ */
+template <typename Curve> class fixed_base_table {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+
+    static constexpr size_t WINDOW_BITS = 5;
+    static constexpr size_t POINTS_PER_WINDOW = 1UL << (WINDOW_BITS - 1);
+    // Enough windows for any 256-bit scalar, plus the carry out of its top window
+    static constexpr size_t NUM_WINDOWS = (256 + WINDOW_BITS) / WINDOW_BITS;
+
+    explicit fixed_base_table(const AffineElement& generator)
+    {
+        std::vector<Element> multiples(NUM_WINDOWS * POINTS_PER_WINDOW);
+        Element window_base(generator);
+        for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+            Element* row = &multiples[window * POINTS_PER_WINDOW];
+            row[0] = window_base;
+            for (size_t d = 1; d < POINTS_PER_WINDOW; ++d) {
+                row[d] = row[d - 1] + window_base;
+            }
+            // 2^WINDOW_BITS.base = 2.(2^(WINDOW_BITS-1).base)
+            window_base = row[POINTS_PER_WINDOW - 1].dbl();
+        }
+        Element::batch_normalize(multiples.data(), multiples.size());
+        points.reserve(multiples.size());
+        for (const Element& multiple : multiples) {
+            points.emplace_back(multiple.x, multiple.y);
+        }
+    }
+
+    /**
+     * @brief Compute scalar.[g] in Jacobian form
+     */
+    [[nodiscard]] Element mul(const uint256_t& scalar) const
+    {
+        constexpr uint64_t window_mask = (1UL << WINDOW_BITS) - 1;
+        Element result;
+        result.self_set_infinity();
+        uint64_t carry = 0;
+        for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+            const size_t start = window * WINDOW_BITS;
+            const uint64_t bits = start < 256 ? (scalar >> start).data[0] & window_mask : 0;
+            const uint64_t digit = bits + carry;
+            if (digit == 0) {
+                continue;
+            }
+            // Digits above 2^(WINDOW_BITS-1) become digit - 2^WINDOW_BITS, carrying one into the next window
+            carry = digit > POINTS_PER_WINDOW ? 1 : 0;
+            if (carry == 0) {
+                result += points[window * POINTS_PER_WINDOW + digit - 1];
+            } else if (digit < (1UL << WINDOW_BITS)) {
+                result -= points[window * POINTS_PER_WINDOW + ((1UL << WINDOW_BITS) - digit) - 1];
+            }
+        }
+        return result;
+    }
+
+  private:
+    // points[k * POINTS_PER_WINDOW + d - 1] = d.2^(WINDOW_BITS.k).[g]
+    std::vector<AffineElement> points;
+};
+} // namespace bb::crypto
@@ -3,9 +3,14 @@
 #include "barretenberg/common/container.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "fixed_base_table.hpp"
 #include <array>
 #include <map>
+#include <memory>
 #include <optional>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
 
 namespace bb::crypto {
 /**
@@ -34,6 +39,13 @@ namespace bb::crypto {
  *             more generators are required.
  *             i.e. either each process must use an independent `generator_data` object or the author must KNOW that
  *             `generator_data` will not be extended by any process
+ *             (The map is guarded by a mutex, but extending a list of generators invalidates the views returned
+ *             for it.)
+ *
+ *          `generator_data` also caches a `fixed_base_table` for each (domain separator, generator index) it is asked
+ *          for, built on first use, which the native Pedersen methods multiply with. At most MAX_NUM_FIXED_BASE_TABLES
+ *          tables are cached, past which the other generators have no table and are multiplied by as variable bases.
+ *          The tables are never removed, so pointers to them stay valid.
  *
  * @tparam Curve
  */
@@ -43,7 +55,10 @@ template <typename Curve> class generator_data {
     using AffineElement = typename Curve::AffineElement;
     using GeneratorList = std::vector<AffineElement>;
     using GeneratorView = std::span<AffineElement const>;
+    using FixedBaseTable = fixed_base_table<Curve>;
     static inline constexpr size_t DEFAULT_NUM_GENERATORS = 8;
+    // About 6.5MB of Grumpkin tables (see fixed_base_table)
+    static inline constexpr size_t MAX_NUM_FIXED_BASE_TABLES = 128;
     static inline constexpr std::string_view DEFAULT_DOMAIN_SEPARATOR = "DEFAULT_DOMAIN_SEPARATOR";
     inline constexpr generator_data() = default;
 
@@ -71,6 +86,82 @@ template <typename Curve> class generator_data {
             return GeneratorView{ precomputed_generators.data() + generator_offset, num_generators };
         }
 
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        return get_with_lock_held(num_generators, generator_offset, domain_separator);
+    }
+
+    /**
+     * @brief Get a copy of the generator get(1, generator_index, domain_separator)[0], which unlike a view of it
+     * remains valid if another thread extends the list of generators
+     */
+    [[nodiscard]] inline AffineElement get_generator(
+        const size_t generator_index, const std::string_view domain_separator = DEFAULT_DOMAIN_SEPARATOR) const
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        return get_with_lock_held(1, generator_index, domain_separator)[0];
+    }
+
+    /**
+     * @brief Get the fixed-base table of a generator, i.e. of get(1, generator_index, domain_separator)[0], or nullptr
+     * if it has none because MAX_NUM_FIXED_BASE_TABLES tables are cached already
+     *
+     * @details The table is built on the first call for the generator, which costs about 1000 group additions.
+     */
+    [[nodiscard]] inline const FixedBaseTable* get_fixed_base_table(
+        const size_t generator_index, const std::string_view domain_separator = DEFAULT_DOMAIN_SEPARATOR) const
+    {
+        std::pair<std::string, size_t> key{ std::string(domain_separator), generator_index };
+        AffineElement generator;
+        {
+#ifndef NO_MULTITHREADING
+            std::unique_lock<std::mutex> lock(mutex);
+#endif
+            if (!fixed_base_tables.has_value()) {
+                fixed_base_tables = std::map<std::pair<std::string, size_t>, std::unique_ptr<FixedBaseTable>>();
+            }
+            auto it = fixed_base_tables->find(key);
+            if (it != fixed_base_tables->end()) {
+                return it->second.get();
+            }
+            if (fixed_base_tables->size() >= MAX_NUM_FIXED_BASE_TABLES) {
+                return nullptr;
+            }
+            generator = get_with_lock_held(1, generator_index, domain_separator)[0];
+        }
+        // Build the table without holding the lock; if another thread built it meanwhile, keep theirs
+        auto table = std::make_unique<FixedBaseTable>(generator);
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        auto it = fixed_base_tables->find(key);
+        if (it != fixed_base_tables->end()) {
+            return it->second.get();
+        }
+        // Other threads may have filled the cache meanwhile
+        if (fixed_base_tables->size() >= MAX_NUM_FIXED_BASE_TABLES) {
+            return nullptr;
+        }
+        return fixed_base_tables->emplace(std::move(key), std::move(table)).first->second.get();
+    }
+
+    // getter method for `default_data`. Object exists as a singleton so we don't need a smart pointer.
+    // Don't call `delete` on this pointer.
+    static inline generator_data* get_default_generators() { return &default_data; }
+
+  private:
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static inline constinit generator_data default_data = generator_data();
+
+    // The generators of `get`, which must be called with `mutex` locked
+    [[nodiscard]] inline GeneratorView get_with_lock_held(const size_t num_generators,
+                                                          const size_t generator_offset,
+                                                          const std::string_view domain_separator) const
+    {
+        const bool is_default_domain = domain_separator == DEFAULT_DOMAIN_SEPARATOR;
         if (!generator_map.has_value()) {
             generator_map = std::map<std::string, GeneratorList>();
         }
@@ -106,14 +197,6 @@ template <typename Curve> class generator_data {
         return GeneratorView{ generators.data() + generator_offset, num_generators };
     }
 
-    // getter method for `default_data`. Object exists as a singleton so we don't need a smart pointer.
-    // Don't call `delete` on this pointer.
-    static inline generator_data* get_default_generators() { return &default_data; }
-
-  private:
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-    static inline constinit generator_data default_data = generator_data();
-
     // We mark the following two params as `mutable` so that our `get` method can be marked `const`.
     // A non-const getter creates downstream issues as all const methods that use a non-const `get`
     // would need to be marked const.
@@ -128,6 +211,14 @@ template <typename Curve> class generator_data {
     // We wrap the std::map in a `std::optional` so that we can construct `generator_data` at compile time.
     // This allows us to mark `default_data` as `constinit`, which prevents static initialization ordering fiasco
     mutable std::optional<std::map<std::string, GeneratorList>> generator_map = {};
+
+    // The fixed-base tables, by domain separator and generator index
+    mutable std::optional<std::map<std::pair<std::string, size_t>, std::unique_ptr<FixedBaseTable>>>
+        fixed_base_tables = {};
+#ifndef NO_MULTITHREADING
+    // Guards generator_map and fixed_base_tables
+    mutable std::mutex mutex;
+#endif
 };
 
 template <typename Curve> struct GeneratorContext {
@@ -42,4 +42,42 @@ TEST(GeneratorContext, DeriveDefaultGenerators)
     }
 }
 
-} // namespace bb::crypto
\ No newline at end of file
+TEST(GeneratorContext, FixedBaseTableMatchesScalarMultiplication)
+{
+    using Element = grumpkin::g1::element;
+    generator_data<curve::Grumpkin> data;
+    const auto generator = data.get(1, 3)[0];
+    const auto* table = data.get_fixed_base_table(3);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table, data.get_fixed_base_table(3));
+
+    std::vector<uint256_t> scalars{ 0, 1, 15, 16, 17, 31, 32, uint256_t(grumpkin::fq::modulus) - 1 };
+    // Scalars of all 1s exercise the carries from negative digits
+    scalars.emplace_back(uint256_t(UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX));
+    scalars.emplace_back(uint256_t(UINT64_MAX, UINT64_MAX, UINT64_MAX, 0x3fffffffffffffff));
+    for (size_t i = 0; i < 8; ++i) {
+        scalars.emplace_back(uint256_t(grumpkin::fq::random_element()));
+    }
+    for (const auto& scalar : scalars) {
+        const Element expected = Element(generator) * grumpkin::fr(scalar);
+        EXPECT_EQ(Element(table->mul(scalar)).normalize(), expected.normalize()) << scalar;
+    }
+}
+
+TEST(GeneratorContext, FixedBaseTableCacheIsBounded)
+{
+    using Data = generator_data<curve::Grumpkin>;
+    Data data;
+    for (size_t i = 0; i < Data::MAX_NUM_FIXED_BASE_TABLES; ++i) {
+        EXPECT_NE(data.get_fixed_base_table(i, "generator_data_test"), nullptr);
+    }
+    // The cached tables are still returned, but no new one is built
+    EXPECT_NE(data.get_fixed_base_table(0, "generator_data_test"), nullptr);
+    EXPECT_EQ(data.get_fixed_base_table(Data::MAX_NUM_FIXED_BASE_TABLES, "generator_data_test"), nullptr);
+    EXPECT_EQ(data.get_fixed_base_table(0), nullptr);
+
+    const size_t index = Data::MAX_NUM_FIXED_BASE_TABLES + 5;
+    EXPECT_EQ(data.get_generator(index, "generator_data_test"), data.get(1, index, "generator_data_test")[0]);
+}
+
+} // namespace bb::crypto
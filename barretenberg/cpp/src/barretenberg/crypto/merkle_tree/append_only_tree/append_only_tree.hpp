@@ -1,5 +1,6 @@
 #pragma once
 #include "../hash_path.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::crypto::merkle_tree {
 
@@ -26,6 +27,8 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
 
     /**
      * @brief Adds the given set of values to the end of the tree
+     * @details Each level of the subtree spanned by the new values is hashed in parallel, and the new nodes are then
+     * written to the store in one batch per level.
      */
     virtual fr add_values(const std::vector<fr>& values);
 
@@ -51,6 +54,8 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
 
   protected:
     fr get_element_or_zero(size_t level, const index_t& index) const;
+    index_t find_size_in_store() const;
+    static void for_each_node(size_t num_nodes, const std::function<void(size_t)>& func);
 
     void write_node(size_t level, const index_t& index, const fr& value);
     std::pair<bool, fr> read_node(size_t level, const index_t& index) const;
@@ -79,6 +84,13 @@ AppendOnlyTree<Store, HashingPolicy>::AppendOnlyTree(Store& store, size_t depth,
     }
     zero_hashes_[0] = current;
     root_ = current;
+
+    // Resume the tree held by a persistent store
+    const std::pair<bool, fr> stored_root = read_node(0, 0);
+    if (stored_root.first) {
+        root_ = stored_root.second;
+        size_ = find_size_in_store();
+    }
 }
 
 template <typename Store, typename HashingPolicy> AppendOnlyTree<Store, HashingPolicy>::~AppendOnlyTree() {}
@@ -124,43 +136,75 @@ template <typename Store, typename HashingPolicy> fr AppendOnlyTree<Store, Hashi
 template <typename Store, typename HashingPolicy>
 fr AppendOnlyTree<Store, HashingPolicy>::add_values(const std::vector<fr>& values)
 {
-    index_t index = size();
-    size_t number_to_insert = values.size();
-    size_t level = depth_;
-    std::vector<fr> hashes = values;
-
-    // Add the values at the leaf nodes of the tree
-    for (size_t i = 0; i < number_to_insert; ++i) {
-        write_node(level, index + i, hashes[i]);
+    if (values.empty()) {
+        return root_;
     }
-
-    // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
-        index >>= 1;
-        --level;
-        for (size_t i = 0; i < number_to_insert; ++i) {
-            hashes[i] = HashingPolicy::hash_pair(hashes[i * 2], hashes[i * 2 + 1]);
-            write_node(level, index + i, hashes[i]);
+    // The new nodes of each level are those in [start, end). Only the nodes on the edges of that range can have a
+    // sibling outside of it, which we read from the store.
+    size_t start = size_t(size_);
+    size_t end = start + values.size();
+    std::vector<size_t> level_starts(depth_ + 1);
+    std::vector<std::vector<std::vector<uint8_t>>> level_nodes(depth_ + 1);
+    std::vector<fr> hashes = values;
+    for (size_t level = depth_;; --level) {
+        level_starts[level] = start;
+        auto& nodes = level_nodes[level];
+        nodes.resize(hashes.size());
+        for_each_node(hashes.size(), [&](size_t i) { write(nodes[i], hashes[i]); });
+        if (level == 0) {
+            break;
         }
+
+        const size_t parent_start = start >> 1;
+        const size_t parent_end = ((end - 1) >> 1) + 1;
+        const fr left_sibling = (start & 1) != 0 ? get_element_or_zero(level, start - 1) : fr::zero();
+        const fr right_sibling = (end & 1) != 0 ? get_element_or_zero(level, end) : fr::zero();
+        const auto child = [&](size_t index) -> const fr& {
+            if (index < start) {
+                return left_sibling;
+            }
+            return index < end ? hashes[index - start] : right_sibling;
+        };
+        std::vector<fr> parents(parent_end - parent_start);
+        for_each_node(parents.size(), [&](size_t i) {
+            const size_t parent = parent_start + i;
+            parents[i] = HashingPolicy::hash_pair(child(2 * parent), child(2 * parent + 1));
+        });
+        hashes = std::move(parents);
+        start = parent_start;
+        end = parent_end;
     }
 
-    // Hash from the root of the sub-tree to the root of the overall tree
-    fr new_hash = hashes[0];
-    while (level > 0) {
-        bool is_right = bool(index & 0x01);
-        fr left_hash = is_right ? get_element_or_zero(level, index - 1) : new_hash;
-        fr right_hash = is_right ? new_hash : get_element_or_zero(level, index + 1);
-        new_hash = HashingPolicy::hash_pair(left_hash, right_hash);
-        index >>= 1;
-        --level;
-        write_node(level, index, new_hash);
+    for (size_t level = 0; level <= depth_; ++level) {
+        store_.put_batch(level, level_starts[level], level_nodes[level]);
     }
     size_ += values.size();
-    root_ = new_hash;
+    root_ = hashes[0];
     return root_;
 }
 
+/**
+ * @brief Runs `func` on each of `num_nodes` nodes, splitting them between threads when there are enough of them
+ */
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::for_each_node(size_t num_nodes, const std::function<void(size_t)>& func)
+{
+    const size_t num_threads = calculate_num_threads(num_nodes);
+    if (num_threads == 1) {
+        for (size_t i = 0; i < num_nodes; ++i) {
+            func(i);
+        }
+        return;
+    }
+    const size_t nodes_per_thread = (num_nodes + num_threads - 1) / num_threads;
+    parallel_for(num_threads, [&](size_t thread_index) {
+        const size_t thread_end = std::min(num_nodes, (thread_index + 1) * nodes_per_thread);
+        for (size_t i = thread_index * nodes_per_thread; i < thread_end; ++i) {
+            func(i);
+        }
+    });
+}
+
 template <typename Store, typename HashingPolicy>
 fr AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero(size_t level, const index_t& index) const
 {
@@ -172,6 +216,35 @@ fr AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero(size_t level, const
     return zero_hashes_[level];
 }
 
+/**
+ * @brief Finds the size of a non-empty tree held by the store
+ * @details Leaves are appended from the left, so the size is the index of the first missing leaf. We find it by
+ * doubling and then bisecting, in O(depth) reads.
+ */
+template <typename Store, typename HashingPolicy>
+index_t AppendOnlyTree<Store, HashingPolicy>::find_size_in_store() const
+{
+    const index_t capacity = index_t(1) << depth_;
+    index_t present = 0;
+    index_t missing = 1;
+    while (missing < capacity && read_node(depth_, missing).first) {
+        present = missing;
+        missing <<= 1;
+    }
+    if (missing > capacity) {
+        missing = capacity;
+    }
+    while (missing - present > 1) {
+        const index_t middle = (present + missing) >> 1;
+        if (read_node(depth_, middle).first) {
+            present = middle;
+        } else {
+            missing = middle;
+        }
+    }
+    return missing;
+}
+
 template <typename Store, typename HashingPolicy>
 void AppendOnlyTree<Store, HashingPolicy>::write_node(size_t level, const index_t& index, const fr& value)
 {
@@ -125,3 +125,26 @@ TEST(stdlib_append_only_tree, can_be_filled)
     EXPECT_EQ(tree.get_hash_path(0), memdb.get_hash_path(0));
     EXPECT_EQ(tree.get_hash_path(7), memdb.get_hash_path(7));
 }
+
+TEST(stdlib_append_only_tree, can_add_batches_of_any_size)
+{
+    constexpr size_t depth = 10;
+    ArrayStore store(depth);
+    AppendOnlyTree<ArrayStore, Poseidon2HashPolicy> tree(store, depth);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Batches that neither start nor end on a subtree boundary, some large enough to be hashed in parallel
+    size_t index = 0;
+    for (const size_t batch_size : { 3UL, 1UL, 6UL, 100UL, 37UL, 255UL, 2UL }) {
+        std::vector<fr> batch(VALUES.begin() + static_cast<std::ptrdiff_t>(index),
+                              VALUES.begin() + static_cast<std::ptrdiff_t>(index + batch_size));
+        for (size_t i = 0; i < batch_size; ++i) {
+            memdb.update_element(index + i, batch[i]);
+        }
+        EXPECT_EQ(tree.add_values(batch), memdb.root());
+        index += batch_size;
+        EXPECT_EQ(tree.size(), index);
+        EXPECT_EQ(tree.get_hash_path(index - 1), memdb.get_hash_path(index - 1));
+        EXPECT_EQ(tree.get_hash_path(index / 2), memdb.get_hash_path(index / 2));
+    }
+}
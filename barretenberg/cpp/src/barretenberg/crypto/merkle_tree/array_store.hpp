@@ -22,8 +22,17 @@ class ArrayStore {
     {
         map_[level][index] = std::make_pair(true, data);
     }
+    void put_batch(size_t level, size_t start_index, const std::vector<std::vector<uint8_t>>& data)
+    {
+        for (size_t i = 0; i < data.size(); ++i) {
+            map_[level][start_index + i] = std::make_pair(true, data[i]);
+        }
+    }
     bool get(size_t level, size_t index, std::vector<uint8_t>& data) const
     {
+        if (index >= map_[level].size()) {
+            return false;
+        }
         const std::pair<bool, std::vector<uint8_t>>& slot = map_[level][index];
         if (slot.first) {
             data = slot.second;
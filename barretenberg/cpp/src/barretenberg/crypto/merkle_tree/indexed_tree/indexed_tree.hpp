@@ -105,6 +105,19 @@ class IndexedTree : public AppendOnlyTree<Store, HashingPolicy> {
     using AppendOnlyTree<Store, HashingPolicy>::depth;
 
   private:
+    /**
+     * @brief Leaves stores that live in the tree's store (e.g. PersistentLeavesStore) are constructed from it, others
+     * are default constructed
+     */
+    static LeavesStore make_leaves_store(Store& store)
+    {
+        if constexpr (std::is_constructible_v<LeavesStore, Store&>) {
+            return LeavesStore(store);
+        } else {
+            return LeavesStore();
+        }
+    }
+
     fr update_leaf_and_hash_to_root(const index_t& index, const indexed_leaf& leaf);
     fr update_leaf_and_hash_to_root(const index_t& index,
                                     const indexed_leaf& leaf,
@@ -132,6 +145,7 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
                                                             size_t initial_size,
                                                             uint8_t tree_id)
     : AppendOnlyTree<Store, HashingPolicy>(store, depth, tree_id)
+    , leaves_(make_leaves_store(store))
 {
     ASSERT(initial_size > 0);
     zero_hashes_.resize(depth + 1);
@@ -144,6 +158,10 @@ IndexedTree<Store, LeavesStore, HashingPolicy>::IndexedTree(Store& store,
         current = HashingPolicy::hash_pair(current, current);
     }
     zero_hashes_[0] = current;
+    if (leaves_.get_size() > 0) {
+        // The store already holds the tree
+        return;
+    }
     // Inserts the initial set of leaves as a chain in incrementing value order
     for (size_t i = 0; i < initial_size; ++i) {
         // Insert the zero leaf to the `leaves` and also to the tree at index 0.
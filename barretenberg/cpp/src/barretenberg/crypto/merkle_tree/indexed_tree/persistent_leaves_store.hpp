@@ -0,0 +1,43 @@
+#pragma once
+#include "../persistent_store.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "indexed_leaf.hpp"
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief The leaves of an IndexedTree, held in the PersistentStore that also holds its nodes, so that both are
+ * committed and rolled back together. IndexedTree constructs it from its store.
+ *
+ */
+class PersistentLeavesStore {
+  public:
+    PersistentLeavesStore(PersistentStore& store)
+        : store_(store)
+    {}
+
+    index_t get_size() const { return store_.get_leaf_count(); }
+
+    std::pair<bool, index_t> find_low_value(const bb::fr& new_value) const { return store_.find_low_value(new_value); }
+
+    indexed_leaf get_leaf(const index_t& index) const
+    {
+        indexed_leaf leaf;
+        if (!store_.get_leaf(index, leaf)) {
+            throw_or_abort("PersistentLeavesStore: leaf does not exist");
+        }
+        return leaf;
+    }
+
+    void set_at_index(const index_t& index, const indexed_leaf& leaf, bool add_to_index)
+    {
+        store_.put_leaf(index, leaf, add_to_index);
+    }
+
+    void append_leaf(const indexed_leaf& leaf) { store_.put_leaf(get_size(), leaf, true); }
+
+  private:
+    PersistentStore& store_;
+};
+
+} // namespace bb::crypto::merkle_tree
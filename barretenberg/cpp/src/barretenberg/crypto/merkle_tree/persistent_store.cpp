@@ -0,0 +1,991 @@
+#include "persistent_store.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <set>
+#ifndef __wasm__
+#include <cerrno>
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::crypto::merkle_tree {
+
+namespace {
+
+constexpr uint64_t MANIFEST_MAGIC = 0x5453464e414d5442; // "BTMANFST"
+constexpr uint64_t JOURNAL_MAGIC = 0x4c414e52554f4a42;  // "BJOURNAL"
+constexpr uint64_t STORE_VERSION = 1;
+constexpr size_t INDEX_BITS = 56;
+constexpr uint64_t INDEX_MASK = (1UL << INDEX_BITS) - 1;
+// A run entry is a value followed by the index of its leaf
+constexpr size_t RUN_ENTRY_SIZE = sizeof(uint256_t) + sizeof(uint64_t);
+// The number of entries that are read or written at once when streaming a run
+constexpr size_t RUN_CHUNK_SIZE = 1UL << 15;
+
+constexpr uint8_t JOURNAL_END = 0;
+constexpr uint8_t JOURNAL_NODE = 1;
+constexpr uint8_t JOURNAL_LEAF = 2;
+
+const std::string MANIFEST_FILE = "MANIFEST";
+const std::string MANIFEST_TMP_FILE = "MANIFEST.tmp";
+const std::string JOURNAL_FILE = "JOURNAL";
+const std::string LEAVES_FILE = "leaves.dat";
+
+static_assert(sizeof(fr) == 32 && sizeof(uint256_t) == 32);
+
+#ifndef __wasm__
+int open_file(const std::string& path, bool truncate = false)
+{
+    const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | (truncate ? O_TRUNC : 0), 0644);
+    if (fd < 0) {
+        throw_or_abort(format("PersistentStore: cannot open ", path, ": ", std::strerror(errno)));
+    }
+    return fd;
+}
+
+void close_file(int fd)
+{
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+/**
+ * @brief Reads up to `size` bytes at `offset`, returning fewer only at the end of the file.
+ */
+size_t read_at(int fd, uint64_t offset, void* data, size_t size)
+{
+    size_t total = 0;
+    while (total < size) {
+        const ssize_t result =
+            ::pread(fd, static_cast<uint8_t*>(data) + total, size - total, static_cast<off_t>(offset + total));
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_or_abort(format("PersistentStore: read failed: ", std::strerror(errno)));
+        }
+        if (result == 0) {
+            break;
+        }
+        total += static_cast<size_t>(result);
+    }
+    return total;
+}
+
+void write_at(int fd, uint64_t offset, const void* data, size_t size)
+{
+    size_t total = 0;
+    while (total < size) {
+        const ssize_t result =
+            ::pwrite(fd, static_cast<const uint8_t*>(data) + total, size - total, static_cast<off_t>(offset + total));
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_or_abort(format("PersistentStore: write failed: ", std::strerror(errno)));
+        }
+        total += static_cast<size_t>(result);
+    }
+}
+
+void sync_file(int fd)
+{
+    if (::fsync(fd) != 0) {
+        throw_or_abort(format("PersistentStore: fsync failed: ", std::strerror(errno)));
+    }
+}
+
+uint64_t file_size(int fd)
+{
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        throw_or_abort(format("PersistentStore: fstat failed: ", std::strerror(errno)));
+    }
+    return static_cast<uint64_t>(st.st_size);
+}
+
+bool file_exists(const std::string& path)
+{
+    return std::filesystem::exists(path);
+}
+
+void remove_file(const std::string& path)
+{
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+void rename_file(const std::string& from, const std::string& to)
+{
+    if (::rename(from.c_str(), to.c_str()) != 0) {
+        throw_or_abort(format("PersistentStore: cannot rename ", from, ": ", std::strerror(errno)));
+    }
+}
+
+// Makes the creation, renaming and removal of files in a directory durable
+void sync_directory(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        throw_or_abort(format("PersistentStore: cannot open ", path, ": ", std::strerror(errno)));
+    }
+    ::fsync(fd);
+    ::close(fd);
+}
+
+void create_directory(const std::string& path)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(path, ec);
+    if (ec) {
+        throw_or_abort(format("PersistentStore: cannot create ", path, ": ", ec.message()));
+    }
+}
+
+std::vector<std::string> list_directory(const std::string& path)
+{
+    std::vector<std::string> names;
+    for (const auto& entry : std::filesystem::directory_iterator(path)) {
+        names.push_back(entry.path().filename().string());
+    }
+    return names;
+}
+#else
+[[noreturn]] void unsupported()
+{
+    throw_or_abort("PersistentStore is not supported in wasm builds.");
+}
+int open_file(const std::string&, bool = false)
+{
+    unsupported();
+}
+void close_file(int) {}
+size_t read_at(int, uint64_t, void*, size_t)
+{
+    unsupported();
+}
+void write_at(int, uint64_t, const void*, size_t)
+{
+    unsupported();
+}
+void sync_file(int)
+{
+    unsupported();
+}
+uint64_t file_size(int)
+{
+    unsupported();
+}
+bool file_exists(const std::string&)
+{
+    unsupported();
+}
+void remove_file(const std::string&)
+{
+    unsupported();
+}
+void rename_file(const std::string&, const std::string&)
+{
+    unsupported();
+}
+void sync_directory(const std::string&)
+{
+    unsupported();
+}
+void create_directory(const std::string&)
+{
+    unsupported();
+}
+std::vector<std::string> list_directory(const std::string&)
+{
+    unsupported();
+}
+#endif
+
+/**
+ * @brief A 64-bit FNV-1a style hash over words, used to detect torn journals and manifests.
+ */
+uint64_t checksum(const uint8_t* data, size_t size)
+{
+    constexpr uint64_t PRIME = 0x100000001b3;
+    uint64_t hash = 0xcbf29ce484222325;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+        hash = (hash ^ word) * PRIME;
+        hash ^= hash >> 29;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * PRIME;
+    }
+    return hash;
+}
+
+template <typename T> void append(std::vector<uint8_t>& buf, const T& value)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buf.insert(buf.end(), bytes, bytes + sizeof(T));
+}
+
+class BufferReader {
+  public:
+    BufferReader(const uint8_t* data, size_t size)
+        : data_(data)
+        , size_(size)
+    {}
+
+    bool read_bytes(void* out, size_t size)
+    {
+        if (size_ - pos_ < size) {
+            return false;
+        }
+        std::memcpy(out, data_ + pos_, size);
+        pos_ += size;
+        return true;
+    }
+    template <typename T> bool read(T& value) { return read_bytes(&value, sizeof(T)); }
+    size_t position() const { return pos_; }
+
+  private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+void serialize_leaf(const indexed_leaf& leaf, uint8_t* out)
+{
+    std::memcpy(out, static_cast<const void*>(&leaf.value), sizeof(fr));
+    std::memcpy(out + sizeof(fr), static_cast<const void*>(&leaf.nextIndex), sizeof(uint256_t));
+    std::memcpy(out + sizeof(fr) + sizeof(uint256_t), static_cast<const void*>(&leaf.nextValue), sizeof(fr));
+}
+
+void deserialize_leaf(const uint8_t* in, indexed_leaf& leaf)
+{
+    std::memcpy(static_cast<void*>(&leaf.value), in, sizeof(fr));
+    std::memcpy(static_cast<void*>(&leaf.nextIndex), in + sizeof(fr), sizeof(uint256_t));
+    std::memcpy(static_cast<void*>(&leaf.nextValue), in + sizeof(fr) + sizeof(uint256_t), sizeof(fr));
+}
+
+/**
+ * @brief Writes consecutive records, coalescing runs of consecutive indices into single writes.
+ */
+class RecordWriter {
+  public:
+    RecordWriter(int fd, size_t record_size)
+        : fd_(fd)
+        , record_size_(record_size)
+    {}
+    uint8_t* add(uint64_t index)
+    {
+        if (!buffer_.empty() && (index != next_index_ || buffer_.size() >= (1UL << 20))) {
+            flush();
+        }
+        if (buffer_.empty()) {
+            first_index_ = index;
+        }
+        next_index_ = index + 1;
+        buffer_.resize(buffer_.size() + record_size_);
+        uint8_t* record = &buffer_[buffer_.size() - record_size_];
+        record[0] = 1;
+        return record + 1;
+    }
+
+    void flush()
+    {
+        if (!buffer_.empty()) {
+            write_at(fd_, first_index_ * record_size_, buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+    }
+
+  private:
+    int fd_;
+    size_t record_size_;
+    uint64_t first_index_ = 0;
+    uint64_t next_index_ = 0;
+    std::vector<uint8_t> buffer_;
+};
+
+/**
+ * @brief Streams the entries of a run in order.
+ */
+class RunReader {
+  public:
+    RunReader(int fd, uint64_t size)
+        : fd_(fd)
+        , size_(size)
+    {}
+
+    bool valid() const { return position_ < size_; }
+    const uint256_t& value() const { return value_; }
+    uint64_t index() const { return index_; }
+
+    void next()
+    {
+        ++position_;
+        load();
+    }
+
+    void load()
+    {
+        if (position_ >= size_) {
+            return;
+        }
+        if (position_ >= buffer_start_ + buffer_count_ || position_ < buffer_start_) {
+            buffer_start_ = position_;
+            buffer_count_ = std::min<uint64_t>(RUN_CHUNK_SIZE, size_ - position_);
+            buffer_.resize(buffer_count_ * RUN_ENTRY_SIZE);
+            if (read_at(fd_, buffer_start_ * RUN_ENTRY_SIZE, buffer_.data(), buffer_.size()) != buffer_.size()) {
+                throw_or_abort("PersistentStore: index run is truncated");
+            }
+        }
+        const uint8_t* entry = &buffer_[(position_ - buffer_start_) * RUN_ENTRY_SIZE];
+        std::memcpy(static_cast<void*>(&value_), entry, sizeof(uint256_t));
+        std::memcpy(&index_, entry + sizeof(uint256_t), sizeof(uint64_t));
+    }
+
+  private:
+    int fd_;
+    uint64_t size_;
+    uint64_t position_ = 0;
+    uint64_t buffer_start_ = 0;
+    uint64_t buffer_count_ = 0;
+    std::vector<uint8_t> buffer_;
+    uint256_t value_;
+    uint64_t index_ = 0;
+};
+
+/**
+ * @brief Writes the entries of a run in order, recording the value of the first entry of each block.
+ */
+class RunWriter {
+  public:
+    RunWriter(int fd, std::vector<uint256_t>& fences)
+        : fd_(fd)
+        , fences_(fences)
+    {}
+
+    void add(const uint256_t& value, uint64_t index)
+    {
+        if (count_ % PersistentStore::RUN_BLOCK_SIZE == 0) {
+            fences_.push_back(value);
+        }
+        append(buffer_, value);
+        append(buffer_, index);
+        ++count_;
+        if (buffer_.size() >= RUN_CHUNK_SIZE * RUN_ENTRY_SIZE) {
+            flush();
+        }
+    }
+
+    uint64_t finish()
+    {
+        flush();
+        sync_file(fd_);
+        return count_;
+    }
+
+  private:
+    void flush()
+    {
+        write_at(fd_, written_, buffer_.data(), buffer_.size());
+        written_ += buffer_.size();
+        buffer_.clear();
+    }
+
+    int fd_;
+    std::vector<uint256_t>& fences_;
+    std::vector<uint8_t> buffer_;
+    uint64_t written_ = 0;
+    uint64_t count_ = 0;
+};
+
+} // namespace
+
+PersistentStore::PersistentStore(std::string path, size_t levels)
+    : path_(std::move(path))
+    , levels_(levels)
+{
+    create_directory(path_);
+    for (size_t level = 0; level <= levels_; ++level) {
+        level_fds_.push_back(open_file(file_path("level_" + std::to_string(level) + ".dat")));
+    }
+    leaves_fd_ = open_file(file_path(LEAVES_FILE));
+
+    load_manifest();
+    recover_journal();
+
+    // Remove the runs written by an interrupted commit or left behind by an interrupted merge
+    std::set<uint64_t> live_runs;
+    for (const auto& info : manifest_.runs) {
+        live_runs.insert(info.id);
+    }
+    for (const auto& name : list_directory(path_)) {
+        if (name == MANIFEST_TMP_FILE) {
+            remove_file(file_path(name));
+        }
+        if (name.starts_with("index_") && name.ends_with(".run")) {
+            const auto id = std::stoull(name.substr(6, name.size() - 10));
+            if (!live_runs.contains(id)) {
+                remove_file(file_path(name));
+            }
+        }
+    }
+
+    for (const auto& info : manifest_.runs) {
+        runs_.push_back(open_run(info));
+    }
+    push_layer(manifest_.leaf_count);
+}
+
+PersistentStore::~PersistentStore()
+{
+    for (const auto fd : level_fds_) {
+        close_file(fd);
+    }
+    close_file(leaves_fd_);
+    for (const auto& run : runs_) {
+        close_file(run.fd);
+    }
+}
+
+uint64_t PersistentStore::node_key(size_t level, size_t index)
+{
+    ASSERT(index <= INDEX_MASK);
+    return (static_cast<uint64_t>(level) << INDEX_BITS) | static_cast<uint64_t>(index);
+}
+
+std::string PersistentStore::file_path(const std::string& name) const
+{
+    return path_ + "/" + name;
+}
+
+std::string PersistentStore::run_path(uint64_t id) const
+{
+    return file_path("index_" + std::to_string(id) + ".run");
+}
+
+void PersistentStore::put(size_t level, size_t index, const std::vector<uint8_t>& data)
+{
+    ASSERT(level <= levels_ && data.size() == NODE_SIZE);
+    NodeData node;
+    std::copy(data.begin(), data.end(), node.begin());
+    std::unique_lock lock(layers_mutex_);
+    layers_.back().nodes[node_key(level, index)] = node;
+}
+
+void PersistentStore::put_batch(size_t level, size_t start_index, const std::vector<std::vector<uint8_t>>& data)
+{
+    ASSERT(level <= levels_);
+    std::unique_lock lock(layers_mutex_);
+    auto& nodes = layers_.back().nodes;
+    for (size_t i = 0; i < data.size(); ++i) {
+        ASSERT(data[i].size() == NODE_SIZE);
+        NodeData& node = nodes[node_key(level, start_index + i)];
+        std::copy(data[i].begin(), data[i].end(), node.begin());
+    }
+}
+
+bool PersistentStore::get(size_t level, size_t index, std::vector<uint8_t>& data) const
+{
+    ASSERT(level <= levels_);
+    NodeData node;
+    bool found = false;
+    {
+        std::shared_lock lock(layers_mutex_);
+        const uint64_t key = node_key(level, index);
+        for (auto layer = layers_.rbegin(); layer != layers_.rend() && !found; ++layer) {
+            const auto it = layer->nodes.find(key);
+            if (it != layer->nodes.end()) {
+                node = it->second;
+                found = true;
+            }
+        }
+    }
+    if (!found && !read_node(level, index, node)) {
+        return false;
+    }
+    data.assign(node.begin(), node.end());
+    return true;
+}
+
+bool PersistentStore::read_node(size_t level, size_t index, NodeData& data) const
+{
+    std::array<uint8_t, NODE_RECORD_SIZE> record;
+    if (read_at(level_fds_[level], index * NODE_RECORD_SIZE, record.data(), NODE_RECORD_SIZE) != NODE_RECORD_SIZE ||
+        record[0] == 0) {
+        return false;
+    }
+    std::copy(record.begin() + 1, record.end(), data.begin());
+    return true;
+}
+
+bool PersistentStore::read_leaf(uint64_t index, indexed_leaf& leaf) const
+{
+    std::array<uint8_t, LEAF_RECORD_SIZE> record;
+    if (read_at(leaves_fd_, index * LEAF_RECORD_SIZE, record.data(), LEAF_RECORD_SIZE) != LEAF_RECORD_SIZE ||
+        record[0] == 0) {
+        return false;
+    }
+    deserialize_leaf(record.data() + 1, leaf);
+    return true;
+}
+
+index_t PersistentStore::get_leaf_count() const
+{
+    return index_t(layers_.back().leaf_count);
+}
+
+bool PersistentStore::get_leaf(const index_t& index, indexed_leaf& leaf) const
+{
+    const auto leaf_index = static_cast<uint64_t>(index);
+    for (auto layer = layers_.rbegin(); layer != layers_.rend(); ++layer) {
+        const auto it = layer->leaves.find(leaf_index);
+        if (it != layer->leaves.end()) {
+            leaf = it->second;
+            return true;
+        }
+    }
+    return read_leaf(leaf_index, leaf);
+}
+
+void PersistentStore::put_leaf(const index_t& index, const indexed_leaf& leaf, bool add_to_index)
+{
+    const auto leaf_index = static_cast<uint64_t>(index);
+    Layer& layer = layers_.back();
+    layer.leaves[leaf_index] = leaf;
+    layer.leaf_count = std::max(layer.leaf_count, leaf_index + 1);
+    if (add_to_index) {
+        layer.indices[uint256_t(leaf.value)] = leaf_index;
+    }
+}
+
+bool PersistentStore::find_in_run(const Run& run,
+                                  const uint256_t& value,
+                                  uint256_t& found_value,
+                                  uint64_t& found_index) const
+{
+    const auto fence = std::upper_bound(run.fences.begin(), run.fences.end(), value);
+    if (fence == run.fences.begin()) {
+        return false;
+    }
+    const auto block = static_cast<uint64_t>(fence - run.fences.begin() - 1);
+    const uint64_t start = block * RUN_BLOCK_SIZE;
+    const uint64_t count = std::min<uint64_t>(RUN_BLOCK_SIZE, run.info.size - start);
+    std::array<uint8_t, RUN_BLOCK_SIZE * RUN_ENTRY_SIZE> entries;
+    if (read_at(run.fd, start * RUN_ENTRY_SIZE, entries.data(), count * RUN_ENTRY_SIZE) != count * RUN_ENTRY_SIZE) {
+        throw_or_abort("PersistentStore: index run is truncated");
+    }
+    // The first entry of the block is not larger than the value: find the last such entry
+    uint64_t low = 0;
+    uint64_t high = count;
+    while (high - low > 1) {
+        const uint64_t mid = (low + high) / 2;
+        uint256_t entry_value;
+        std::memcpy(static_cast<void*>(&entry_value), &entries[mid * RUN_ENTRY_SIZE], sizeof(uint256_t));
+        if (value < entry_value) {
+            high = mid;
+        } else {
+            low = mid;
+        }
+    }
+    std::memcpy(static_cast<void*>(&found_value), &entries[low * RUN_ENTRY_SIZE], sizeof(uint256_t));
+    std::memcpy(&found_index, &entries[low * RUN_ENTRY_SIZE + sizeof(uint256_t)], sizeof(uint64_t));
+    return true;
+}
+
+std::pair<bool, index_t> PersistentStore::find_low_value(const fr& value) const
+{
+    const uint256_t target(value);
+    bool found = false;
+    uint256_t best_value;
+    uint64_t best_index = 0;
+    // Newer entries take precedence: an older entry only replaces the best one if its value is strictly larger
+    const auto consider = [&](const uint256_t& candidate_value, uint64_t candidate_index) {
+        if (!found || best_value < candidate_value) {
+            found = true;
+            best_value = candidate_value;
+            best_index = candidate_index;
+        }
+    };
+    for (auto layer = layers_.rbegin(); layer != layers_.rend(); ++layer) {
+        auto it = layer->indices.upper_bound(target);
+        if (it != layer->indices.begin()) {
+            --it;
+            consider(it->first, it->second);
+        }
+    }
+    for (auto run = runs_.rbegin(); run != runs_.rend(); ++run) {
+        uint256_t candidate_value;
+        uint64_t candidate_index = 0;
+        if (find_in_run(*run, target, candidate_value, candidate_index)) {
+            consider(candidate_value, candidate_index);
+        }
+    }
+    // The tree is initialised with a leaf of value 0, so there is always a low leaf
+    ASSERT(found);
+    return std::make_pair(best_value == target, index_t(best_index));
+}
+
+void PersistentStore::checkpoint()
+{
+    push_layer(layers_.back().leaf_count);
+}
+
+void PersistentStore::push_layer(uint64_t leaf_count)
+{
+    Layer layer;
+    layer.leaf_count = leaf_count;
+    layers_.push_back(std::move(layer));
+}
+
+void PersistentStore::commit_checkpoint()
+{
+    ASSERT(layers_.size() > 1);
+    Layer top = std::move(layers_.back());
+    layers_.pop_back();
+    Layer& below = layers_.back();
+    for (const auto& [key, node] : top.nodes) {
+        below.nodes[key] = node;
+    }
+    for (const auto& [index, leaf] : top.leaves) {
+        below.leaves[index] = leaf;
+    }
+    for (const auto& [value, index] : top.indices) {
+        below.indices[value] = index;
+    }
+    below.leaf_count = top.leaf_count;
+}
+
+void PersistentStore::revert_checkpoint()
+{
+    ASSERT(layers_.size() > 1);
+    layers_.pop_back();
+}
+
+void PersistentStore::rollback()
+{
+    layers_.clear();
+    push_layer(manifest_.leaf_count);
+}
+
+void PersistentStore::commit()
+{
+    Batch batch;
+    batch.nodes.resize(levels_ + 1);
+    std::map<uint256_t, uint64_t> indices;
+    bool has_changes = layers_.back().leaf_count != manifest_.leaf_count;
+    for (const auto& layer : layers_) {
+        for (const auto& [key, node] : layer.nodes) {
+            batch.nodes[key >> INDEX_BITS][key & INDEX_MASK] = node;
+        }
+        for (const auto& [index, leaf] : layer.leaves) {
+            batch.leaves[index] = leaf;
+        }
+        for (const auto& [value, index] : layer.indices) {
+            indices[value] = index;
+        }
+        has_changes = has_changes || !layer.nodes.empty() || !layer.leaves.empty();
+    }
+    if (!has_changes && indices.empty()) {
+        rollback();
+        return;
+    }
+
+    Manifest manifest = manifest_;
+    manifest.leaf_count = layers_.back().leaf_count;
+    std::vector<Run> new_runs;
+    if (!indices.empty()) {
+        // The run is only referenced once the journal is complete, until then it is an orphan removed on open
+        new_runs.push_back(write_run(manifest.next_run_id++, indices));
+        manifest.runs.push_back(new_runs.back().info);
+    }
+
+    write_journal(batch, manifest);
+    apply_batch(batch);
+    write_manifest(manifest);
+    remove_file(file_path(JOURNAL_FILE));
+    sync_directory(path_);
+
+    manifest_ = manifest;
+    for (auto& run : new_runs) {
+        runs_.push_back(std::move(run));
+    }
+    rollback();
+    compact_runs();
+}
+
+void PersistentStore::load_manifest()
+{
+    const std::string manifest_path = file_path(MANIFEST_FILE);
+    if (!file_exists(manifest_path)) {
+        manifest_ = Manifest{};
+        return;
+    }
+    const int fd = open_file(manifest_path);
+    std::vector<uint8_t> buf(file_size(fd));
+    const size_t read = read_at(fd, 0, buf.data(), buf.size());
+    close_file(fd);
+
+    uint64_t magic = 0;
+    uint64_t version = 0;
+    uint64_t levels = 0;
+    uint64_t num_runs = 0;
+    Manifest manifest;
+    BufferReader reader(buf.data(), read);
+    bool valid = reader.read(magic) && reader.read(version) && reader.read(levels) &&
+                 reader.read(manifest.leaf_count) && reader.read(manifest.next_run_id) && reader.read(num_runs);
+    for (uint64_t i = 0; valid && i < num_runs; ++i) {
+        RunInfo info;
+        valid = reader.read(info.id) && reader.read(info.size);
+        manifest.runs.push_back(info);
+    }
+    const size_t checked_size = reader.position();
+    uint64_t expected_checksum = 0;
+    valid = valid && reader.read(expected_checksum) && expected_checksum == checksum(buf.data(), checked_size);
+    if (!valid || magic != MANIFEST_MAGIC || version != STORE_VERSION) {
+        throw_or_abort(format("PersistentStore: corrupt manifest in ", path_));
+    }
+    if (levels != levels_) {
+        throw_or_abort(format("PersistentStore: ", path_, " holds trees of depth ", levels, ", not ", levels_));
+    }
+    manifest_ = manifest;
+}
+
+void PersistentStore::write_manifest(const Manifest& manifest)
+{
+    std::vector<uint8_t> buf;
+    append(buf, MANIFEST_MAGIC);
+    append(buf, STORE_VERSION);
+    append(buf, static_cast<uint64_t>(levels_));
+    append(buf, manifest.leaf_count);
+    append(buf, manifest.next_run_id);
+    append(buf, static_cast<uint64_t>(manifest.runs.size()));
+    for (const auto& info : manifest.runs) {
+        append(buf, info.id);
+        append(buf, info.size);
+    }
+    append(buf, checksum(buf.data(), buf.size()));
+
+    const std::string tmp_path = file_path(MANIFEST_TMP_FILE);
+    const int fd = open_file(tmp_path, true);
+    write_at(fd, 0, buf.data(), buf.size());
+    sync_file(fd);
+    close_file(fd);
+    rename_file(tmp_path, file_path(MANIFEST_FILE));
+    sync_directory(path_);
+}
+
+/**
+ * @details The journal holds the magic, the node and leaf records of the batch, an end marker, the serialized
+ * manifest and finally a checksum of everything before it.
+ */
+void PersistentStore::write_journal(const Batch& batch, const Manifest& manifest)
+{
+    std::vector<uint8_t> buf;
+    append(buf, JOURNAL_MAGIC);
+    for (size_t level = 0; level < batch.nodes.size(); ++level) {
+        for (const auto& [index, node] : batch.nodes[level]) {
+            append(buf, JOURNAL_NODE);
+            append(buf, static_cast<uint8_t>(level));
+            append(buf, index);
+            append(buf, node);
+        }
+    }
+    std::array<uint8_t, LEAF_SIZE> leaf_data;
+    for (const auto& [index, leaf] : batch.leaves) {
+        append(buf, JOURNAL_LEAF);
+        append(buf, index);
+        serialize_leaf(leaf, leaf_data.data());
+        append(buf, leaf_data);
+    }
+    append(buf, JOURNAL_END);
+    append(buf, manifest.leaf_count);
+    append(buf, manifest.next_run_id);
+    append(buf, static_cast<uint64_t>(manifest.runs.size()));
+    for (const auto& info : manifest.runs) {
+        append(buf, info.id);
+        append(buf, info.size);
+    }
+    append(buf, checksum(buf.data(), buf.size()));
+
+    const int fd = open_file(file_path(JOURNAL_FILE), true);
+    write_at(fd, 0, buf.data(), buf.size());
+    sync_file(fd);
+    close_file(fd);
+    sync_directory(path_);
+}
+
+void PersistentStore::recover_journal()
+{
+    const std::string journal_path = file_path(JOURNAL_FILE);
+    if (!file_exists(journal_path)) {
+        return;
+    }
+    const int fd = open_file(journal_path);
+    std::vector<uint8_t> buf(file_size(fd));
+    const size_t read = read_at(fd, 0, buf.data(), buf.size());
+    close_file(fd);
+
+    bool valid = read == buf.size() && buf.size() >= 2 * sizeof(uint64_t);
+    if (valid) {
+        uint64_t expected_checksum = 0;
+        std::memcpy(&expected_checksum, &buf[buf.size() - sizeof(uint64_t)], sizeof(uint64_t));
+        valid = expected_checksum == checksum(buf.data(), buf.size() - sizeof(uint64_t));
+    }
+
+    Batch batch;
+    batch.nodes.resize(levels_ + 1);
+    Manifest manifest;
+    if (valid) {
+        BufferReader reader(buf.data(), buf.size() - sizeof(uint64_t));
+        uint64_t magic = 0;
+        valid = reader.read(magic) && magic == JOURNAL_MAGIC;
+        uint8_t tag = JOURNAL_END;
+        while (valid && reader.read(tag) && tag != JOURNAL_END) {
+            uint64_t index = 0;
+            if (tag == JOURNAL_NODE) {
+                uint8_t level = 0;
+                NodeData node;
+                valid = reader.read(level) && reader.read(index) && reader.read(node) && level <= levels_;
+                if (valid) {
+                    batch.nodes[level][index] = node;
+                }
+            } else if (tag == JOURNAL_LEAF) {
+                std::array<uint8_t, LEAF_SIZE> leaf_data;
+                valid = reader.read(index) && reader.read(leaf_data);
+                if (valid) {
+                    deserialize_leaf(leaf_data.data(), batch.leaves[index]);
+                }
+            } else {
+                valid = false;
+            }
+        }
+        uint64_t num_runs = 0;
+        valid = valid && tag == JOURNAL_END && reader.read(manifest.leaf_count) &&
+                reader.read(manifest.next_run_id) && reader.read(num_runs);
+        for (uint64_t i = 0; valid && i < num_runs; ++i) {
+            RunInfo info;
+            valid = reader.read(info.id) && reader.read(info.size);
+            manifest.runs.push_back(info);
+        }
+    }
+
+    // A journal that is not complete belongs to a commit that never happened
+    if (valid) {
+        apply_batch(batch);
+        write_manifest(manifest);
+        manifest_ = manifest;
+    }
+    remove_file(journal_path);
+    sync_directory(path_);
+}
+
+void PersistentStore::apply_batch(const Batch& batch)
+{
+    for (size_t level = 0; level < batch.nodes.size(); ++level) {
+        if (batch.nodes[level].empty()) {
+            continue;
+        }
+        RecordWriter writer(level_fds_[level], NODE_RECORD_SIZE);
+        for (const auto& [index, node] : batch.nodes[level]) {
+            std::copy(node.begin(), node.end(), writer.add(index));
+        }
+        writer.flush();
+        sync_file(level_fds_[level]);
+    }
+    if (!batch.leaves.empty()) {
+        RecordWriter writer(leaves_fd_, LEAF_RECORD_SIZE);
+        for (const auto& [index, leaf] : batch.leaves) {
+            serialize_leaf(leaf, writer.add(index));
+        }
+        writer.flush();
+        sync_file(leaves_fd_);
+    }
+}
+
+PersistentStore::Run PersistentStore::open_run(const RunInfo& info) const
+{
+    Run run{ .info = info, .fd = open_file(run_path(info.id)), .fences = {} };
+    if (file_size(run.fd) != info.size * RUN_ENTRY_SIZE) {
+        throw_or_abort(format("PersistentStore: index run ", info.id, " in ", path_, " is truncated"));
+    }
+    run.fences.resize((info.size + RUN_BLOCK_SIZE - 1) / RUN_BLOCK_SIZE);
+    for (size_t block = 0; block < run.fences.size(); ++block) {
+        read_at(run.fd, block * RUN_BLOCK_SIZE * RUN_ENTRY_SIZE, &run.fences[block], sizeof(uint256_t));
+    }
+    return run;
+}
+
+PersistentStore::Run PersistentStore::write_run(uint64_t id, const std::map<uint256_t, uint64_t>& indices) const
+{
+    Run run{ .info = { .id = id, .size = 0 }, .fd = open_file(run_path(id), true), .fences = {} };
+    RunWriter writer(run.fd, run.fences);
+    for (const auto& [value, index] : indices) {
+        writer.add(value, index);
+    }
+    run.info.size = writer.finish();
+    sync_directory(path_);
+    return run;
+}
+
+PersistentStore::Run PersistentStore::merge_runs(uint64_t id, const Run& older, const Run& newer) const
+{
+    Run run{ .info = { .id = id, .size = 0 }, .fd = open_file(run_path(id), true), .fences = {} };
+    RunWriter writer(run.fd, run.fences);
+    RunReader old_reader(older.fd, older.info.size);
+    RunReader new_reader(newer.fd, newer.info.size);
+    old_reader.load();
+    new_reader.load();
+    while (old_reader.valid() || new_reader.valid()) {
+        if (!new_reader.valid() || (old_reader.valid() && old_reader.value() < new_reader.value())) {
+            writer.add(old_reader.value(), old_reader.index());
+            old_reader.next();
+            continue;
+        }
+        // On equal values the newer entry wins
+        if (old_reader.valid() && old_reader.value() == new_reader.value()) {
+            old_reader.next();
+        }
+        writer.add(new_reader.value(), new_reader.index());
+        new_reader.next();
+    }
+    run.info.size = writer.finish();
+    sync_directory(path_);
+    return run;
+}
+
+/**
+ * @details Merges the two newest runs while the newest is at least half the size of the one before, so run sizes
+ * decrease geometrically and each entry is rewritten O(log n) times.
+ */
+void PersistentStore::compact_runs()
+{
+    while (runs_.size() >= 2 && 2 * runs_.back().info.size >= runs_[runs_.size() - 2].info.size) {
+        Run& older = runs_[runs_.size() - 2];
+        Run& newer = runs_.back();
+        Manifest manifest = manifest_;
+        Run merged = merge_runs(manifest.next_run_id++, older, newer);
+        manifest.runs.resize(manifest.runs.size() - 2);
+        manifest.runs.push_back(merged.info);
+        write_manifest(manifest);
+        manifest_ = manifest;
+
+        for (const Run* run : { &older, &newer }) {
+            close_file(run->fd);
+            remove_file(run_path(run->info.id));
+        }
+        runs_.pop_back();
+        runs_.pop_back();
+        runs_.push_back(std::move(merged));
+    }
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,164 @@
+#pragma once
+#include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "indexed_tree/indexed_leaf.hpp"
+#include <array>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A crash-consistent, disk-backed store for merkle trees. It can back an AppendOnlyTree or an IndexedTree as
+ * their `Store`, and also hold the leaves of an IndexedTree through `PersistentLeavesStore`.
+ *
+ * @details The store lives in a directory with the following files:
+ * - level_<l>.dat: the nodes of level l. A node is addressed by the fixed-width key (level, index) and its record is
+ *   at offset index * NODE_RECORD_SIZE. As trees are filled from the left these files are dense, and a lookup is a
+ *   single read.
+ * - leaves.dat: the leaves of an indexed tree, addressed by their index in the same way.
+ * - index_<id>.run: the sorted index of leaf values used by `find_low_value`. Each commit writes the values it added
+ *   as a new immutable run of (value, index) entries sorted by value. Runs are merged as they accumulate, so that there
+ *   are O(log n) of them. For each run, only the first value of every block of RUN_BLOCK_SIZE entries is held in
+ *   memory, so that a lookup reads a single block per run.
+ * - MANIFEST: the number of leaves and the list of runs. It is replaced atomically (write and rename).
+ * - JOURNAL: only exists while a commit is in progress.
+ *
+ * All writes go to an in-memory layer of uncommitted changes, which reads see before the files. `checkpoint` opens a
+ * new layer, which is then either merged into the layer below (`commit_checkpoint`) or discarded
+ * (`revert_checkpoint`). `rollback` discards all uncommitted changes.
+ *
+ * `commit` persists all uncommitted changes as one transaction. The changes and the new manifest are first written to
+ * the journal, which is synced before any data file is modified. If the process dies before the journal is complete,
+ * opening the store discards it; if it dies afterwards, opening the store replays it. Either way the store holds the
+ * state of a commit boundary.
+ *
+ * Data files are written in native byte order, as a host-local database.
+ *
+ * `put`, `put_batch` and `get` may be called concurrently with each other (as IndexedTree does when updating low leaves
+ * in parallel). All other methods must not be called concurrently with any method.
+ *
+ * A tree only reads its size and root from the store on construction: after `rollback` or `revert_checkpoint`, the
+ * trees backed by the store must be constructed again.
+ */
+class PersistentStore {
+  public:
+    static constexpr size_t NODE_SIZE = 32;
+    static constexpr size_t LEAF_SIZE = 96;
+    // Each record starts with a byte that is set once the record has been written. Holes in a file read as zeroes,
+    // i.e. as missing records.
+    static constexpr size_t NODE_RECORD_SIZE = NODE_SIZE + 1;
+    static constexpr size_t LEAF_RECORD_SIZE = LEAF_SIZE + 1;
+    static constexpr size_t RUN_BLOCK_SIZE = 128;
+
+    /**
+     * @brief Opens the store in the directory `path`, creating it if needed, for trees of depth `levels`.
+     * @details Completes or discards a commit interrupted by a crash.
+     */
+    PersistentStore(std::string path, size_t levels);
+    PersistentStore(PersistentStore const& other) = delete;
+    PersistentStore(PersistentStore&& other) = delete;
+    PersistentStore& operator=(PersistentStore const& other) = delete;
+    PersistentStore& operator=(PersistentStore&& other) = delete;
+    ~PersistentStore();
+
+    void put(size_t level, size_t index, const std::vector<uint8_t>& data);
+    /**
+     * @brief Puts the nodes of `level` from `start_index` onwards
+     */
+    void put_batch(size_t level, size_t start_index, const std::vector<std::vector<uint8_t>>& data);
+    bool get(size_t level, size_t index, std::vector<uint8_t>& data) const;
+
+    index_t get_leaf_count() const;
+    bool get_leaf(const index_t& index, indexed_leaf& leaf) const;
+    void put_leaf(const index_t& index, const indexed_leaf& leaf, bool add_to_index);
+
+    /**
+     * @brief Finds the indexed leaf with the largest value that is not larger than `value`.
+     * @return Whether that leaf's value is `value`, and its index
+     */
+    std::pair<bool, index_t> find_low_value(const fr& value) const;
+
+    void checkpoint();
+    void commit_checkpoint();
+    void revert_checkpoint();
+
+    /**
+     * @brief Atomically persists all uncommitted changes (including those of open checkpoints, which are closed).
+     */
+    void commit();
+
+    /**
+     * @brief Discards all uncommitted changes (including those of open checkpoints, which are closed).
+     */
+    void rollback();
+
+    const std::string& path() const { return path_; }
+
+  private:
+    using NodeData = std::array<uint8_t, NODE_SIZE>;
+
+    struct Layer {
+        std::unordered_map<uint64_t, NodeData> nodes;
+        std::unordered_map<uint64_t, indexed_leaf> leaves;
+        std::map<uint256_t, uint64_t> indices;
+        uint64_t leaf_count = 0;
+    };
+
+    struct RunInfo {
+        uint64_t id = 0;
+        uint64_t size = 0;
+    };
+
+    struct Manifest {
+        uint64_t leaf_count = 0;
+        uint64_t next_run_id = 0;
+        std::vector<RunInfo> runs;
+    };
+
+    struct Run {
+        RunInfo info;
+        int fd = -1;
+        // The value of the first entry of each block
+        std::vector<uint256_t> fences;
+    };
+
+    // The changes of a commit, ordered so that consecutive records are written together
+    struct Batch {
+        std::vector<std::map<uint64_t, NodeData>> nodes;
+        std::map<uint64_t, indexed_leaf> leaves;
+    };
+
+    static uint64_t node_key(size_t level, size_t index);
+    std::string file_path(const std::string& name) const;
+    std::string run_path(uint64_t id) const;
+
+    void push_layer(uint64_t leaf_count);
+    bool read_node(size_t level, size_t index, NodeData& data) const;
+    bool read_leaf(uint64_t index, indexed_leaf& leaf) const;
+
+    void load_manifest();
+    void write_manifest(const Manifest& manifest);
+    void recover_journal();
+    void write_journal(const Batch& batch, const Manifest& manifest);
+    void apply_batch(const Batch& batch);
+
+    Run open_run(const RunInfo& info) const;
+    Run write_run(uint64_t id, const std::map<uint256_t, uint64_t>& indices) const;
+    Run merge_runs(uint64_t id, const Run& older, const Run& newer) const;
+    void compact_runs();
+    bool find_in_run(const Run& run, const uint256_t& value, uint256_t& found_value, uint64_t& found_index) const;
+
+    std::string path_;
+    size_t levels_;
+    std::vector<int> level_fds_;
+    int leaves_fd_ = -1;
+    Manifest manifest_;
+    std::vector<Run> runs_;
+    std::vector<Layer> layers_;
+    mutable std::shared_mutex layers_mutex_;
+};
+
+} // namespace bb::crypto::merkle_tree
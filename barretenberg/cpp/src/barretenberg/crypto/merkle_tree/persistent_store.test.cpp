@@ -0,0 +1,230 @@
+#include "persistent_store.hpp"
+#include "append_only_tree/append_only_tree.hpp"
+#include "array_store.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "hash.hpp"
+#include "indexed_tree/indexed_tree.hpp"
+#include "indexed_tree/leaves_cache.hpp"
+#include "indexed_tree/persistent_leaves_store.hpp"
+#include <filesystem>
+#include <fstream>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+using HashPolicy = Poseidon2HashPolicy;
+
+namespace {
+auto& random_engine = numeric::get_randomness();
+
+std::vector<uint8_t> node_data(uint8_t seed)
+{
+    std::vector<uint8_t> data(PersistentStore::NODE_SIZE);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(seed + i);
+    }
+    return data;
+}
+
+std::vector<fr> random_values(size_t num_values)
+{
+    std::vector<fr> values(num_values);
+    for (auto& value : values) {
+        value = fr(random_engine.get_random_uint256());
+    }
+    return values;
+}
+} // namespace
+
+class PersistentStoreTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        path = (std::filesystem::temp_directory_path() /
+                ("persistent_store_test_" + std::to_string(random_engine.get_random_uint64())))
+                   .string();
+    }
+    void TearDown() override { std::filesystem::remove_all(path); }
+
+    std::string path;
+};
+
+TEST_F(PersistentStoreTest, PersistsCommittedNodes)
+{
+    std::vector<uint8_t> data;
+    {
+        PersistentStore store(path, 4);
+        store.put(4, 3, node_data(1));
+        store.put(0, 0, node_data(2));
+        EXPECT_TRUE(store.get(4, 3, data));
+        EXPECT_EQ(data, node_data(1));
+        EXPECT_FALSE(store.get(4, 2, data));
+        store.commit();
+
+        // Not committed, so lost when the store is closed
+        store.put(4, 4, node_data(3));
+    }
+    PersistentStore store(path, 4);
+    EXPECT_TRUE(store.get(4, 3, data));
+    EXPECT_EQ(data, node_data(1));
+    EXPECT_TRUE(store.get(0, 0, data));
+    EXPECT_EQ(data, node_data(2));
+    EXPECT_FALSE(store.get(4, 4, data));
+    EXPECT_FALSE(store.get(4, 100, data));
+}
+
+TEST_F(PersistentStoreTest, CheckpointsAndRollback)
+{
+    PersistentStore store(path, 4);
+    std::vector<uint8_t> data;
+    store.put(2, 1, node_data(1));
+    store.commit();
+
+    store.checkpoint();
+    store.put(2, 1, node_data(2));
+    store.put(2, 2, node_data(3));
+    EXPECT_TRUE(store.get(2, 1, data));
+    EXPECT_EQ(data, node_data(2));
+    store.revert_checkpoint();
+    EXPECT_TRUE(store.get(2, 1, data));
+    EXPECT_EQ(data, node_data(1));
+    EXPECT_FALSE(store.get(2, 2, data));
+
+    store.checkpoint();
+    store.put(2, 2, node_data(3));
+    store.checkpoint();
+    store.put(2, 3, node_data(4));
+    store.commit_checkpoint();
+    store.commit_checkpoint();
+    EXPECT_TRUE(store.get(2, 3, data));
+    store.rollback();
+    EXPECT_FALSE(store.get(2, 2, data));
+    EXPECT_FALSE(store.get(2, 3, data));
+    EXPECT_TRUE(store.get(2, 1, data));
+    EXPECT_EQ(data, node_data(1));
+}
+
+TEST_F(PersistentStoreTest, FindsLowValuesAcrossRuns)
+{
+    PersistentStore store(path, 4);
+    std::map<uint256_t, index_t> expected;
+    const auto add_leaf = [&](const fr& value) {
+        const index_t index = store.get_leaf_count();
+        store.put_leaf(index, indexed_leaf{ .value = value, .nextIndex = 0, .nextValue = 0 }, true);
+        expected[uint256_t(value)] = index;
+    };
+    add_leaf(fr(0));
+    // Commits of varying sizes, so that runs get merged
+    for (size_t i = 0; i < 12; ++i) {
+        for (const auto& value : random_values(1 + (i * 37) % 300)) {
+            add_leaf(value);
+        }
+        if (i % 4 == 3) {
+            // Some values stay uncommitted
+            continue;
+        }
+        store.commit();
+    }
+
+    for (const auto& value : random_values(200)) {
+        auto it = --expected.upper_bound(uint256_t(value));
+        EXPECT_EQ(store.find_low_value(value), std::make_pair(false, it->second));
+    }
+    for (const auto& [value, index] : expected) {
+        EXPECT_EQ(store.find_low_value(fr(value)), std::make_pair(true, index));
+    }
+}
+
+TEST_F(PersistentStoreTest, AppendOnlyTreeResumes)
+{
+    constexpr size_t depth = 10;
+    ArrayStore array_store(depth);
+    AppendOnlyTree<ArrayStore, HashPolicy> expected(array_store, depth);
+    {
+        PersistentStore store(path, depth);
+        AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+        for (size_t i = 0; i < 5; ++i) {
+            const auto values = random_values(1UL << i);
+            expected.add_values(values);
+            tree.add_values(values);
+            store.commit();
+        }
+        EXPECT_EQ(tree.root(), expected.root());
+        tree.add_values(random_values(4));
+    }
+
+    PersistentStore store(path, depth);
+    AppendOnlyTree<PersistentStore, HashPolicy> tree(store, depth);
+    EXPECT_EQ(tree.size(), expected.size());
+    EXPECT_EQ(tree.root(), expected.root());
+    const auto values = random_values(8);
+    expected.add_values(values);
+    tree.add_values(values);
+    EXPECT_EQ(tree.root(), expected.root());
+    EXPECT_EQ(tree.get_hash_path(33), expected.get_hash_path(33));
+}
+
+TEST_F(PersistentStoreTest, IndexedTreeResumes)
+{
+    constexpr size_t depth = 10;
+    constexpr size_t batch_size = 16;
+    using Tree = IndexedTree<PersistentStore, PersistentLeavesStore, HashPolicy>;
+    ArrayStore array_store(depth);
+    IndexedTree<ArrayStore, LeavesCache, HashPolicy> expected(array_store, depth, batch_size);
+    {
+        PersistentStore store(path, depth);
+        Tree tree(store, depth, batch_size);
+        for (size_t i = 0; i < 8; ++i) {
+            const auto values = random_values(batch_size);
+            EXPECT_EQ(tree.add_or_update_values(values), expected.add_or_update_values(values));
+            store.commit();
+        }
+        EXPECT_EQ(tree.root(), expected.root());
+    }
+
+    PersistentStore store(path, depth);
+    {
+        Tree tree(store, depth, batch_size);
+        EXPECT_EQ(tree.root(), expected.root());
+        // Rolled back, so neither applied to the store nor to the expected tree
+        tree.add_or_update_values(random_values(batch_size));
+        store.rollback();
+    }
+    Tree tree(store, depth, batch_size);
+    EXPECT_EQ(tree.root(), expected.root());
+    for (size_t i = 0; i < 4; ++i) {
+        const auto values = random_values(batch_size);
+        EXPECT_EQ(tree.add_or_update_values(values), expected.add_or_update_values(values));
+    }
+    EXPECT_EQ(tree.root(), expected.root());
+    for (size_t i = 0; i < 12 * batch_size; i += 7) {
+        EXPECT_EQ(tree.get_leaf(i), expected.get_leaf(i));
+        EXPECT_EQ(tree.get_hash_path(i), expected.get_hash_path(i));
+    }
+}
+
+TEST_F(PersistentStoreTest, DiscardsIncompleteCommits)
+{
+    std::vector<uint8_t> data;
+    {
+        PersistentStore store(path, 4);
+        store.put(1, 1, node_data(1));
+        store.put_leaf(0, indexed_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 }, true);
+        store.commit();
+    }
+    // A torn journal and an index run written by a commit that never completed
+    {
+        std::ofstream journal(path + "/JOURNAL", std::ios::binary);
+        journal << "torn";
+        std::ofstream run(path + "/index_1000.run", std::ios::binary);
+        run << "orphan";
+    }
+    PersistentStore store(path, 4);
+    EXPECT_FALSE(std::filesystem::exists(path + "/JOURNAL"));
+    EXPECT_FALSE(std::filesystem::exists(path + "/index_1000.run"));
+    EXPECT_TRUE(store.get(1, 1, data));
+    EXPECT_EQ(data, node_data(1));
+    EXPECT_EQ(store.get_leaf_count(), index_t(1));
+    EXPECT_EQ(store.find_low_value(fr(5)), std::make_pair(false, index_t(0)));
+}
@@ -1,5 +1,6 @@
 #include "./pedersen.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include <iostream>
 #ifndef NO_OMP_MULTITHREADING
@@ -21,13 +22,74 @@ template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
 {
-    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
-    Element result = Group::point_at_infinity;
+    return commit_with_generators(inputs, get_fixed_base_generators(inputs.size(), context)).normalize();
+}
+
+/**
+ * @brief Commit to each of a list of input vectors, as commit_native does.
+ *
+ * @details The commitments are computed in parallel and normalized together, with a single field inversion.
+ */
+template <typename Curve>
+std::vector<typename Curve::AffineElement> pedersen_commitment_base<Curve>::commit_native_batch(
+    const std::vector<std::vector<Fq>>& inputs, const GeneratorContext context)
+{
+    size_t max_num_inputs = 0;
+    for (const auto& input : inputs) {
+        max_num_inputs = std::max(max_num_inputs, input.size());
+    }
+    const FixedBaseGenerators generators = get_fixed_base_generators(max_num_inputs, context);
+
+    std::vector<Element> commitments(inputs.size());
+    run_loop_in_parallel(inputs.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            commitments[i] = commit_with_generators(inputs[i], generators);
+        }
+    });
+    Element::batch_normalize(commitments.data(), commitments.size());
+
+    std::vector<AffineElement> result;
+    result.reserve(inputs.size());
+    for (const Element& commitment : commitments) {
+        result.emplace_back(commitment.is_point_at_infinity() ? Group::affine_point_at_infinity
+                                                              : AffineElement(commitment.x, commitment.y));
+    }
+    return result;
+}
 
+/**
+ * @brief Get the fixed-base tables of the first `num_generators` generators of `context`, building the missing ones,
+ * and the generators that have no table (see generator_data::get_fixed_base_table).
+ */
+template <typename Curve>
+typename pedersen_commitment_base<Curve>::FixedBaseGenerators pedersen_commitment_base<
+    Curve>::get_fixed_base_generators(const size_t num_generators, const GeneratorContext& context)
+{
+    FixedBaseGenerators generators{ .tables = std::vector<const FixedBaseTable*>(num_generators),
+                                    .points = std::vector<AffineElement>(num_generators) };
+    for (size_t i = 0; i < num_generators; ++i) {
+        const size_t index = context.offset + i;
+        generators.tables[i] = context.generators->get_fixed_base_table(index, context.domain_separator);
+        if (generators.tables[i] == nullptr) {
+            generators.points[i] = context.generators->get_generator(index, context.domain_separator);
+        }
+    }
+    return generators;
+}
+
+/**
+ * @brief Compute inputs[0].g[0] + ... + inputs[n-1].g[n-1] in Jacobian form.
+ */
+template <typename Curve>
+typename Curve::Element pedersen_commitment_base<Curve>::commit_with_generators(std::span<const Fq> inputs,
+                                                                                const FixedBaseGenerators& generators)
+{
+    ASSERT(generators.tables.size() >= inputs.size());
+    Element result = Group::point_at_infinity;
     for (size_t i = 0; i < inputs.size(); ++i) {
-        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+        result += generators.mul(i, static_cast<uint256_t>(inputs[i]));
     }
-    return result.normalize();
+    return result;
 }
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace bb::crypto
@@ -5,6 +5,8 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
+#include <span>
+#include <vector>
 
 namespace bb::crypto {
 
@@ -17,6 +19,8 @@ namespace bb::crypto {
  *
  * Where `g` is a list of generator points defined by `generator_data`
  *
+ * Each x[i].g[i] is computed with the fixed-base table of g[i] cached in `generator_data`, or as a variable-base
+ * multiplication if `generator_data` has no table for g[i].
  */
 template <typename Curve> class pedersen_commitment_base {
   public:
@@ -26,8 +30,28 @@ template <typename Curve> class pedersen_commitment_base {
     using Fq = typename Curve::BaseField;
     using Group = typename Curve::Group;
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
+    using FixedBaseTable = crypto::fixed_base_table<Curve>;
+
+    /**
+     * @brief Generators to multiply by: generator i is multiplied by with tables[i] if it is not null, and as the
+     * variable base points[i] otherwise
+     */
+    struct FixedBaseGenerators {
+        std::vector<const FixedBaseTable*> tables;
+        std::vector<AffineElement> points;
+
+        [[nodiscard]] Element mul(size_t i, const uint256_t& scalar) const
+        {
+            return tables[i] != nullptr ? tables[i]->mul(scalar) : Element(points[i]) * Fr(scalar);
+        }
+    };
 
     static AffineElement commit_native(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static std::vector<AffineElement> commit_native_batch(const std::vector<std::vector<Fq>>& inputs,
+                                                          GeneratorContext context = {});
+
+    static FixedBaseGenerators get_fixed_base_generators(size_t num_generators, const GeneratorContext& context);
+    static Element commit_with_generators(std::span<const Fq> inputs, const FixedBaseGenerators& generators);
 };
 
 using pedersen_commitment = pedersen_commitment_base<curve::Grumpkin>;
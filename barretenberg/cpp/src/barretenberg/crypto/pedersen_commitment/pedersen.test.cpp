@@ -28,6 +28,61 @@ TEST(Pedersen, CommitmentWithZero)
     EXPECT_EQ(r, expected);
 }
 
+TEST(Pedersen, CommitmentMatchesVariableBaseMultiplication)
+{
+    std::vector<pedersen_commitment::Fq> inputs;
+    for (size_t i = 0; i < 12; ++i) {
+        inputs.emplace_back(pedersen_commitment::Fq::random_element());
+    }
+    inputs[3] = 0;
+    pedersen_commitment::GeneratorContext context(2, "pedersen_test");
+    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
+    grumpkin::g1::element expected = grumpkin::g1::point_at_infinity;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        expected += grumpkin::g1::element(generators[i]) * grumpkin::fr(uint256_t(inputs[i]));
+    }
+    EXPECT_EQ(pedersen_commitment::commit_native(inputs, context), grumpkin::g1::affine_element(expected));
+}
+
+// Once the cache of generator_data is full, the generators that have no fixed-base table are multiplied as variable bases
+TEST(Pedersen, CommitmentWithoutFixedBaseTables)
+{
+    using Data = generator_data<curve::Grumpkin>;
+    Data data;
+    // Leaves room for the tables of 4 of the 12 generators
+    for (size_t i = 0; i < Data::MAX_NUM_FIXED_BASE_TABLES - 4; ++i) {
+        static_cast<void>(data.get_fixed_base_table(i, "pedersen_fill"));
+    }
+    std::vector<pedersen_commitment::Fq> inputs;
+    for (size_t i = 0; i < 12; ++i) {
+        inputs.emplace_back(pedersen_commitment::Fq::random_element());
+    }
+    pedersen_commitment::GeneratorContext context;
+    context.generators = &data;
+    const auto generators = pedersen_commitment::get_fixed_base_generators(inputs.size(), context);
+    EXPECT_NE(generators.tables[3], nullptr);
+    EXPECT_EQ(generators.tables[4], nullptr);
+    EXPECT_EQ(pedersen_commitment::commit_native(inputs, context), pedersen_commitment::commit_native(inputs));
+    EXPECT_EQ(pedersen_commitment::commit_native_batch({ inputs }, context)[0],
+              pedersen_commitment::commit_native(inputs));
+}
+
+TEST(Pedersen, CommitmentBatch)
+{
+    std::vector<std::vector<pedersen_commitment::Fq>> inputs;
+    for (size_t i = 0; i < 10; ++i) {
+        inputs.emplace_back(i % 4);
+        for (auto& x : inputs.back()) {
+            x = pedersen_commitment::Fq::random_element();
+        }
+    }
+    const auto commitments = pedersen_commitment::commit_native_batch(inputs);
+    ASSERT_EQ(commitments.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(commitments[i], pedersen_commitment::commit_native(inputs[i]));
+    }
+}
+
 TEST(Pedersen, CommitmentProf)
 {
     GTEST_SKIP() << "Skipping mini profiler.";
@@ -1,5 +1,6 @@
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::crypto {
 
@@ -41,6 +42,19 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
     return elements;
 }
 
+/**
+ * @brief The context of the length generator h, i.e. the generator of index 0 of the domain separator
+ * `pedersen_hash_length` of `context.generators`
+ */
+template <typename Curve>
+typename pedersen_hash_base<Curve>::GeneratorContext pedersen_hash_base<Curve>::get_length_context(
+    const GeneratorContext& context)
+{
+    GeneratorContext length_context(0, LENGTH_DOMAIN_SEPARATOR);
+    length_context.generators = context.generators;
+    return length_context;
+}
+
 /**
  * @brief Given a vector of fields, generate a pedersen hash using generators from `context`.
  *
@@ -56,8 +70,46 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
-    return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
+    using Commitment = pedersen_commitment_base<Curve>;
+    const auto length_generator = Commitment::get_fixed_base_generators(1, get_length_context(context));
+    Element result = length_generator.mul(0, inputs.size()) +
+                     Commitment::commit_with_generators(
+                         inputs, Commitment::get_fixed_base_generators(inputs.size(), context));
+    return result.normalize().x;
+}
+
+/**
+ * @brief Hash each of a list of input vectors, as hash does.
+ *
+ * @details The hashes are computed in parallel and normalized together, with a single field inversion.
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(const std::vector<std::vector<Fq>>& inputs,
+                                                                             const GeneratorContext context)
+{
+    using Commitment = pedersen_commitment_base<Curve>;
+    size_t max_num_inputs = 0;
+    for (const auto& input : inputs) {
+        max_num_inputs = std::max(max_num_inputs, input.size());
+    }
+    const auto length_generator = Commitment::get_fixed_base_generators(1, get_length_context(context));
+    const auto generators = Commitment::get_fixed_base_generators(max_num_inputs, context);
+
+    std::vector<Element> points(inputs.size());
+    run_loop_in_parallel(inputs.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            points[i] = length_generator.mul(0, inputs[i].size()) +
+                        Commitment::commit_with_generators(inputs[i], generators);
+        }
+    });
+    Element::batch_normalize(points.data(), points.size());
+
+    std::vector<Fq> result;
+    result.reserve(inputs.size());
+    for (const Element& point : points) {
+        result.emplace_back(point.x);
+    }
+    return result;
 }
 
 /**
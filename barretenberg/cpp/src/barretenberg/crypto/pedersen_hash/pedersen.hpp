@@ -19,6 +19,9 @@ namespace bb::crypto {
  * It is neccessary that all generator points are linearly independent of one another,
  * so that finding collisions is equivalent to solving the discrete logarithm problem.
  * This is ensured via the generator derivation algorithm in `generator_data`
+ *
+ * As for commitments, the multiplications use the fixed-base tables cached in `generator_data` where it has them
+ * (including for `h`, as the generator of index 0 of the domain separator `pedersen_hash_length`).
  */
 template <typename Curve> class pedersen_hash_base {
   public:
@@ -28,12 +31,16 @@ template <typename Curve> class pedersen_hash_base {
     using Fr = typename Curve::ScalarField;
     using Group = typename Curve::Group;
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
-    inline static constexpr AffineElement length_generator = Group::derive_generators("pedersen_hash_length", 1)[0];
+    inline static constexpr std::string_view LENGTH_DOMAIN_SEPARATOR = "pedersen_hash_length";
+    inline static constexpr AffineElement length_generator =
+        Group::derive_generators(LENGTH_DOMAIN_SEPARATOR, 1)[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static std::vector<Fq> hash_batch(const std::vector<std::vector<Fq>>& inputs, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
 
   private:
     static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
+    static GeneratorContext get_length_context(const GeneratorContext& context);
 };
 
 using pedersen_hash = pedersen_hash_base<curve::Grumpkin>;
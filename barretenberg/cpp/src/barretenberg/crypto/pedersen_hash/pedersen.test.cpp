@@ -32,4 +32,38 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
-} // namespace bb::crypto
\ No newline at end of file
+TEST(Pedersen, HashBatch)
+{
+    std::vector<std::vector<pedersen_hash::Fq>> inputs;
+    for (size_t i = 0; i < 10; ++i) {
+        inputs.emplace_back(i % 4 + 1);
+        for (auto& x : inputs.back()) {
+            x = pedersen_hash::Fq::random_element();
+        }
+    }
+    inputs.push_back({ pedersen_hash::Fq::one(), pedersen_hash::Fq::one() });
+    const auto hashes = pedersen_hash::hash_batch(inputs, 5);
+    ASSERT_EQ(hashes.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(hashes[i], pedersen_hash::hash(inputs[i], 5));
+    }
+    EXPECT_EQ(hashes.back(), fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
+}
+
+TEST(Pedersen, HashWithoutFixedBaseTables)
+{
+    using Data = generator_data<curve::Grumpkin>;
+    // A full cache, so that none of the generators of the hash (including the length generator) has a table
+    Data data;
+    for (size_t i = 0; i < Data::MAX_NUM_FIXED_BASE_TABLES; ++i) {
+        static_cast<void>(data.get_fixed_base_table(i, "pedersen_fill"));
+    }
+    pedersen_hash::GeneratorContext context(5);
+    context.generators = &data;
+    auto x = pedersen_hash::Fq::one();
+    EXPECT_EQ(pedersen_hash::hash({ x, x }, context),
+              fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
+    EXPECT_EQ(pedersen_hash::hash_batch({ { x, x } }, context)[0], pedersen_hash::hash({ x, x }, 5));
+}
+
+} // namespace bb::crypto
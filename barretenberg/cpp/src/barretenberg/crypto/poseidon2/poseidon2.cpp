@@ -10,6 +10,46 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_fixed_length(input);
 }
 
+/**
+ * @brief Hashes two field elements, as hash({ lhs, rhs }) but without allocating
+ */
+template <typename Params>
+typename Poseidon2<Params>::FF Poseidon2<Params>::hash_pair(const typename Poseidon2<Params>::FF& lhs,
+                                                            const typename Poseidon2<Params>::FF& rhs)
+{
+    const std::array<FF, 2> input{ lhs, rhs };
+    return Sponge::hash_fixed_length(input);
+}
+
+/**
+ * @brief Hashes pairs of field elements, output[i] = hash_pair(lhs[i], rhs[i]), with the batched permutation
+ * @details The sponge of hash_pair absorbs both elements into a state (lhs, rhs, 0, iv) which is permuted once, and
+ * squeezes its first element. Here the states are built directly and permuted Permutation::BATCH_SIZE at a time.
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs_batch(std::span<const typename Poseidon2<Params>::FF> lhs,
+                                         std::span<const typename Poseidon2<Params>::FF> rhs,
+                                         std::span<typename Poseidon2<Params>::FF> output)
+{
+    using Permutation = Poseidon2Permutation<Params>;
+    ASSERT(lhs.size() == output.size() && rhs.size() == output.size());
+    // The IV of a fixed length hash of 2 elements with 1 output
+    const FF iv = FF(static_cast<uint256_t>(2) << 64);
+    const auto kernel = field_kernels::get_field_kernel();
+
+    std::array<typename Permutation::State, Permutation::BATCH_SIZE> states;
+    for (size_t start = 0; start < output.size(); start += Permutation::BATCH_SIZE) {
+        const size_t num_states = std::min(Permutation::BATCH_SIZE, output.size() - start);
+        for (size_t j = 0; j < num_states; ++j) {
+            states[j] = { lhs[start + j], rhs[start + j], 0, iv };
+        }
+        Permutation::permute_batch(std::span(states.data(), num_states), kernel);
+        for (size_t j = 0; j < num_states; ++j) {
+            output[start + j] = states[j][0];
+        }
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
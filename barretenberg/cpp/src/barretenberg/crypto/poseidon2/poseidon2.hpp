@@ -17,6 +17,14 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes two field elements, as hash({ lhs, rhs }) but without allocating
+     */
+    static FF hash_pair(const FF& lhs, const FF& rhs);
+    /**
+     * @brief Hashes pairs of field elements, output[i] = hash_pair(lhs[i], rhs[i]), with the batched permutation
+     */
+    static void hash_pairs_batch(std::span<const FF> lhs, std::span<const FF> rhs, std::span<FF> output);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
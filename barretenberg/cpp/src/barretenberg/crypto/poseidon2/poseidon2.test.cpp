@@ -64,3 +64,20 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairsBatchMatchesHashPair)
+{
+    constexpr size_t num_pairs = 21;
+    std::vector<fr> lhs(num_pairs);
+    std::vector<fr> rhs(num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        lhs[i] = fr::random_element(&engine);
+        rhs[i] = fr::random_element(&engine);
+    }
+    std::vector<fr> output(num_pairs);
+    crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs_batch(lhs, rhs, output);
+
+    for (size_t i = 0; i < num_pairs; ++i) {
+        EXPECT_EQ(output[i], crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_pair(lhs[i], rhs[i]));
+    }
+}
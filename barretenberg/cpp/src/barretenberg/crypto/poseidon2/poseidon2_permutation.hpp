@@ -3,10 +3,13 @@
 #include "poseidon2_params.hpp"
 
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/fields/field.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::crypto {
 
@@ -43,6 +46,12 @@ template <typename Params> class Poseidon2Permutation {
     static constexpr MatrixDiagonal internal_matrix_diagonal = Params::internal_matrix_diagonal;
     static constexpr RoundConstantsContainer round_constants = Params::round_constants;
 
+    // The number of states that permute_batch runs through the rounds in lockstep, which is the number of field
+    // multiplications done at once by the AVX-512 IFMA kernel
+    static constexpr size_t BATCH_SIZE = 8;
+    // BATCH_SIZE states in structure-of-arrays layout: lanes[i][j] is element i of state j
+    using BatchState = std::array<std::array<FF, BATCH_SIZE>, t>;
+
     static constexpr void matrix_multiplication_4x4(State& input)
     {
         /**
@@ -160,5 +169,113 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Applies the permutation to each of `states`, in place.
+     * @details The states are permuted BATCH_SIZE at a time, transposed into a BatchState. Each step of a round is
+     * applied to all the lanes before the next one, so that the multiplications of independent states are interleaved
+     * rather than waiting on each other, and are done by the batched field kernels (with AVX-512 IFMA when the CPU has
+     * it). Callers hashing many independent inputs, e.g. the nodes of a level of a Merkle tree, should permute their
+     * states together rather than call permutation() on each.
+     */
+    static void permute_batch(std::span<State> states,
+                              const field_kernels::FieldKernel kernel = field_kernels::get_field_kernel())
+    {
+        for (size_t start = 0; start < states.size(); start += BATCH_SIZE) {
+            const size_t num_states = std::min(BATCH_SIZE, states.size() - start);
+            // The lanes past the last state are permuted as zero states, and discarded
+            BatchState lanes{};
+            for (size_t j = 0; j < num_states; ++j) {
+                for (size_t i = 0; i < t; ++i) {
+                    lanes[i][j] = states[start + j][i];
+                }
+            }
+            permute_lanes(lanes, kernel);
+            for (size_t j = 0; j < num_states; ++j) {
+                for (size_t i = 0; i < t; ++i) {
+                    states[start + j][i] = lanes[i][j];
+                }
+            }
+        }
+    }
+
+  private:
+    // The diagonal of the internal matrix, with each of its elements repeated across the lanes
+    static constexpr BatchState internal_matrix_diagonal_lanes = [] {
+        BatchState diagonal;
+        for (size_t i = 0; i < t; ++i) {
+            diagonal[i].fill(internal_matrix_diagonal[i]);
+        }
+        return diagonal;
+    }();
+
+    static void apply_sbox(std::array<FF, BATCH_SIZE>& lane, const field_kernels::FieldKernel kernel)
+    {
+        std::array<FF, BATCH_SIZE> xxxx;
+        field_kernels::batch_sqr(xxxx.data(), lane.data(), BATCH_SIZE, kernel);
+        field_kernels::batch_sqr(xxxx.data(), xxxx.data(), BATCH_SIZE, kernel);
+        field_kernels::batch_mul(lane.data(), lane.data(), xxxx.data(), BATCH_SIZE, kernel);
+    }
+
+    static void full_round(BatchState& lanes, const RoundConstants& rc, const field_kernels::FieldKernel kernel)
+    {
+        for (size_t i = 0; i < t; ++i) {
+            for (auto& x : lanes[i]) {
+                x += rc[i];
+            }
+            apply_sbox(lanes[i], kernel);
+        }
+        matrix_multiplication_external(lanes);
+    }
+
+    static void matrix_multiplication_external(BatchState& lanes)
+    {
+        for (size_t j = 0; j < BATCH_SIZE; ++j) {
+            State state;
+            for (size_t i = 0; i < t; ++i) {
+                state[i] = lanes[i][j];
+            }
+            matrix_multiplication_external(state);
+            for (size_t i = 0; i < t; ++i) {
+                lanes[i][j] = state[i];
+            }
+        }
+    }
+
+    // The batched form of permutation()
+    static void permute_lanes(BatchState& lanes, const field_kernels::FieldKernel kernel)
+    {
+        matrix_multiplication_external(lanes);
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            full_round(lanes, round_constants[i], kernel);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& x : lanes[0]) {
+                x += round_constants[i][0];
+            }
+            apply_sbox(lanes[0], kernel);
+            std::array<FF, BATCH_SIZE> sum = lanes[0];
+            for (size_t k = 1; k < t; ++k) {
+                for (size_t j = 0; j < BATCH_SIZE; ++j) {
+                    sum[j] += lanes[k][j];
+                }
+            }
+            for (size_t k = 0; k < t; ++k) {
+                field_kernels::batch_mul(
+                    lanes[k].data(), lanes[k].data(), internal_matrix_diagonal_lanes[k].data(), BATCH_SIZE, kernel);
+                for (size_t j = 0; j < BATCH_SIZE; ++j) {
+                    lanes[k][j] += sum[j];
+                }
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            full_round(lanes, round_constants[i], kernel);
+        }
+    }
 };
-} // namespace bb::crypto
\ No newline at end of file
+} // namespace bb::crypto
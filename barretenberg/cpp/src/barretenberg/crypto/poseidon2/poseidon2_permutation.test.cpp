@@ -59,3 +59,30 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, PermuteBatchMatchesPermutation)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    using field_kernels::FieldKernel;
+    // Not a multiple of the batch size
+    constexpr size_t num_states = 2 * Permutation::BATCH_SIZE + 3;
+    std::vector<Permutation::State> inputs(num_states);
+    for (auto& input : inputs) {
+        for (auto& x : input) {
+            x = fr::random_element(&engine);
+        }
+    }
+    inputs[0] = crypto::Poseidon2Bn254ScalarFieldParams::TEST_VECTOR_INPUT;
+
+    for (const auto kernel : { FieldKernel::GENERIC, FieldKernel::BMI2, FieldKernel::ADX, FieldKernel::AVX512_IFMA }) {
+        if (!field_kernels::is_field_kernel_supported(kernel)) {
+            continue;
+        }
+        std::vector<Permutation::State> states = inputs;
+        Permutation::permute_batch(states, kernel);
+        for (size_t i = 0; i < num_states; ++i) {
+            EXPECT_EQ(states[i], Permutation::permutation(inputs[i])) << field_kernels::field_kernel_name(kernel);
+        }
+        EXPECT_EQ(states[0], crypto::Poseidon2Bn254ScalarFieldParams::TEST_VECTOR_OUTPUT);
+    }
+}
@@ -3,6 +3,7 @@
 #include <array>
 #include <memory.h>
 #include <string>
+#include <vector>
 
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 
@@ -39,6 +40,11 @@ bool schnorr_verify_signature(const std::string& message,
                               const typename G1::affine_element& public_key,
                               const schnorr_signature& sig);
 
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> schnorr_verify_batch(const std::vector<std::string>& messages,
+                                       const std::vector<typename G1::affine_element>& public_keys,
+                                       const std::vector<schnorr_signature>& signatures);
+
 template <typename Hash, typename Fq, typename Fr, typename G1>
 schnorr_signature schnorr_construct_signature(const std::string& message, const schnorr_key_pair<Fr, G1>& account);
 
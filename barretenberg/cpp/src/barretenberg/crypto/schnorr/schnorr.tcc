@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/hmac/hmac.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 
@@ -153,4 +154,58 @@ bool schnorr_verify_signature(const std::string& message,
     auto target_e = schnorr_generate_challenge<Hash, G1>(message, public_key, R);
     return std::equal(sig.e.begin(), sig.e.end(), target_e.begin(), target_e.end());
 }
+
+/**
+ * @brief Verify a batch of signatures, with the same result as schnorr_verify_signature for each of them
+ *
+ * @details A signature (s, e) does not contain its nonce R, and e is a hash of R.x, so the equations of the signatures
+ * cannot be combined into one: each R = s⋅G + e⋅pub must be computed to recompute its challenge. The batch computes
+ * them in parallel, normalizes them all with one batch_normalize (one field inversion instead of one per signature),
+ * and then hashes the challenges in parallel.
+ *
+ * @return whether each signature is valid
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> schnorr_verify_batch(const std::vector<std::string>& messages,
+                                       const std::vector<typename G1::affine_element>& public_keys,
+                                       const std::vector<schnorr_signature>& signatures)
+{
+    using affine_element = typename G1::affine_element;
+    using element = typename G1::element;
+
+    const size_t num_signatures = signatures.size();
+    ASSERT(messages.size() == num_signatures && public_keys.size() == num_signatures);
+
+    // The nonce of a signature rejected before its challenge is checked is left at infinity
+    std::vector<element> nonces(num_signatures, element::infinity());
+    run_loop_in_parallel(num_signatures, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            const affine_element& public_key = public_keys[i];
+            if (!public_key.on_curve() || public_key.is_point_at_infinity()) {
+                continue;
+            }
+            Fr e = Fr::serialize_from_buffer(&signatures[i].e[0]);
+            Fr s = Fr::serialize_from_buffer(&signatures[i].s[0]);
+            if (s == 0 || e == 0) {
+                continue;
+            }
+            nonces[i] = element(public_key) * e + G1::one * s;
+        }
+    });
+    element::batch_normalize(nonces.data(), num_signatures);
+
+    std::vector<uint8_t> valid(num_signatures, 0);
+    run_loop_in_parallel(num_signatures, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            if (nonces[i].is_point_at_infinity()) {
+                continue;
+            }
+            const affine_element R(nonces[i].x, nonces[i].y);
+            auto target_e = schnorr_generate_challenge<Hash, G1>(messages[i], public_keys[i], R);
+            valid[i] = static_cast<uint8_t>(
+                std::equal(signatures[i].e.begin(), signatures[i].e.end(), target_e.begin(), target_e.end()));
+        }
+    });
+    return { valid.begin(), valid.end() };
+}
 } // namespace bb::crypto
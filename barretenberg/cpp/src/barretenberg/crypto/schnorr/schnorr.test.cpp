@@ -137,3 +137,42 @@ TEST(schnorr, hmac_signature_consistency)
         message_b, account_b.public_key, signature_h);
     EXPECT_EQ(res, true);
 }
+
+TEST(schnorr, verify_batch)
+{
+    const size_t num_signatures = 20;
+    std::vector<std::string> messages;
+    std::vector<grumpkin::g1::affine_element> public_keys;
+    std::vector<schnorr_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        auto account = generate_signature();
+        messages.emplace_back("The quick brown fox jumped over the lazy dog " + std::to_string(i));
+        public_keys.emplace_back(account.public_key);
+        signatures.emplace_back(schnorr_construct_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+            messages.back(), account));
+    }
+    std::vector<bool> expected(num_signatures, true);
+    EXPECT_EQ((schnorr_verify_batch<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+                  messages, public_keys, signatures)),
+              expected);
+
+    // Invalid signatures: a different message, a different public key, a modified s and a zero e
+    messages[2] = "The quick brown dog jumped over the lazy fox.";
+    expected[2] = false;
+    public_keys[7] = public_keys[8];
+    expected[7] = false;
+    signatures[13].s[31] ^= 1;
+    expected[13] = false;
+    signatures[19].e.fill(0);
+    expected[19] = false;
+
+    std::vector<bool> result = schnorr_verify_batch<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+        messages, public_keys, signatures);
+
+    EXPECT_EQ(result, expected);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        EXPECT_EQ(result[i],
+                  (schnorr_verify_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+                      messages[i], public_keys[i], signatures[i])));
+    }
+}
@@ -436,5 +436,77 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+// The batched kernels of field_kernels.hpp, for each field_kernels::FieldKernel (the argument of the benchmark)
+constexpr size_t NUM_BATCH_ELEMENTS = 1 << 16;
+
+std::vector<fr> random_elements(const size_t n)
+{
+    std::vector<fr> elements(n);
+    for (auto& x : elements) {
+        x = fr::random_element();
+    }
+    return elements;
+}
+
+bool skip_unsupported_kernel(State& state, const field_kernels::FieldKernel kernel)
+{
+    state.SetLabel(field_kernels::field_kernel_name(kernel));
+    if (!field_kernels::is_field_kernel_supported(kernel)) {
+        state.SkipWithError("kernel not supported by this CPU");
+        return true;
+    }
+    return false;
+}
+
+void batch_mul_bench(State& state) noexcept
+{
+    const auto kernel = static_cast<field_kernels::FieldKernel>(state.range(0));
+    if (skip_unsupported_kernel(state, kernel)) {
+        return;
+    }
+    const std::vector<fr> a = random_elements(NUM_BATCH_ELEMENTS);
+    const std::vector<fr> b = random_elements(NUM_BATCH_ELEMENTS);
+    std::vector<fr> r(NUM_BATCH_ELEMENTS);
+    for (auto _ : state) {
+        field_kernels::batch_mul(r.data(), a.data(), b.data(), NUM_BATCH_ELEMENTS, kernel);
+        DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(batch_mul_bench)->DenseRange(0, 3);
+
+void batch_invert_bench(State& state) noexcept
+{
+    const auto kernel = static_cast<field_kernels::FieldKernel>(state.range(0));
+    if (skip_unsupported_kernel(state, kernel)) {
+        return;
+    }
+    std::vector<fr> a = random_elements(NUM_BATCH_ELEMENTS);
+    for (auto _ : state) {
+        field_kernels::batch_invert(std::span{ a }, kernel);
+        DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(batch_invert_bench)->DenseRange(0, 3);
+
+// All the rounds of an FFT of size NUM_BATCH_ELEMENTS, with random roots
+void fft_butterflies_bench(State& state) noexcept
+{
+    const auto kernel = static_cast<field_kernels::FieldKernel>(state.range(0));
+    if (skip_unsupported_kernel(state, kernel)) {
+        return;
+    }
+    std::vector<fr> values = random_elements(NUM_BATCH_ELEMENTS);
+    const std::vector<fr> roots = random_elements(NUM_BATCH_ELEMENTS / 2);
+    for (auto _ : state) {
+        for (size_t m = 1; m < NUM_BATCH_ELEMENTS; m <<= 1) {
+            field_kernels::fft_butterflies(values.data(), roots.data(), m, 0, NUM_BATCH_ELEMENTS / 2, kernel);
+        }
+        DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(fft_butterflies_bench)->DenseRange(0, 3)->Unit(kMillisecond);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
@@ -378,4 +378,79 @@ TEST(fr, Uint256Conversions)
 
     static_assert(a == c);
     EXPECT_EQ(a, c);
-}
\ No newline at end of file
+}
+
+TEST(fr, FieldKernelsMatchFieldOperators)
+{
+    using field_kernels::FieldKernel;
+    // Not a multiple of the IFMA width
+    constexpr size_t n = 203;
+    std::vector<fr> a(n);
+    std::vector<fr> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = fr::random_element();
+        b[i] = fr::random_element();
+        // Elements in [p, 2p), as left by the coarse reduction
+        if (i % 3 == 0) {
+            a[i] = fr(uint256_t(a[i]) + fr::modulus);
+        }
+    }
+    a[1] = 0;
+    b[2] = 0;
+    a[4] = fr(fr::modulus + fr::modulus - 1);
+    b[4] = a[4];
+
+    std::vector<fr> expected_products(n);
+    std::vector<fr> expected_squares(n);
+    for (size_t i = 0; i < n; ++i) {
+        expected_products[i] = a[i] * b[i];
+        expected_squares[i] = a[i].sqr();
+    }
+    std::vector<fr> expected_inverses = a;
+    for (auto& x : expected_inverses) {
+        x = x.is_zero() ? x : x.invert();
+    }
+    // The rounds of a size 256 FFT, with the iterations split as between threads
+    constexpr size_t fft_size = 256;
+    std::vector<fr> fft_values(a.begin(), a.begin() + fft_size / 2);
+    fft_values.insert(fft_values.end(), b.begin(), b.begin() + fft_size / 2);
+    std::vector<std::vector<fr>> expected_fft_rounds;
+    {
+        std::vector<fr> values = fft_values;
+        for (size_t m = 1; m < fft_size; m <<= 1) {
+            const std::vector<fr> roots(b.begin(), b.begin() + static_cast<std::ptrdiff_t>(m));
+            for (size_t i = 0; i < fft_size / 2; ++i) {
+                const size_t k = (i & ~(m - 1)) << 1;
+                const size_t j = i & (m - 1);
+                const fr temp = roots[j] * values[k + j + m];
+                values[k + j + m] = values[k + j] - temp;
+                values[k + j] += temp;
+            }
+            expected_fft_rounds.push_back(values);
+        }
+    }
+
+    for (const auto kernel : { FieldKernel::GENERIC, FieldKernel::BMI2, FieldKernel::ADX, FieldKernel::AVX512_IFMA }) {
+        if (!field_kernels::is_field_kernel_supported(kernel)) {
+            continue;
+        }
+        std::vector<fr> result(n);
+        field_kernels::batch_mul(result.data(), a.data(), b.data(), n, kernel);
+        EXPECT_EQ(result, expected_products);
+        field_kernels::batch_sqr(result.data(), a.data(), n, kernel);
+        EXPECT_EQ(result, expected_squares);
+
+        result = a;
+        field_kernels::batch_invert(std::span{ result }, kernel);
+        EXPECT_EQ(result, expected_inverses);
+
+        std::vector<fr> values = fft_values;
+        for (size_t m = 1, round = 0; m < fft_size; m <<= 1, ++round) {
+            for (size_t start = 0; start < fft_size / 2; start += 20) {
+                field_kernels::fft_butterflies(
+                    values.data(), b.data(), m, start, std::min(start + 20, fft_size / 2), kernel);
+            }
+            EXPECT_EQ(values, expected_fft_rounds[round]);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include "secp256r1.hpp"
+#include <benchmark/benchmark.h>
+#include <iostream>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+uint64_t rdtsc()
+{
+#ifdef __aarch64__
+    uint64_t pmccntr;
+    __asm__ __volatile__("mrs %0, pmccntr_el0" : "=r"(pmccntr));
+    return pmccntr;
+#elif __x86_64__
+    unsigned int lo = 0;
+    unsigned int hi = 0;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+    return 0;
+#endif
+}
+
+constexpr size_t NUM_OPERATIONS = 1 << 20;
+constexpr size_t NUM_INVERSIONS = 1 << 10;
+
+/**
+ * @brief Apply `op` to an accumulator `num_ops` times, and report the average number of clock cycles per operation
+ */
+template <typename Field, typename Op> void field_op_bench(State& state, const char* name, size_t num_ops, Op op)
+{
+    const Field x = Field::random_element();
+    const Field y = Field::random_element();
+    uint64_t clocks = 0;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        uint64_t before = rdtsc();
+        Field acc = x;
+        for (size_t i = 0; i < num_ops; ++i) {
+            op(acc, y);
+        }
+        DoNotOptimize(acc);
+        clocks += (rdtsc() - before);
+        ++count;
+    }
+    double average = static_cast<double>(clocks) / (static_cast<double>(count) * static_cast<double>(num_ops));
+    state.counters["clocks_per_op"] = average;
+    std::cout << name << " clocks per operation = " << average << std::endl;
+}
+
+template <typename Field> void mul_bench(State& state) noexcept
+{
+    field_op_bench<Field>(state, "mul", NUM_OPERATIONS, [](Field& acc, const Field& y) { acc = acc * y; });
+}
+
+template <typename Field> void mul_assign_bench(State& state) noexcept
+{
+    field_op_bench<Field>(state, "mul assign", NUM_OPERATIONS, [](Field& acc, const Field& y) { acc *= y; });
+}
+
+template <typename Field> void sqr_bench(State& state) noexcept
+{
+    field_op_bench<Field>(state, "sqr", NUM_OPERATIONS, [](Field& acc, const Field&) { acc = acc.sqr(); });
+}
+
+template <typename Field> void sqr_assign_bench(State& state) noexcept
+{
+    field_op_bench<Field>(state, "sqr assign", NUM_OPERATIONS, [](Field& acc, const Field&) { acc.self_sqr(); });
+}
+
+template <typename Field> void add_bench(State& state) noexcept
+{
+    field_op_bench<Field>(state, "add", NUM_OPERATIONS, [](Field& acc, const Field& y) { acc = acc + y; });
+}
+
+template <typename Field> void sub_bench(State& state) noexcept
+{
+    field_op_bench<Field>(state, "sub", NUM_OPERATIONS, [](Field& acc, const Field& y) { acc = acc - y; });
+}
+
+template <typename Field> void invert_bench(State& state) noexcept
+{
+    field_op_bench<Field>(
+        state, "invert", NUM_INVERSIONS, [](Field& acc, const Field& y) { acc = (acc + y).invert(); });
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(mul_bench, secp256r1::fq);
+BENCHMARK_TEMPLATE(mul_assign_bench, secp256r1::fq);
+BENCHMARK_TEMPLATE(sqr_bench, secp256r1::fq);
+BENCHMARK_TEMPLATE(sqr_assign_bench, secp256r1::fq);
+BENCHMARK_TEMPLATE(add_bench, secp256r1::fq);
+BENCHMARK_TEMPLATE(sub_bench, secp256r1::fq);
+BENCHMARK_TEMPLATE(invert_bench, secp256r1::fq);
+BENCHMARK_TEMPLATE(mul_bench, secp256r1::fr);
+BENCHMARK_TEMPLATE(mul_assign_bench, secp256r1::fr);
+BENCHMARK_TEMPLATE(sqr_bench, secp256r1::fr);
+BENCHMARK_TEMPLATE(sqr_assign_bench, secp256r1::fr);
+BENCHMARK_TEMPLATE(add_bench, secp256r1::fr);
+BENCHMARK_TEMPLATE(sub_bench, secp256r1::fr);
+BENCHMARK_TEMPLATE(invert_bench, secp256r1::fr);
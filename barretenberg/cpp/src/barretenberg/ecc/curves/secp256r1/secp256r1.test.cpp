@@ -450,4 +450,39 @@ TEST(secp256r1, MontgomeryMulBigBug)
     secp256r1::fr expected(uint256_t{ 0x57abc6aa0349c084, 0x65b21b232a4cb7a5, 0x5ba781948b0fcd6e, 0xd6e9e0644bda12f7 });
     EXPECT_EQ((a_sqr == expected), true);
 }
-#endif
\ No newline at end of file
+#endif
+
+namespace {
+// Compare the multiplication and squaring operators, which use assembly when it is available, with montgomery_mul_big
+template <typename Field> void check_mul_matches_montgomery_mul_big()
+{
+    std::vector<Field> elements{ Field(0), Field(1), Field(-1), Field(-2), Field(uint256_t(1) << 255) };
+    for (size_t i = 0; i < 1000; ++i) {
+        elements.emplace_back(Field::random_element(&engine));
+    }
+    for (size_t i = 1; i < elements.size(); ++i) {
+        const Field& a = elements[i - 1];
+        const Field& b = elements[i];
+        const Field expected = a.montgomery_mul_big(b);
+        EXPECT_EQ(uint256_t(a * b), uint256_t(expected));
+        Field c = a;
+        c *= b;
+        EXPECT_EQ(uint256_t(c), uint256_t(expected));
+
+        const Field expected_sqr = a.montgomery_mul_big(a);
+        EXPECT_EQ(uint256_t(a.sqr()), uint256_t(expected_sqr));
+        c = a;
+        c.self_sqr();
+        EXPECT_EQ(uint256_t(c), uint256_t(expected_sqr));
+        c = a;
+        c *= c;
+        EXPECT_EQ(uint256_t(c), uint256_t(expected_sqr));
+    }
+}
+} // namespace
+
+TEST(secp256r1, MulMatchesMontgomeryMulBig)
+{
+    check_mul_matches_montgomery_mul_big<secp256r1::fq>();
+    check_mul_matches_montgomery_mul_big<secp256r1::fr>();
+}
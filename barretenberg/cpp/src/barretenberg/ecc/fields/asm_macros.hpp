@@ -28,12 +28,13 @@
         "movq " hilo ", 16(" r ")               \n\t"                                                                    \
         "movq " hihi ", 24(" r ")               \n\t"
 
-#if !defined(__ADX__) || defined(DISABLE_ADX)
+// BMI2 variants, which multiply with mulx and add with add/adc
+
 /**
  * Take a 4-limb field element, in (%r12, %r13, %r14, %r15),
  * and add 4-limb field element pointed to by a
  **/
-#define ADD(b)                                                                                                           \
+#define ADD_BMI2(b)                                                                                                      \
         "addq 0(" b "), %%r12                   \n\t"                                                                    \
         "adcq 8(" b "), %%r13                   \n\t"                                                                    \
         "adcq 16(" b "), %%r14                  \n\t"                                                                    \
@@ -43,7 +44,7 @@
  * Take a 4-limb field element, in (%r12, %r13, %r14, %r15),
  * and subtract 4-limb field element pointed to by b
  **/
-#define SUB(b)                                                                                                           \
+#define SUB_BMI2(b)                                                                                                      \
         "subq 0(" b "), %%r12                   \n\t"                                                                    \
         "sbbq 8(" b "), %%r13                   \n\t"                                                                    \
         "sbbq 16(" b "), %%r14                  \n\t"                                                                    \
@@ -54,7 +55,7 @@
  * Take a 4-limb field element, in (%r12, %r13, %r14, %r15),
  * add 4-limb field element pointed to by b, and reduce modulo p
  **/
-#define ADD_REDUCE(b, modulus_0, modulus_1, modulus_2, modulus_3)                                                        \
+#define ADD_REDUCE_BMI2(b, modulus_0, modulus_1, modulus_2, modulus_3)                                                   \
         "addq 0(" b "), %%r12                   \n\t"                                                                    \
         "adcq 8(" b "), %%r13                   \n\t"                                                                    \
         "adcq 16(" b "), %%r14                  \n\t"                                                                    \
@@ -78,7 +79,7 @@
  * Take a 4-limb integer, r, in (%r12, %r13, %r14, %r15)
  * and conditionally subtract modulus, if r > p.
  **/
-#define REDUCE_FIELD_ELEMENT(neg_modulus_0, neg_modulus_1, neg_modulus_2, neg_modulus_3)                                 \
+#define REDUCE_FIELD_ELEMENT_BMI2(neg_modulus_0, neg_modulus_1, neg_modulus_2, neg_modulus_3)                            \
         /* Duplicate `r` */                                                                                              \
         "movq %%r12, %%r8                       \n\t"                                                                    \
         "movq %%r13, %%r9                       \n\t"                                                                    \
@@ -100,7 +101,7 @@
  * Compute Montgomery squaring of a
  * Result is stored, in (%%r12, %%r13, %%r14, %%r15), in preparation for being stored in "r"
  **/
-#define SQR(a)                                                                                                          \
+#define SQR_BMI2(a)                                                                                                     \
         "movq 0(" a "), %%rdx                     \n\t" /* load a[0] into %rdx */                                       \
                                                                                                                         \
         "xorq %%r8, %%r8                          \n\t" /* clear flags                                              */  \
@@ -232,7 +233,7 @@
  * Compute Montgomery multiplication of a, b.
  * Result is stored, in (%%r12, %%r13, %%r14, %%r15), in preparation for being stored in "r"
  **/
-#define MUL(a1, a2, a3, a4, b)     \
+#define MUL_BMI2(a1, a2, a3, a4, b)     \
         "movq " a1 ", %%rdx                     \n\t" /* load a[0] into %rdx                                      */  \
         "xorq %%r8, %%r8                          \n\t" /* clear r10 register, we use this when we need 0           */  \
         /* front-load mul ops, can parallelize 4 of these but latency is 4 cycles */                                    \
@@ -391,7 +392,7 @@
  * Compute 256-bit multiplication of a, b.
  * Result is stored, r. // in (%%r12, %%r13, %%r14, %%r15), in preparation for being stored in "r"
  **/
-#define MUL_256(a, b, r)                                                                                                \
+#define MUL_256_BMI2(a, b, r)                                                                                           \
         "movq 0(" a "), %%rdx                       \n\t" /* load a[0] into %rdx                                    */  \
                                                                                                                         \
         /* front-load mul ops, can parallelize 4 of these but latency is 4 cycles */                                    \
@@ -440,12 +441,54 @@
         "movq %%rax, 24(" r ")                     \n\t"
 
 
-#else // 6047895us
+/**
+ * One round of a Montgomery multiplication by b, for a modulus that uses all 256 bits.
+ * Add a[i] * b into the 6-limb accumulator (t0, ..., t5), then add k * p, where k = t0 * r_inv,
+ * so that t0 becomes 0. The accumulator of the next round is (t1, ..., t5, t0).
+ **/
+#define MUL_FULL_WIDTH_ROUND_BMI2(a_i, b, t0, t1, t2, t3, t4, t5)                                                       \
+        "movq " a_i ", %%rdx                       \n\t" /* load a[i] into %rdx                              */         \
+        "mulxq 0(" b "), %%r8, %%r9                \n\t" /* (lo[0], hi[0]) <- a[i] * b[0]                    */         \
+        "addq %%r8, " t0 "                         \n\t" /* t[0] += lo[0]                                    */         \
+        "mulxq 8(" b "), %%r8, %%rdi               \n\t" /* (lo[1], hi[1]) <- a[i] * b[1]                    */         \
+        "adcq %%r8, " t1 "                         \n\t" /* t[1] += lo[1] + flag_c                           */         \
+        "mulxq 16(" b "), %%r8, %%rsi              \n\t" /* (lo[2], hi[2]) <- a[i] * b[2]                    */         \
+        "adcq %%r8, " t2 "                         \n\t" /* t[2] += lo[2] + flag_c                           */         \
+        "mulxq 24(" b "), %%r8, %%rax              \n\t" /* (lo[3], hi[3]) <- a[i] * b[3]                    */         \
+        "adcq %%r8, " t3 "                         \n\t" /* t[3] += lo[3] + flag_c                           */         \
+        "adcq $0, " t4 "                           \n\t" /* t[4] += flag_c                                   */         \
+        "adcq $0, " t5 "                           \n\t" /* t[5] += flag_c                                   */         \
+        "addq %%r9, " t1 "                         \n\t" /* t[1] += hi[0]                                    */         \
+        "adcq %%rdi, " t2 "                        \n\t" /* t[2] += hi[1] + flag_c                           */         \
+        "adcq %%rsi, " t3 "                        \n\t" /* t[3] += hi[2] + flag_c                           */         \
+        "adcq %%rax, " t4 "                        \n\t" /* t[4] += hi[3] + flag_c                           */         \
+        "adcq $0, " t5 "                           \n\t" /* t[5] += flag_c                                   */         \
+                                                                                                                        \
+        "movq " t0 ", %%rdx                        \n\t" /* load t[0] into %rdx                              */         \
+        "mulxq %[r_inv], %%rdx, %%r8               \n\t" /* k <- t[0] * r_inv                                */         \
+        "mulxq %[modulus_0], %%r8, %%r9            \n\t" /* (lo[0], hi[0]) <- k * p[0]                       */         \
+        "addq %%r8, " t0 "                         \n\t" /* t[0] += lo[0] (t[0] is now 0)                    */         \
+        "mulxq %[modulus_1], %%r8, %%rdi           \n\t" /* (lo[1], hi[1]) <- k * p[1]                       */         \
+        "adcq %%r8, " t1 "                         \n\t" /* t[1] += lo[1] + flag_c                           */         \
+        "mulxq %[modulus_2], %%r8, %%rsi           \n\t" /* (lo[2], hi[2]) <- k * p[2]                       */         \
+        "adcq %%r8, " t2 "                         \n\t" /* t[2] += lo[2] + flag_c                           */         \
+        "mulxq %[modulus_3], %%r8, %%rax           \n\t" /* (lo[3], hi[3]) <- k * p[3]                       */         \
+        "adcq %%r8, " t3 "                         \n\t" /* t[3] += lo[3] + flag_c                           */         \
+        "adcq $0, " t4 "                           \n\t" /* t[4] += flag_c                                   */         \
+        "adcq $0, " t5 "                           \n\t" /* t[5] += flag_c                                   */         \
+        "addq %%r9, " t1 "                         \n\t" /* t[1] += hi[0]                                    */         \
+        "adcq %%rdi, " t2 "                        \n\t" /* t[2] += hi[1] + flag_c                           */         \
+        "adcq %%rsi, " t3 "                        \n\t" /* t[3] += hi[2] + flag_c                           */         \
+        "adcq %%rax, " t4 "                        \n\t" /* t[4] += hi[3] + flag_c                           */         \
+        "adcq $0, " t5 "                           \n\t" /* t[5] += flag_c                                   */
+
+// ADX variants, which multiply with mulx and add with adcx/adox
+
 /**
  * Take a 4-limb field element, in (%r12, %r13, %r14, %r15),
  * and add 4-limb field element pointed to by a
  **/
-#define ADD(b)                                                                                                           \
+#define ADD_ADX(b)                                                                                                       \
         "adcxq 0(" b "), %%r12                  \n\t"                                                                    \
         "adcxq 8(" b "), %%r13                  \n\t"                                                                    \
         "adcxq 16(" b "), %%r14                 \n\t"                                                                    \
@@ -455,7 +498,7 @@
  * Take a 4-limb field element, in (%r12, %r13, %r14, %r15),
  * and subtract 4-limb field element pointed to by b
  **/
-#define SUB(b)                                                                                                           \
+#define SUB_ADX(b)                                                                                                       \
         "subq 0(" b "), %%r12                   \n\t"                                                                    \
         "sbbq 8(" b "), %%r13                   \n\t"                                                                    \
         "sbbq 16(" b "), %%r14                  \n\t"                                                                    \
@@ -465,7 +508,7 @@
  * Take a 4-limb field element, in (%r12, %r13, %r14, %r15),
  * add 4-limb field element pointed to by b, and reduce modulo p
  **/
-#define ADD_REDUCE(b, modulus_0, modulus_1, modulus_2, modulus_3)                                                        \
+#define ADD_REDUCE_ADX(b, modulus_0, modulus_1, modulus_2, modulus_3)                                                    \
         "adcxq 0(" b "), %%r12                  \n\t"                                                                    \
         "movq  %%r12, %%r8                      \n\t"                                                                    \
         "adoxq " modulus_0 ", %%r12             \n\t"                                                                    \
@@ -488,7 +531,7 @@
  * Take a 4-limb integer, r, in (%r12, %r13, %r14, %r15)
  * and conditionally subtract modulus, if r > p.
  **/
-#define REDUCE_FIELD_ELEMENT(neg_modulus_0, neg_modulus_1, neg_modulus_2, neg_modulus_3)                                \
+#define REDUCE_FIELD_ELEMENT_ADX(neg_modulus_0, neg_modulus_1, neg_modulus_2, neg_modulus_3)                            \
         /* Duplicate `r` */                                                                                             \
         "movq %%r12, %%r8                          \n\t"                                                                \
         "movq %%r13, %%r9                          \n\t"                                                                \
@@ -516,7 +559,7 @@
  * Compute Montgomery squaring of a
  * Result is stored, in (%%r12, %%r13, %%r14, %%r15), in preparation for being stored in "r"
  **/
-#define SQR(a)                                                                                                          \
+#define SQR_ADX(a)                                                                                                      \
         "movq 0(" a "), %%rdx                      \n\t" /* load a[0] into %rdx */                                      \
                                                                                                                         \
         "xorq %%r8, %%r8                           \n\t" /* clear flags                                             */  \
@@ -650,7 +693,7 @@
  * Compute Montgomery multiplication of a, b.
  * Result is stored, in (%%r12, %%r13, %%r14, %%r15), in preparation for being stored in "r"
  **/
-#define MUL(a1, a2, a3, a4, b)     \
+#define MUL_ADX(a1, a2, a3, a4, b) \
         "movq " a1 ", %%rdx                        \n\t" /* load a[0] into %rdx                                     */  \
         "xorq %%r8, %%r8                           \n\t" /* clear r10 register, we use this when we need 0          */  \
         /* front-load mul ops, can parallelize 4 of these but latency is 4 cycles */                                    \
@@ -795,7 +838,7 @@
  * Compute Montgomery multiplication of a, b.
  * Result is stored, in (%%r12, %%r13, %%r14, %%r15), in preparation for being stored in "r"
  **/
-#define MUL_FOO(a1, a2, a3, a4, b)     \
+#define MUL_FOO_ADX(a1, a2, a3, a4, b) \
         "movq " a1 ", %%rdx                      \n\t" /* load a[0] into %rdx                                     */  \
         "xorq %%r8, %%r8                           \n\t" /* clear r10 register, we use this when we need 0          */  \
         /* front-load mul ops, can parallelize 4 of these but latency is 4 cycles */                                    \
@@ -940,7 +983,7 @@
  * Compute 256-bit multiplication of a, b.
  * Result is stored, r. // in (%%r12, %%r13, %%r14, %%r15), in preparation for being stored in "r"
  **/
-#define MUL_256(a, b, r)                                                                                                \
+#define MUL_256_ADX(a, b, r)                                                                                            \
         "movq 0(" a "), %%rdx                       \n\t" /* load a[0] into %rdx                                    */  \
                                                                                                                         \
         /* front-load mul ops, can parallelize 4 of these but latency is 4 cycles */                                    \
@@ -987,4 +1030,105 @@
         "movq %%r14, 8(" r ")                      \n\t"                                                                \
         "movq %%r15, 16(" r ")                     \n\t"                                                                \
         "movq %%rax, 24(" r ")                     \n\t"
-#endif
\ No newline at end of file
+
+/**
+ * One round of a Montgomery multiplication by b, for a modulus that uses all 256 bits.
+ * Add a[i] * b into the 6-limb accumulator (t0, ..., t5), then add k * p, where k = t0 * r_inv,
+ * so that t0 becomes 0. The accumulator of the next round is (t1, ..., t5, t0).
+ **/
+#define MUL_FULL_WIDTH_ROUND_ADX(a_i, b, t0, t1, t2, t3, t4, t5)                                                        \
+        "movq " a_i ", %%rdx                       \n\t" /* load a[i] into %rdx                              */         \
+        "xorq %%r8, %%r8                           \n\t" /* clear flag_c and flag_o                          */         \
+        "mulxq 0(" b "), %%r8, %%r9                \n\t" /* (lo[0], hi[0]) <- a[i] * b[0]                    */         \
+        "adcxq %%r8, " t0 "                        \n\t" /* t[0] += lo[0] + flag_c                           */         \
+        "adoxq %%r9, " t1 "                        \n\t" /* t[1] += hi[0] + flag_o                           */         \
+        "mulxq 8(" b "), %%r8, %%r9                \n\t" /* (lo[1], hi[1]) <- a[i] * b[1]                    */         \
+        "adcxq %%r8, " t1 "                        \n\t" /* t[1] += lo[1] + flag_c                           */         \
+        "adoxq %%r9, " t2 "                        \n\t" /* t[2] += hi[1] + flag_o                           */         \
+        "mulxq 16(" b "), %%r8, %%r9               \n\t" /* (lo[2], hi[2]) <- a[i] * b[2]                    */         \
+        "adcxq %%r8, " t2 "                        \n\t" /* t[2] += lo[2] + flag_c                           */         \
+        "adoxq %%r9, " t3 "                        \n\t" /* t[3] += hi[2] + flag_o                           */         \
+        "mulxq 24(" b "), %%r8, %%r9               \n\t" /* (lo[3], hi[3]) <- a[i] * b[3]                    */         \
+        "adcxq %%r8, " t3 "                        \n\t" /* t[3] += lo[3] + flag_c                           */         \
+        "adoxq %%r9, " t4 "                        \n\t" /* t[4] += hi[3] + flag_o                           */         \
+        "adcxq %[zero_reference], " t4 "           \n\t" /* t[4] += flag_c                                   */         \
+        "adoxq %[zero_reference], " t5 "           \n\t" /* t[5] += flag_o                                   */         \
+        "adcxq %[zero_reference], " t5 "           \n\t" /* t[5] += flag_c                                   */         \
+                                                                                                                        \
+        "movq " t0 ", %%rdx                        \n\t" /* load t[0] into %rdx                              */         \
+        "mulxq %[r_inv], %%rdx, %%r8               \n\t" /* k <- t[0] * r_inv                                */         \
+        "xorq %%r8, %%r8                           \n\t" /* clear flag_c and flag_o                          */         \
+        "mulxq %[modulus_0], %%r8, %%r9            \n\t" /* (lo[0], hi[0]) <- k * p[0]                       */         \
+        "adcxq %%r8, " t0 "                        \n\t" /* t[0] += lo[0] + flag_c (t[0] is now 0)           */         \
+        "adoxq %%r9, " t1 "                        \n\t" /* t[1] += hi[0] + flag_o                           */         \
+        "mulxq %[modulus_1], %%r8, %%r9            \n\t" /* (lo[1], hi[1]) <- k * p[1]                       */         \
+        "adcxq %%r8, " t1 "                        \n\t" /* t[1] += lo[1] + flag_c                           */         \
+        "adoxq %%r9, " t2 "                        \n\t" /* t[2] += hi[1] + flag_o                           */         \
+        "mulxq %[modulus_2], %%r8, %%r9            \n\t" /* (lo[2], hi[2]) <- k * p[2]                       */         \
+        "adcxq %%r8, " t2 "                        \n\t" /* t[2] += lo[2] + flag_c                           */         \
+        "adoxq %%r9, " t3 "                        \n\t" /* t[3] += hi[2] + flag_o                           */         \
+        "mulxq %[modulus_3], %%r8, %%r9            \n\t" /* (lo[3], hi[3]) <- k * p[3]                       */         \
+        "adcxq %%r8, " t3 "                        \n\t" /* t[3] += lo[3] + flag_c                           */         \
+        "adoxq %%r9, " t4 "                        \n\t" /* t[4] += hi[3] + flag_o                           */         \
+        "adcxq %[zero_reference], " t4 "           \n\t" /* t[4] += flag_c                                   */         \
+        "adoxq %[zero_reference], " t5 "           \n\t" /* t[5] += flag_o                                   */         \
+        "adcxq %[zero_reference], " t5 "           \n\t" /* t[5] += flag_c                                   */
+
+// The variants used by the field arithmetic of this build
+#if !defined(__ADX__) || defined(DISABLE_ADX)
+#define ADD(b) ADD_BMI2(b)
+#define SUB(b) SUB_BMI2(b)
+#define ADD_REDUCE(b, modulus_0, modulus_1, modulus_2, modulus_3)                                                       \
+        ADD_REDUCE_BMI2(b, modulus_0, modulus_1, modulus_2, modulus_3)
+#define REDUCE_FIELD_ELEMENT(neg_modulus_0, neg_modulus_1, neg_modulus_2, neg_modulus_3)                                \
+        REDUCE_FIELD_ELEMENT_BMI2(neg_modulus_0, neg_modulus_1, neg_modulus_2, neg_modulus_3)
+#define SQR(a) SQR_BMI2(a)
+#define MUL(a1, a2, a3, a4, b) MUL_BMI2(a1, a2, a3, a4, b)
+#define MUL_256(a, b, r) MUL_256_BMI2(a, b, r)
+#define MUL_FULL_WIDTH_ROUND(a_i, b, t0, t1, t2, t3, t4, t5) MUL_FULL_WIDTH_ROUND_BMI2(a_i, b, t0, t1, t2, t3, t4, t5)
+#else
+#define ADD(b) ADD_ADX(b)
+#define SUB(b) SUB_ADX(b)
+#define ADD_REDUCE(b, modulus_0, modulus_1, modulus_2, modulus_3)                                                       \
+        ADD_REDUCE_ADX(b, modulus_0, modulus_1, modulus_2, modulus_3)
+#define REDUCE_FIELD_ELEMENT(neg_modulus_0, neg_modulus_1, neg_modulus_2, neg_modulus_3)                                \
+        REDUCE_FIELD_ELEMENT_ADX(neg_modulus_0, neg_modulus_1, neg_modulus_2, neg_modulus_3)
+#define SQR(a) SQR_ADX(a)
+#define MUL(a1, a2, a3, a4, b) MUL_ADX(a1, a2, a3, a4, b)
+#define MUL_256(a, b, r) MUL_256_ADX(a, b, r)
+#define MUL_FULL_WIDTH_ROUND(a_i, b, t0, t1, t2, t3, t4, t5) MUL_FULL_WIDTH_ROUND_ADX(a_i, b, t0, t1, t2, t3, t4, t5)
+#endif
+
+/**
+ * Compute the Montgomery product of a and b, for a modulus p that uses all 256 bits (e.g. the secp256k1 and secp256r1
+ * fields), where the accumulator no longer fits in 4 limbs and the result must be fully reduced.
+ * The result is left in (%r14, %r15, %r10, %r11).
+ * Requires MUL_FULL_WIDTH_ROUND, and clobbers %rax, %rdx, %rdi, %rsi and %r8 to %r15
+ **/
+#define MUL_FULL_WIDTH(a, b)                                                                                            \
+        "xorq %%r10, %%r10                         \n\t" /* t[0] <- 0                                        */         \
+        "xorq %%r11, %%r11                         \n\t" /* t[1] <- 0                                        */         \
+        "xorq %%r12, %%r12                         \n\t" /* t[2] <- 0                                        */         \
+        "xorq %%r13, %%r13                         \n\t" /* t[3] <- 0                                        */         \
+        "xorq %%r14, %%r14                         \n\t" /* t[4] <- 0                                        */         \
+        "xorq %%r15, %%r15                         \n\t" /* t[5] <- 0                                        */         \
+                                                                                                                        \
+        MUL_FULL_WIDTH_ROUND("0(" a ")", b, "%%r10", "%%r11", "%%r12", "%%r13", "%%r14", "%%r15")                       \
+        MUL_FULL_WIDTH_ROUND("8(" a ")", b, "%%r11", "%%r12", "%%r13", "%%r14", "%%r15", "%%r10")                       \
+        MUL_FULL_WIDTH_ROUND("16(" a ")", b, "%%r12", "%%r13", "%%r14", "%%r15", "%%r10", "%%r11")                      \
+        MUL_FULL_WIDTH_ROUND("24(" a ")", b, "%%r13", "%%r14", "%%r15", "%%r10", "%%r11", "%%r12")                      \
+                                                                                                                        \
+        /* the result is in (%r14, %r15, %r10, %r11), and is smaller than 2p. Subtract p if it is not smaller */        \
+        "movq %%r14, %%r8                          \n\t"                                                                \
+        "movq %%r15, %%r9                          \n\t"                                                                \
+        "movq %%r10, %%rdx                         \n\t"                                                                \
+        "movq %%r11, %%r13                         \n\t"                                                                \
+        "subq %[modulus_0], %%r8                   \n\t" /* r[0] - p[0]                                      */         \
+        "sbbq %[modulus_1], %%r9                   \n\t" /* r[1] - p[1] - flag_c                             */         \
+        "sbbq %[modulus_2], %%rdx                  \n\t" /* r[2] - p[2] - flag_c                             */         \
+        "sbbq %[modulus_3], %%r13                  \n\t" /* r[3] - p[3] - flag_c                             */         \
+        "sbbq $0, %%r12                            \n\t" /* flag_c is set iff r < p                          */         \
+        "cmovncq %%r8, %%r14                       \n\t"                                                                \
+        "cmovncq %%r9, %%r15                       \n\t"                                                                \
+        "cmovncq %%rdx, %%r10                      \n\t"                                                                \
+        "cmovncq %%r13, %%r11                      \n\t"
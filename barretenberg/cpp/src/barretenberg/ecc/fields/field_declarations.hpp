@@ -668,6 +668,8 @@ template <class Params_> struct alignas(32) field {
     BB_INLINE static void asm_self_add_with_coarse_reduction(const field& a, const field& b) noexcept;
     BB_INLINE static void asm_self_sub_with_coarse_reduction(const field& a, const field& b) noexcept;
     BB_INLINE static void asm_self_add_without_reduction(const field& a, const field& b) noexcept;
+    BB_INLINE static field asm_mul_full_width(const field& a, const field& b) noexcept;
+    BB_INLINE static void asm_self_mul_full_width(const field& a, const field& b) noexcept;
 
     BB_INLINE static void asm_conditional_negate(field& r, uint64_t predicate) noexcept;
     BB_INLINE static field asm_reduce_once(const field& a) noexcept;
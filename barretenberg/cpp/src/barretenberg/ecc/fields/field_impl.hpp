@@ -27,10 +27,15 @@ namespace bb {
 template <class T> constexpr field<T> field<T>::operator*(const field& other) const noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::mul");
-    if constexpr (BBERG_NO_ASM || (T::modulus_3 >= 0x4000000000000000ULL) ||
-                  (T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0)) {
-        // >= 255-bits or <= 64-bits.
+    if constexpr (BBERG_NO_ASM || (T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0)) {
+        // <= 64-bits.
         return montgomery_mul(other);
+    } else if constexpr (T::modulus_3 >= 0x4000000000000000ULL) {
+        // >= 255-bits: the accumulator does not fit in 4 limbs, see asm_mul_full_width
+        if (std::is_constant_evaluated()) {
+            return montgomery_mul(other);
+        }
+        return asm_mul_full_width(*this, other);
     } else {
         if (std::is_constant_evaluated()) {
             return montgomery_mul(other);
@@ -42,10 +47,15 @@ template <class T> constexpr field<T> field<T>::operator*(const field& other) co
 template <class T> constexpr field<T>& field<T>::operator*=(const field& other) noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::self_mul");
-    if constexpr (BBERG_NO_ASM || (T::modulus_3 >= 0x4000000000000000ULL) ||
-                  (T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0)) {
-        // >= 255-bits or <= 64-bits.
+    if constexpr (BBERG_NO_ASM || (T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0)) {
+        // <= 64-bits.
         *this = operator*(other);
+    } else if constexpr (T::modulus_3 >= 0x4000000000000000ULL) {
+        if (std::is_constant_evaluated()) {
+            *this = operator*(other);
+        } else {
+            asm_self_mul_full_width(*this, other);
+        }
     } else {
         if (std::is_constant_evaluated()) {
             *this = operator*(other);
@@ -64,9 +74,13 @@ template <class T> constexpr field<T>& field<T>::operator*=(const field& other)
 template <class T> constexpr field<T> field<T>::sqr() const noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::sqr");
-    if constexpr (BBERG_NO_ASM || (T::modulus_3 >= 0x4000000000000000ULL) ||
-                  (T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0)) {
+    if constexpr (BBERG_NO_ASM || (T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0)) {
         return montgomery_square();
+    } else if constexpr (T::modulus_3 >= 0x4000000000000000ULL) {
+        if (std::is_constant_evaluated()) {
+            return montgomery_square();
+        }
+        return asm_mul_full_width(*this, *this);
     } else {
         if (std::is_constant_evaluated()) {
             return montgomery_square();
@@ -78,9 +92,14 @@ template <class T> constexpr field<T> field<T>::sqr() const noexcept
 template <class T> constexpr void field<T>::self_sqr() noexcept
 {
     BB_OP_COUNT_TRACK_NAME("f::self_sqr");
-    if constexpr (BBERG_NO_ASM || (T::modulus_3 >= 0x4000000000000000ULL) ||
-                  (T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0)) {
+    if constexpr (BBERG_NO_ASM || (T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0)) {
         *this = montgomery_square();
+    } else if constexpr (T::modulus_3 >= 0x4000000000000000ULL) {
+        if (std::is_constant_evaluated()) {
+            *this = montgomery_square();
+        } else {
+            asm_self_mul_full_width(*this, *this);
+        }
     } else {
         if (std::is_constant_evaluated()) {
             *this = montgomery_square();
@@ -403,54 +422,7 @@ template <class T> void field<T>::batch_invert(field* coeffs, const size_t n) no
     batch_invert(std::span{ coeffs, n });
 }
 
-template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
-{
-    BB_OP_COUNT_TRACK_NAME("fr::batch_invert");
-    const size_t n = coeffs.size();
-
-    auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
-    auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
-    auto temporaries = temporaries_ptr.get();
-    auto* skipped = skipped_ptr.get();
-
-    field accumulator = one();
-    for (size_t i = 0; i < n; ++i) {
-        temporaries[i] = accumulator;
-        if (coeffs[i].is_zero()) {
-            skipped[i] = true;
-        } else {
-            skipped[i] = false;
-            accumulator *= coeffs[i];
-        }
-    }
-
-    // std::vector<field> temporaries;
-    // std::vector<bool> skipped;
-    // temporaries.reserve(n);
-    // skipped.reserve(n);
-
-    // field accumulator = one();
-    // for (size_t i = 0; i < n; ++i) {
-    //     temporaries.emplace_back(accumulator);
-    //     if (coeffs[i].is_zero()) {
-    //         skipped.emplace_back(true);
-    //     } else {
-    //         skipped.emplace_back(false);
-    //         accumulator *= coeffs[i];
-    //     }
-    // }
-
-    accumulator = accumulator.invert();
-
-    field T0;
-    for (size_t i = n - 1; i < n; --i) {
-        if (!skipped[i]) {
-            T0 = accumulator * temporaries[i];
-            accumulator *= coeffs[i];
-            coeffs[i] = T0;
-        }
-    }
-}
+// field<T>::batch_invert(std::span<field>) is defined in field_kernels.hpp
 
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
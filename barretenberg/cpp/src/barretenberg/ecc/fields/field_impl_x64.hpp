@@ -340,6 +340,53 @@ template <class T> void field<T>::asm_conditional_negate(field& r, const uint64_
             : "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory");
 }
 
+/**
+ * Montgomery multiplication for a modulus that uses all 256 bits, e.g. the secp256k1 and secp256r1 fields.
+ * The coarse reduction of asm_mul_with_coarse_reduction requires the modulus to be smaller than 2^254, so these fields
+ * keep a 6-limb accumulator and return a fully reduced result, like montgomery_mul_big.
+ **/
+template <class T> field<T> field<T>::asm_mul_full_width(const field& a, const field& b) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::asm_mul_full_width");
+
+    // Writing the result through a third pointer (or memory operands) leaves the compiler too few registers
+    field r = a;
+    asm_self_mul_full_width(r, b);
+    return r;
+}
+
+template <class T> void field<T>::asm_self_mul_full_width(const field& a, const field& b) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::asm_self_mul_full_width");
+
+    constexpr uint64_t r_inv = T::r_inv;
+    constexpr uint64_t modulus_0 = modulus.data[0];
+    constexpr uint64_t modulus_1 = modulus.data[1];
+    constexpr uint64_t modulus_2 = modulus.data[2];
+    constexpr uint64_t modulus_3 = modulus.data[3];
+    constexpr uint64_t zero_ref = 0;
+    /**
+     * Registers: %r10, %r11, %r12, %r13, %r14, %r15: accumulator, rotated by one limb per round
+     *            %rdx: multiplier
+     *            %r8, %r9, %rdi, %rsi, %rax: scratch registers for multiplication results
+     *            %0: pointer to `a`, which is also the output
+     *            %1: pointer to `b`, which may be equal to `a`
+     **/
+    __asm__(MUL_FULL_WIDTH("%0", "%1")
+                STORE_FIELD_ELEMENT("%0", "%%r14", "%%r15", "%%r10", "%%r11")
+            :
+            : "r"(&a),
+              "r"(&b),
+              [modulus_0] "m"(modulus_0),
+              [modulus_1] "m"(modulus_1),
+              [modulus_2] "m"(modulus_2),
+              [modulus_3] "m"(modulus_3),
+              [r_inv] "m"(r_inv),
+              [zero_reference] "m"(zero_ref)
+            : "%rax", "%rdx", "%rdi", "%rsi", "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc",
+              "memory");
+}
+
 template <class T> field<T> field<T>::asm_reduce_once(const field& a) noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::asm_reduce_once");
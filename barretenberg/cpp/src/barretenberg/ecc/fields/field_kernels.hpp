@@ -0,0 +1,583 @@
+#pragma once
+
+#include "./field_impl_generic.hpp"
+#include "./field_impl_x64.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(DISABLE_ASM)
+#define BB_FIELD_KERNELS_X86_64
+#include "asm_macros.hpp"
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Field arithmetic kernels that pick their instruction set when the program runs.
+ *
+ * @details The field operators select their implementation when barretenberg is compiled: the x86-64 assembly is only
+ * used if the target architecture has BMI2, and its ADX variant only if it has ADX. A binary built for a baseline
+ * x86-64 target therefore runs the portable arithmetic even on CPUs that support both.
+ *
+ * The hot loops below (batched multiplication and squaring, batch inversion, FFT butterflies and the batched affine
+ * additions of the Pippenger MSM) instead take a FieldKernel, detected once with cpuid by `get_field_kernel`, and run
+ * the matching variant of the assembly. The AVX-512 IFMA kernel multiplies 8 elements at once with 52-bit limbs, and
+ * is used where the multiplications of a loop are independent (`batch_mul`, `batch_sqr` and `fft_butterflies`); the
+ * other kernels fall back to its scalar (ADX) arithmetic.
+ *
+ * The assembly kernels apply to fields of 2 to 4 limbs with a modulus below 2^254, whose elements are kept in [0, 2p)
+ * by every implementation, so that their results can be mixed with those of the field operators. Other fields always
+ * use the field operators.
+ */
+namespace bb::field_kernels {
+
+enum class FieldKernel { GENERIC, BMI2, ADX, AVX512_IFMA };
+
+/**
+ * @brief Whether a field kernel can run on this CPU.
+ */
+inline bool is_field_kernel_supported(const FieldKernel kernel)
+{
+#ifdef BB_FIELD_KERNELS_X86_64
+    __builtin_cpu_init();
+    const bool bmi2 = __builtin_cpu_supports("bmi2") != 0;
+#ifdef DISABLE_ADX
+    const bool adx = false;
+#else
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    const bool adx = __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0 && (ebx & bit_ADX) != 0;
+#endif
+    switch (kernel) {
+    case FieldKernel::AVX512_IFMA:
+        return bmi2 && adx && __builtin_cpu_supports("avx512f") != 0 && __builtin_cpu_supports("avx512ifma") != 0;
+    case FieldKernel::ADX:
+        return bmi2 && adx;
+    case FieldKernel::BMI2:
+        return bmi2;
+    default:
+        return true;
+    }
+#else
+    return kernel == FieldKernel::GENERIC;
+#endif
+}
+
+/**
+ * @brief The fastest field kernel supported by this CPU (detected once, using cpuid).
+ */
+inline FieldKernel get_field_kernel()
+{
+    static const FieldKernel kernel = []() {
+        for (const auto candidate : { FieldKernel::AVX512_IFMA, FieldKernel::ADX, FieldKernel::BMI2 }) {
+            if (is_field_kernel_supported(candidate)) {
+                return candidate;
+            }
+        }
+        return FieldKernel::GENERIC;
+    }();
+    return kernel;
+}
+
+inline std::string field_kernel_name(const FieldKernel kernel)
+{
+    switch (kernel) {
+    case FieldKernel::AVX512_IFMA:
+        return "avx512-ifma";
+    case FieldKernel::ADX:
+        return "adx";
+    case FieldKernel::BMI2:
+        return "bmi2";
+    default:
+        return "generic";
+    }
+}
+
+/**
+ * @brief The field arithmetic of the GENERIC kernel: the field operators, as compiled.
+ */
+template <typename Field> struct GenericOps {
+    static Field mul(const Field& a, const Field& b) noexcept { return a * b; }
+    static Field sqr(const Field& a) noexcept { return a.sqr(); }
+    static Field add(const Field& a, const Field& b) noexcept { return a + b; }
+    static Field sub(const Field& a, const Field& b) noexcept { return a - b; }
+};
+
+#ifdef BB_FIELD_KERNELS_X86_64
+/**
+ * @brief The field arithmetic of the BMI2 and ADX kernels, i.e. the assembly of field_impl_x64.hpp in the chosen
+ * variant. As there, squaring uses MUL in the BMI2 variant.
+ */
+template <typename Field, bool ADX> struct AsmOps {
+    static constexpr bool applies = Field::modulus.data[3] < 0x4000000000000000ULL &&
+                                    (Field::modulus.data[1] != 0 || Field::modulus.data[2] != 0 ||
+                                     Field::modulus.data[3] != 0);
+
+    static Field mul(const Field& a, const Field& b) noexcept
+    {
+        Field r;
+        constexpr uint64_t r_inv = Field::Params::r_inv;
+        constexpr uint64_t modulus_0 = Field::modulus.data[0];
+        constexpr uint64_t modulus_1 = Field::modulus.data[1];
+        constexpr uint64_t modulus_2 = Field::modulus.data[2];
+        constexpr uint64_t modulus_3 = Field::modulus.data[3];
+        constexpr uint64_t zero_ref = 0;
+        if constexpr (ADX) {
+            __asm__(MUL_ADX("0(%0)", "8(%0)", "16(%0)", "24(%0)", "%1")
+                        STORE_FIELD_ELEMENT("%2", "%%r12", "%%r13", "%%r14", "%%r15")
+                    :
+                    : "%r"(&a),
+                      "%r"(&b),
+                      "r"(&r),
+                      [modulus_0] "m"(modulus_0),
+                      [modulus_1] "m"(modulus_1),
+                      [modulus_2] "m"(modulus_2),
+                      [modulus_3] "m"(modulus_3),
+                      [r_inv] "m"(r_inv),
+                      [zero_reference] "m"(zero_ref)
+                    : "%rdx", "%rdi", "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory");
+        } else {
+            __asm__(MUL_BMI2("0(%0)", "8(%0)", "16(%0)", "24(%0)", "%1")
+                        STORE_FIELD_ELEMENT("%2", "%%r12", "%%r13", "%%r14", "%%r15")
+                    :
+                    : "%r"(&a),
+                      "%r"(&b),
+                      "r"(&r),
+                      [modulus_0] "m"(modulus_0),
+                      [modulus_1] "m"(modulus_1),
+                      [modulus_2] "m"(modulus_2),
+                      [modulus_3] "m"(modulus_3),
+                      [r_inv] "m"(r_inv),
+                      [zero_reference] "m"(zero_ref)
+                    : "%rdx", "%rdi", "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory");
+        }
+        return r;
+    }
+
+    static Field sqr(const Field& a) noexcept
+    {
+        if constexpr (!ADX) {
+            return mul(a, a);
+        }
+        Field r;
+        constexpr uint64_t r_inv = Field::Params::r_inv;
+        constexpr uint64_t modulus_0 = Field::modulus.data[0];
+        constexpr uint64_t modulus_1 = Field::modulus.data[1];
+        constexpr uint64_t modulus_2 = Field::modulus.data[2];
+        constexpr uint64_t modulus_3 = Field::modulus.data[3];
+        constexpr uint64_t zero_ref = 0;
+        __asm__(SQR_ADX("%0") STORE_FIELD_ELEMENT("%1", "%%r12", "%%r13", "%%r14", "%%r15")
+                :
+                : "r"(&a),
+                  "r"(&r),
+                  [zero_reference] "m"(zero_ref),
+                  [modulus_0] "m"(modulus_0),
+                  [modulus_1] "m"(modulus_1),
+                  [modulus_2] "m"(modulus_2),
+                  [modulus_3] "m"(modulus_3),
+                  [r_inv] "m"(r_inv)
+                : "%rcx", "%rdx", "%rdi", "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory");
+        return r;
+    }
+
+    static Field add(const Field& a, const Field& b) noexcept
+    {
+        Field r;
+        constexpr uint64_t twice_not_modulus_0 = Field::twice_not_modulus.data[0];
+        constexpr uint64_t twice_not_modulus_1 = Field::twice_not_modulus.data[1];
+        constexpr uint64_t twice_not_modulus_2 = Field::twice_not_modulus.data[2];
+        constexpr uint64_t twice_not_modulus_3 = Field::twice_not_modulus.data[3];
+        if constexpr (ADX) {
+            __asm__(CLEAR_FLAGS("%%r12") LOAD_FIELD_ELEMENT("%0", "%%r12", "%%r13", "%%r14", "%%r15")
+                        ADD_REDUCE_ADX("%1",
+                                       "%[twice_not_modulus_0]",
+                                       "%[twice_not_modulus_1]",
+                                       "%[twice_not_modulus_2]",
+                                       "%[twice_not_modulus_3]")
+                            STORE_FIELD_ELEMENT("%2", "%%r12", "%%r13", "%%r14", "%%r15")
+                    :
+                    : "%r"(&a),
+                      "%r"(&b),
+                      "r"(&r),
+                      [twice_not_modulus_0] "m"(twice_not_modulus_0),
+                      [twice_not_modulus_1] "m"(twice_not_modulus_1),
+                      [twice_not_modulus_2] "m"(twice_not_modulus_2),
+                      [twice_not_modulus_3] "m"(twice_not_modulus_3)
+                    : "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory");
+        } else {
+            __asm__(CLEAR_FLAGS("%%r12") LOAD_FIELD_ELEMENT("%0", "%%r12", "%%r13", "%%r14", "%%r15")
+                        ADD_REDUCE_BMI2("%1",
+                                        "%[twice_not_modulus_0]",
+                                        "%[twice_not_modulus_1]",
+                                        "%[twice_not_modulus_2]",
+                                        "%[twice_not_modulus_3]")
+                            STORE_FIELD_ELEMENT("%2", "%%r12", "%%r13", "%%r14", "%%r15")
+                    :
+                    : "%r"(&a),
+                      "%r"(&b),
+                      "r"(&r),
+                      [twice_not_modulus_0] "m"(twice_not_modulus_0),
+                      [twice_not_modulus_1] "m"(twice_not_modulus_1),
+                      [twice_not_modulus_2] "m"(twice_not_modulus_2),
+                      [twice_not_modulus_3] "m"(twice_not_modulus_3)
+                    : "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory");
+        }
+        return r;
+    }
+
+    static Field sub(const Field& a, const Field& b) noexcept
+    {
+        Field r;
+        constexpr uint64_t twice_modulus_0 = Field::twice_modulus.data[0];
+        constexpr uint64_t twice_modulus_1 = Field::twice_modulus.data[1];
+        constexpr uint64_t twice_modulus_2 = Field::twice_modulus.data[2];
+        constexpr uint64_t twice_modulus_3 = Field::twice_modulus.data[3];
+        if constexpr (ADX) {
+            __asm__(CLEAR_FLAGS("%%r12") LOAD_FIELD_ELEMENT("%0", "%%r12", "%%r13", "%%r14", "%%r15") SUB_ADX("%1")
+                        REDUCE_FIELD_ELEMENT_ADX(
+                            "%[twice_modulus_0]", "%[twice_modulus_1]", "%[twice_modulus_2]", "%[twice_modulus_3]")
+                            STORE_FIELD_ELEMENT("%2", "%%r12", "%%r13", "%%r14", "%%r15")
+                    :
+                    : "r"(&a),
+                      "r"(&b),
+                      "r"(&r),
+                      [twice_modulus_0] "m"(twice_modulus_0),
+                      [twice_modulus_1] "m"(twice_modulus_1),
+                      [twice_modulus_2] "m"(twice_modulus_2),
+                      [twice_modulus_3] "m"(twice_modulus_3)
+                    : "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory");
+        } else {
+            __asm__(CLEAR_FLAGS("%%r12") LOAD_FIELD_ELEMENT("%0", "%%r12", "%%r13", "%%r14", "%%r15") SUB_BMI2("%1")
+                        REDUCE_FIELD_ELEMENT_BMI2(
+                            "%[twice_modulus_0]", "%[twice_modulus_1]", "%[twice_modulus_2]", "%[twice_modulus_3]")
+                            STORE_FIELD_ELEMENT("%2", "%%r12", "%%r13", "%%r14", "%%r15")
+                    :
+                    : "r"(&a),
+                      "r"(&b),
+                      "r"(&r),
+                      [twice_modulus_0] "m"(twice_modulus_0),
+                      [twice_modulus_1] "m"(twice_modulus_1),
+                      [twice_modulus_2] "m"(twice_modulus_2),
+                      [twice_modulus_3] "m"(twice_modulus_3)
+                    : "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15", "cc", "memory");
+        }
+        return r;
+    }
+};
+
+using u64x8 = uint64_t __attribute__((vector_size(64)));
+
+__attribute__((target("avx512f"))) inline u64x8 ifma_permute(const u64x8 a, const u64x8 index, const u64x8 b) noexcept
+{
+    return reinterpret_cast<u64x8>(_mm512_permutex2var_epi64(
+        reinterpret_cast<__m512i>(a), reinterpret_cast<__m512i>(index), reinterpret_cast<__m512i>(b)));
+}
+
+// acc + the low (resp. high) 52 bits of the product of the low 52 bits of a and b
+__attribute__((target("avx512f,avx512ifma"))) inline u64x8 ifma_madd_lo(const u64x8 acc,
+                                                                       const u64x8 a,
+                                                                       const u64x8 b) noexcept
+{
+    return reinterpret_cast<u64x8>(_mm512_madd52lo_epu64(
+        reinterpret_cast<__m512i>(acc), reinterpret_cast<__m512i>(a), reinterpret_cast<__m512i>(b)));
+}
+
+__attribute__((target("avx512f,avx512ifma"))) inline u64x8 ifma_madd_hi(const u64x8 acc,
+                                                                       const u64x8 a,
+                                                                       const u64x8 b) noexcept
+{
+    return reinterpret_cast<u64x8>(_mm512_madd52hi_epu64(
+        reinterpret_cast<__m512i>(acc), reinterpret_cast<__m512i>(a), reinterpret_cast<__m512i>(b)));
+}
+
+// The two steps of the transposition of 8 elements into the vectors of their limbs; each is its own inverse
+constexpr u64x8 IFMA_INTERLEAVE_0 = { 0, 4, 8, 12, 1, 5, 9, 13 };
+constexpr u64x8 IFMA_INTERLEAVE_1 = { 2, 6, 10, 14, 3, 7, 11, 15 };
+constexpr u64x8 IFMA_LOW_HALVES = { 0, 1, 2, 3, 8, 9, 10, 11 };
+constexpr u64x8 IFMA_HIGH_HALVES = { 4, 5, 6, 7, 12, 13, 14, 15 };
+constexpr uint64_t IFMA_MASK_52 = (1ULL << 52) - 1;
+
+/**
+ * @brief Transposes 8 consecutive field elements into the vectors of their limbs (lane i holding element i), as 5
+ * limbs of 52 bits.
+ */
+__attribute__((target("avx512f"))) inline void ifma_load_8(const void* elements, u64x8* limbs) noexcept
+{
+    u64x8 z[4];
+    std::memcpy(&z[0], elements, sizeof(z));
+    // Gather the limbs 0 and 1 (resp. 2 and 3) of pairs of elements, then of all 8
+    const u64x8 a01 = ifma_permute(z[0], IFMA_INTERLEAVE_0, z[1]);
+    const u64x8 a23 = ifma_permute(z[0], IFMA_INTERLEAVE_1, z[1]);
+    const u64x8 b01 = ifma_permute(z[2], IFMA_INTERLEAVE_0, z[3]);
+    const u64x8 b23 = ifma_permute(z[2], IFMA_INTERLEAVE_1, z[3]);
+    const u64x8 x0 = ifma_permute(a01, IFMA_LOW_HALVES, b01);
+    const u64x8 x1 = ifma_permute(a01, IFMA_HIGH_HALVES, b01);
+    const u64x8 x2 = ifma_permute(a23, IFMA_LOW_HALVES, b23);
+    const u64x8 x3 = ifma_permute(a23, IFMA_HIGH_HALVES, b23);
+    limbs[0] = x0 & IFMA_MASK_52;
+    limbs[1] = ((x0 >> 52) | (x1 << 12)) & IFMA_MASK_52;
+    limbs[2] = ((x1 >> 40) | (x2 << 24)) & IFMA_MASK_52;
+    limbs[3] = ((x2 >> 28) | (x3 << 36)) & IFMA_MASK_52;
+    limbs[4] = x3 >> 16;
+}
+
+/**
+ * @brief The inverse of ifma_load_8, for 6 normalized 52-bit limbs of which the lowest 48 bits are zero (i.e. it also
+ * divides by 2^48).
+ */
+__attribute__((target("avx512f"))) inline void ifma_store_8(void* elements, const u64x8* limbs) noexcept
+{
+    const u64x8 x0 = (limbs[0] >> 48) | (limbs[1] << 4) | (limbs[2] << 56);
+    const u64x8 x1 = (limbs[2] >> 8) | (limbs[3] << 44);
+    const u64x8 x2 = (limbs[3] >> 20) | (limbs[4] << 32);
+    const u64x8 x3 = (limbs[4] >> 32) | (limbs[5] << 20);
+    const u64x8 a01 = ifma_permute(x0, IFMA_LOW_HALVES, x1);
+    const u64x8 b01 = ifma_permute(x0, IFMA_HIGH_HALVES, x1);
+    const u64x8 a23 = ifma_permute(x2, IFMA_LOW_HALVES, x3);
+    const u64x8 b23 = ifma_permute(x2, IFMA_HIGH_HALVES, x3);
+    const u64x8 z[4] = {
+        ifma_permute(a01, IFMA_INTERLEAVE_0, a23),
+        ifma_permute(a01, IFMA_INTERLEAVE_1, a23),
+        ifma_permute(b01, IFMA_INTERLEAVE_0, b23),
+        ifma_permute(b01, IFMA_INTERLEAVE_1, b23),
+    };
+    std::memcpy(elements, &z[0], sizeof(z));
+}
+
+/**
+ * @brief Montgomery multiplication of 8 pairs of elements at once, with AVX-512 IFMA.
+ *
+ * @details The product is reduced one 52-bit limb per round; the last round only divides by 2^48, so that the total
+ * is 2^256, the Montgomery radix of the field. The limbs of the accumulator may grow past 52 bits (vpmadd52 only reads
+ * the low 52 bits of its inputs, and the accumulator is only an input to compute the reduction factor), and are
+ * normalized at the end. As for the assembly, the result is below 2p.
+ */
+template <typename Field>
+__attribute__((target("avx512f,avx512ifma"))) inline void ifma_mul_8(Field* r, const Field* a, const Field* b) noexcept
+{
+    constexpr auto modulus_limb = [](const size_t i) {
+        const size_t bit = 52 * i;
+        const size_t word = bit / 64;
+        const size_t shift = bit % 64;
+        uint64_t limb = Field::modulus.data[word] >> shift;
+        if (shift > 12 && word < 3) {
+            limb |= Field::modulus.data[word + 1] << (64 - shift);
+        }
+        return limb & IFMA_MASK_52;
+    };
+    constexpr uint64_t r_inv = Field::Params::r_inv & IFMA_MASK_52;
+    const u64x8 zero = {};
+
+    u64x8 lhs[5];
+    u64x8 rhs[5];
+    ifma_load_8(a, lhs);
+    ifma_load_8(b, rhs);
+
+    u64x8 t[6] = { zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = ifma_madd_lo(t[j], lhs[i], rhs[j]);
+            t[j + 1] = ifma_madd_hi(t[j + 1], lhs[i], rhs[j]);
+        }
+        u64x8 k = ifma_madd_lo(zero, t[0], zero + r_inv);
+        if (i == 4) {
+            k &= (1ULL << 48) - 1;
+        }
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = ifma_madd_lo(t[j], k, zero + modulus_limb(j));
+            t[j + 1] = ifma_madd_hi(t[j + 1], k, zero + modulus_limb(j));
+        }
+        if (i < 4) {
+            // t[0] is now a multiple of 2^52
+            t[1] += t[0] >> 52;
+            for (size_t j = 0; j < 5; ++j) {
+                t[j] = t[j + 1];
+            }
+            t[5] = zero;
+        }
+    }
+
+    // Normalize the limbs; the low 48 bits of the result are zero
+    for (size_t j = 0; j < 5; ++j) {
+        t[j + 1] += t[j] >> 52;
+        t[j] &= IFMA_MASK_52;
+    }
+    ifma_store_8(r, t);
+}
+#endif
+
+/**
+ * @brief Calls `func` with the (default-constructed) arithmetic of `kernel` for Field, i.e. a type with static
+ * functions mul, sqr, add and sub.
+ */
+template <typename Field, typename Func> decltype(auto) with_field_ops(const FieldKernel kernel, Func&& func)
+{
+#ifdef BB_FIELD_KERNELS_X86_64
+    if constexpr (AsmOps<Field, true>::applies) {
+        switch (kernel) {
+        case FieldKernel::AVX512_IFMA:
+        case FieldKernel::ADX:
+            return func(AsmOps<Field, true>{});
+        case FieldKernel::BMI2:
+            return func(AsmOps<Field, false>{});
+        default:
+            break;
+        }
+    }
+#else
+    static_cast<void>(kernel);
+#endif
+    return func(GenericOps<Field>{});
+}
+
+/**
+ * @brief Computes r[i] = a[i] * b[i] for the n first elements of r, a and b, which may alias.
+ */
+template <typename Field>
+void batch_mul(Field* r, const Field* a, const Field* b, const size_t n, const FieldKernel kernel = get_field_kernel())
+{
+    size_t i = 0;
+#ifdef BB_FIELD_KERNELS_X86_64
+    if constexpr (AsmOps<Field, true>::applies) {
+        if (kernel == FieldKernel::AVX512_IFMA) {
+            for (; i + 8 <= n; i += 8) {
+                ifma_mul_8(r + i, a + i, b + i);
+            }
+        }
+    }
+#endif
+    with_field_ops<Field>(kernel, [&](auto ops) {
+        for (; i < n; ++i) {
+            r[i] = ops.mul(a[i], b[i]);
+        }
+    });
+}
+
+/**
+ * @brief Computes r[i] = a[i]^2 for the n first elements of r and a, which may alias.
+ */
+template <typename Field>
+void batch_sqr(Field* r, const Field* a, const size_t n, const FieldKernel kernel = get_field_kernel())
+{
+    if (kernel == FieldKernel::AVX512_IFMA) {
+        batch_mul(r, a, a, n, kernel);
+        return;
+    }
+    with_field_ops<Field>(kernel, [&](auto ops) {
+        for (size_t i = 0; i < n; ++i) {
+            r[i] = ops.sqr(a[i]);
+        }
+    });
+}
+
+/**
+ * @brief Replaces each non-zero element of `coeffs` by its inverse (see field::batch_invert).
+ */
+template <typename Field> void batch_invert(std::span<Field> coeffs, const FieldKernel kernel = get_field_kernel())
+{
+    const size_t n = coeffs.size();
+
+    auto temporaries_ptr = std::static_pointer_cast<Field[]>(get_mem_slab(n * sizeof(Field)));
+    auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
+    auto temporaries = temporaries_ptr.get();
+    auto* skipped = skipped_ptr.get();
+
+    with_field_ops<Field>(kernel, [&](auto ops) {
+        Field accumulator = Field::one();
+        for (size_t i = 0; i < n; ++i) {
+            temporaries[i] = accumulator;
+            if (coeffs[i].is_zero()) {
+                skipped[i] = true;
+            } else {
+                skipped[i] = false;
+                accumulator = ops.mul(accumulator, coeffs[i]);
+            }
+        }
+
+        accumulator = accumulator.invert();
+
+        Field T0;
+        for (size_t i = n - 1; i < n; --i) {
+            if (!skipped[i]) {
+                T0 = ops.mul(accumulator, temporaries[i]);
+                accumulator = ops.mul(accumulator, coeffs[i]);
+                coeffs[i] = T0;
+            }
+        }
+    });
+}
+
+/**
+ * @brief Runs iterations [start, end) of an FFT round over `values`, flattened as in fft_inner_parallel: iteration i
+ * is the butterfly of values[k + j] and values[k + j + m] with round_roots[j], where j = i mod m and k = 2 * (i - j).
+ */
+template <typename Field>
+void fft_butterflies(Field* values,
+                     const Field* round_roots,
+                     const size_t m,
+                     const size_t start,
+                     const size_t end,
+                     const FieldKernel kernel = get_field_kernel())
+{
+    // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the root table),
+    // but we want to flatten this out - as for the first few rounds, the inner loop will be tiny and we'll have quite
+    // a bit of unneccesary branch checks For each iteration of our flattened loop, indexed by `i`, the element of the
+    // root table we need to access will be `i % (current round subgroup size)` Given that each round subgroup size is
+    // `m`, which is a power of 2, we can index the root table with a very cheap `i & (m - 1)` Which is why we have this
+    // odd `block_mask` variable
+    const size_t block_mask = m - 1;
+
+    // The next problem to tackle, is we now need to efficiently index the polynomial element in `values` in our
+    // flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates from 0 to 'domain size', in steps of
+    // 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We have our inner loop indexer with `i & (m - 1)`.
+    // We need to add to this our outer loop indexer, which is equivalent to taking our indexer `i`, masking out the
+    // bits used in the 'inner loop', and doubling the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m -
+    // 1)) >> 1) To simplify this, we cache index_mask = ~block_mask, meaning that our indexer is just `((i &
+    // index_mask) << 1 + (i & block_mask)`
+    const size_t index_mask = ~block_mask;
+    with_field_ops<Field>(kernel, [&](auto ops) {
+#ifdef BB_FIELD_KERNELS_X86_64
+        const bool vectorized = kernel == FieldKernel::AVX512_IFMA && m >= 8;
+#endif
+        Field temp[8];
+        size_t i = start;
+        while (i < end) {
+            Field* lhs = values + ((i & index_mask) << 1) + (i & block_mask);
+#ifdef BB_FIELD_KERNELS_X86_64
+            if constexpr (AsmOps<Field, true>::applies) {
+                // Within a block, the roots and the second values of 8 aligned butterflies are contiguous
+                if (vectorized && (i & 7) == 0 && i + 8 <= end) {
+                    ifma_mul_8(temp, round_roots + (i & block_mask), lhs + m);
+                    for (size_t l = 0; l < 8; ++l) {
+                        lhs[l + m] = ops.sub(lhs[l], temp[l]);
+                        lhs[l] = ops.add(lhs[l], temp[l]);
+                    }
+                    i += 8;
+                    continue;
+                }
+            }
+#endif
+            temp[0] = ops.mul(round_roots[i & block_mask], lhs[m]);
+            lhs[m] = ops.sub(lhs[0], temp[0]);
+            lhs[0] = ops.add(lhs[0], temp[0]);
+            ++i;
+        }
+    });
+}
+
+} // namespace bb::field_kernels
+
+namespace bb {
+
+template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::batch_invert");
+    field_kernels::batch_invert(coeffs);
+}
+
+} // namespace bb
@@ -1,7 +1,10 @@
 #include "wnaf.hpp"
 #include "../curves/bn254/fr.hpp"
+#include "barretenberg/ecc/scalar_multiplication/wnaf_batch.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <gtest/gtest.h>
+#include <memory>
+#include <vector>
 
 using namespace bb;
 
@@ -173,4 +176,63 @@ TEST(wnaf, WnafFixedWithEndoSplit)
     EXPECT_EQ(result, k);
 }
 
+TEST(wnaf, WnafBatchMatchesFixedWnafWithCounts)
+{
+    using scalar_multiplication::WnafKernel;
+    // Not a multiple of the block size or of the vector widths
+    constexpr size_t num_scalars = 203;
+    std::vector<uint64_t> scalars(2 * num_scalars);
+    for (size_t i = 0; i < num_scalars; ++i) {
+        scalars[2 * i] = engine.get_random_uint64();
+        scalars[2 * i + 1] = engine.get_random_uint64() & 0x7fffffffffffffffUL;
+        // Zero, small and short scalars
+        if (i % 7 == 0) {
+            scalars[2 * i + 1] = 0;
+            scalars[2 * i] >>= i % 64;
+        }
+    }
+    scalars[0] = 0;
+    scalars[2] = 1;
+    scalars[4] = 2;
+
+    for (const size_t wnaf_bits : std::array<size_t, 6>{ 2, 5, 8, 13, 16, 21 }) {
+        const size_t num_rounds = WNAF_SIZE(wnaf_bits);
+        const uint64_t point_index = 5UL << 32UL;
+        std::vector<uint64_t> expected_wnaf(num_rounds * num_scalars);
+        std::vector<uint64_t> expected_counts(num_rounds, 0);
+        auto expected_skews = std::make_unique<bool[]>(num_scalars);
+        for (size_t i = 0; i < num_scalars; ++i) {
+            wnaf::fixed_wnaf_with_counts(&scalars[2 * i],
+                                         &expected_wnaf[i],
+                                         expected_skews[i],
+                                         expected_counts.data(),
+                                         point_index + (i << 32UL),
+                                         num_scalars,
+                                         wnaf_bits);
+        }
+
+        for (const auto kernel : { WnafKernel::SCALAR, WnafKernel::AVX2, WnafKernel::AVX512 }) {
+            if (!scalar_multiplication::is_wnaf_kernel_supported(kernel)) {
+                continue;
+            }
+            std::vector<uint64_t> wnaf(num_rounds * num_scalars);
+            std::vector<uint64_t> counts(num_rounds, 0);
+            auto skews = std::make_unique<bool[]>(num_scalars);
+            scalar_multiplication::fixed_wnaf_with_counts_batch(scalars.data(),
+                                                                num_scalars,
+                                                                wnaf.data(),
+                                                                skews.get(),
+                                                                counts.data(),
+                                                                point_index,
+                                                                num_scalars,
+                                                                wnaf_bits,
+                                                                kernel);
+            EXPECT_EQ(wnaf, expected_wnaf);
+            EXPECT_EQ(counts, expected_counts);
+            for (size_t i = 0; i < num_scalars; ++i) {
+                EXPECT_EQ(skews[i], expected_skews[i]);
+            }
+        }
+    }
+}
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays)
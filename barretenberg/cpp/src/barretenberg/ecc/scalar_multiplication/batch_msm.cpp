@@ -0,0 +1,353 @@
+#include "./batch_msm.hpp"
+#include "./process_buckets.hpp"
+#include "./scalar_multiplication.hpp"
+#include "./wnaf_batch.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/wnaf.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+
+// Upper bound on the number of (unsorted) schedule entries of the MSMs processed together.
+constexpr size_t MAX_GROUP_SCHEDULE_SIZE = 1UL << 23;
+// Upper bound on the number of schedule entries reduced in one go. Beyond a few thousand entries, a longer batch
+// inversion saves nothing, while the point pairs of a chunk should stay in cache.
+constexpr size_t MAX_CHUNK_CAPACITY = 1UL << 16;
+// `construct_addition_chains` prefetches up to 32 schedule entries past the end of a chunk.
+constexpr size_t SCHEDULE_OVERFLOW = 32;
+
+template <typename T> std::shared_ptr<T[]> slab_alloc(const size_t num_elements)
+{
+    return std::static_pointer_cast<T[]>(get_mem_slab(num_elements * sizeof(T)));
+}
+
+// The window of an MSM of a given size, and the layout of its wnaf table within the group.
+struct MsmLayout {
+    size_t num_points;
+    size_t bucket_width;
+    size_t num_rounds;
+    size_t schedule_offset;
+    size_t skew_offset;
+};
+
+// One round of one MSM: its sorted entries occupy [start, end) of the group schedule and use the buckets
+// [bucket_offset, bucket_offset + 2^{bucket_width}). Round `num_rounds` is the skew correction of the MSM.
+struct Segment {
+    size_t msm;
+    size_t round;
+    size_t start;
+    size_t end;
+    size_t bucket_offset;
+};
+
+/**
+ * @brief Given the reduced buckets of a chunk, computes ∑ₖ (2k + 1)⋅bucket[k] over the buckets [lo, hi] of the chunk,
+ * where k is relative to `base_bucket`. `output_it` is the index of the reduced bucket `hi` (if it is not empty), and
+ * is moved below the bucket `lo`.
+ */
+template <typename Curve>
+typename Curve::Element accumulate_bucket_range(const affine_product_runtime_state<Curve>& state,
+                                                const typename Curve::AffineElement* output_buckets,
+                                                size_t& output_it,
+                                                const size_t first_bucket,
+                                                const size_t lo,
+                                                const size_t hi,
+                                                const size_t base_bucket)
+{
+    using Element = typename Curve::Element;
+    Element accumulator;
+    accumulator.self_set_infinity();
+    Element running_sum;
+    running_sum.self_set_infinity();
+
+    for (size_t k = hi + 1; k-- > lo;) {
+        if (!state.bucket_empty_status[k - first_bucket]) {
+            running_sum += output_buckets[output_it];
+            --output_it;
+        }
+        if (k > lo) {
+            accumulator += running_sum;
+        }
+    }
+    accumulator.self_dbl();
+    accumulator += running_sum;
+
+    // Account for the buckets below `lo`: add 2 * (lo - base_bucket) * running_sum
+    const auto multiplier = static_cast<uint64_t>((lo - base_bucket) << 1UL);
+    if (multiplier > 0) {
+        Element scaled = running_sum;
+        for (size_t bit = numeric::get_msb(multiplier); bit > 0; --bit) {
+            scaled.self_dbl();
+            if (((multiplier >> (bit - 1)) & 1UL) == 1UL) {
+                scaled += running_sum;
+            }
+        }
+        accumulator += scaled;
+    }
+    return accumulator;
+}
+
+/**
+ * @brief Computes the MSMs [msm_start, msm_end) of the batch together.
+ */
+template <typename Curve>
+void evaluate_group(std::span<const std::span<const typename Curve::ScalarField>> scalars,
+                    typename Curve::AffineElement* point_table,
+                    const size_t msm_start,
+                    const size_t msm_end,
+                    std::vector<typename Curve::Element>& results)
+{
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t num_threads = get_num_cpus_pow2();
+    const size_t num_msms = msm_end - msm_start;
+
+    std::vector<MsmLayout> layouts(num_msms);
+    size_t schedule_size = 0;
+    size_t skew_size = 0;
+    for (size_t k = 0; k < num_msms; ++k) {
+        auto& layout = layouts[k];
+        layout.num_points = scalars[msm_start + k].size();
+        layout.bucket_width = get_optimal_bucket_width(layout.num_points);
+        layout.num_rounds = WNAF_SIZE(layout.bucket_width + 1);
+        layout.schedule_offset = schedule_size;
+        layout.skew_offset = skew_size;
+        schedule_size += layout.num_rounds * 2 * layout.num_points;
+        skew_size += 2 * layout.num_points;
+    }
+
+    // Compute the wnaf digits of the endomorphism-split scalars of every MSM, laid out as in `compute_wnaf_states`.
+    auto wnaf_schedule = slab_alloc<uint64_t>(schedule_size);
+    auto skew_table = slab_alloc<bool>(skew_size);
+    std::vector<std::vector<std::vector<uint64_t>>> thread_round_counts(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        auto& round_counts = thread_round_counts[thread_idx];
+        round_counts.resize(num_msms);
+        for (size_t k = 0; k < num_msms; ++k) {
+            const auto& layout = layouts[k];
+            const auto& msm_scalars = scalars[msm_start + k];
+            // The last count is the number of skews
+            round_counts[k].resize(layout.num_rounds + 1, 0);
+            uint64_t* schedule = wnaf_schedule.get() + layout.schedule_offset;
+            bool* skews = skew_table.get() + layout.skew_offset;
+            const size_t start = (thread_idx * layout.num_points) / num_threads;
+            const size_t end = ((thread_idx + 1) * layout.num_points) / num_threads;
+            std::array<uint64_t, 4 * WNAF_BLOCK_SIZE> split_scalars;
+            for (size_t block_start = start; block_start < end; block_start += WNAF_BLOCK_SIZE) {
+                const size_t block_size = std::min(WNAF_BLOCK_SIZE, end - block_start);
+                for (size_t j = 0; j < block_size; ++j) {
+                    Fr k1;
+                    Fr k2;
+                    Fr::split_into_endomorphism_scalars(msm_scalars[block_start + j].from_montgomery_form(), k1, k2);
+                    std::copy(&k1.data[0], &k1.data[2], &split_scalars[4 * j]);
+                    std::copy(&k2.data[0], &k2.data[2], &split_scalars[4 * j + 2]);
+                }
+                fixed_wnaf_with_counts_batch(&split_scalars[0],
+                                             2 * block_size,
+                                             schedule + 2 * block_start,
+                                             skews + 2 * block_start,
+                                             round_counts[k].data(),
+                                             (2 * block_start) << 32UL,
+                                             2 * layout.num_points,
+                                             layout.bucket_width + 1);
+            }
+            for (size_t i = 2 * start; i < 2 * end; ++i) {
+                round_counts[k][layout.num_rounds] += static_cast<uint64_t>(skews[i]);
+            }
+        }
+    });
+
+    // Give every round its place in the group schedule and its own range of buckets. wnaf digits are odd, so even
+    // scalars were incremented; the skew correction is a final round that subtracts these points from a single bucket.
+    std::vector<Segment> segments;
+    size_t num_entries = 0;
+    size_t num_buckets = 0;
+    size_t max_num_segment_buckets = 1;
+    for (size_t k = 0; k < num_msms; ++k) {
+        const size_t num_segment_buckets = 1UL << layouts[k].bucket_width;
+        max_num_segment_buckets = std::max(max_num_segment_buckets, num_segment_buckets);
+        for (size_t round = 0; round <= layouts[k].num_rounds; ++round) {
+            size_t count = 0;
+            for (const auto& round_counts : thread_round_counts) {
+                count += round_counts[k][round];
+            }
+            segments.push_back({ k, round, num_entries, num_entries + count, num_buckets });
+            num_entries += count;
+            num_buckets += round < layouts[k].num_rounds ? num_segment_buckets : 1;
+        }
+    }
+    ASSERT(num_buckets <= 0x7fffffffUL);
+
+    // Sort each round by bucket and move its (non-empty, which are sorted first) entries into the group schedule.
+    auto schedule = slab_alloc<uint64_t>(num_entries + SCHEDULE_OVERFLOW);
+    std::fill_n(schedule.get() + num_entries, SCHEDULE_OVERFLOW, 0);
+    parallel_for(segments.size(), [&](size_t s) {
+        const auto& segment = segments[s];
+        const auto& layout = layouts[segment.msm];
+        if (segment.round == layout.num_rounds) {
+            const bool* skews = skew_table.get() + layout.skew_offset;
+            uint64_t* entry = schedule.get() + segment.start;
+            for (size_t i = 0; i < 2 * layout.num_points; ++i) {
+                if (skews[i]) {
+                    *entry++ = (static_cast<uint64_t>(i) << 32UL) | (1UL << 31UL) | segment.bucket_offset;
+                }
+            }
+            return;
+        }
+        uint64_t* row = wnaf_schedule.get() + layout.schedule_offset + segment.round * 2 * layout.num_points;
+        process_buckets(row, 2 * layout.num_points, static_cast<uint32_t>(layout.bucket_width + 1));
+        for (size_t i = 0; i < segment.end - segment.start; ++i) {
+            schedule.get()[segment.start + i] = row[i] + segment.bucket_offset;
+        }
+    });
+    const auto get_bucket = [&](size_t entry) { return static_cast<size_t>(schedule.get()[entry] & 0x7fffffffU); };
+
+    // Split the schedule into chunks of at most `chunk_capacity` entries that span at most `max_num_segment_buckets`
+    // buckets, so that the bucket counts of any chunk fit in a thread's scratch space.
+    const size_t chunk_capacity =
+        std::clamp((num_entries + num_threads - 1) / num_threads, static_cast<size_t>(1), MAX_CHUNK_CAPACITY);
+    std::vector<std::pair<size_t, size_t>> chunks;
+    size_t chunk_start = 0;
+    for (const auto& segment : segments) {
+        if (segment.start == segment.end) {
+            continue;
+        }
+        if (chunk_start < segment.start &&
+            get_bucket(segment.end - 1) - get_bucket(chunk_start) >= max_num_segment_buckets) {
+            chunks.emplace_back(chunk_start, segment.start);
+            chunk_start = segment.start;
+        }
+        while (segment.end - chunk_start >= chunk_capacity) {
+            chunks.emplace_back(chunk_start, chunk_start + chunk_capacity);
+            chunk_start += chunk_capacity;
+        }
+    }
+    if (chunk_start < num_entries) {
+        chunks.emplace_back(chunk_start, num_entries);
+    }
+
+    // Reduce the buckets of each chunk, then accumulate them separately for each round it overlaps.
+    auto point_pairs_1 = slab_alloc<AffineElement>(num_threads * (chunk_capacity + 16));
+    auto point_pairs_2 = slab_alloc<AffineElement>(num_threads * (chunk_capacity + 16));
+    auto scratch_space = slab_alloc<typename Curve::BaseField>(num_threads * chunk_capacity);
+    auto bucket_counts = slab_alloc<uint32_t>(num_threads * max_num_segment_buckets);
+    auto bit_offsets = slab_alloc<uint32_t>(num_threads * 64);
+    auto bucket_empty_status = slab_alloc<bool>(num_threads * max_num_segment_buckets);
+    std::vector<std::vector<std::pair<size_t, Element>>> chunk_sums(chunks.size());
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        for (size_t chunk = thread_idx; chunk < chunks.size(); chunk += num_threads) {
+            const auto [start, end] = chunks[chunk];
+            const size_t first_bucket = get_bucket(start);
+            const size_t last_bucket = get_bucket(end - 1);
+
+            // The rounds overlapping the chunk, and their bucket ranges within it (before `reduce_buckets` rewrites the
+            // schedule).
+            std::vector<std::array<size_t, 3>> ranges;
+            auto segment_it = std::upper_bound(
+                segments.begin(), segments.end(), start, [](size_t pos, const Segment& s) { return pos < s.end; });
+            for (; segment_it != segments.end() && segment_it->start < end; ++segment_it) {
+                if (segment_it->start == segment_it->end) {
+                    continue;
+                }
+                const size_t lo = get_bucket(std::max(start, segment_it->start));
+                const size_t hi = get_bucket(std::min(end, segment_it->end) - 1);
+                ranges.push_back({ static_cast<size_t>(segment_it - segments.begin()), lo, hi });
+            }
+
+            affine_product_runtime_state<Curve> state;
+            state.points = point_table;
+            state.point_pairs_1 = point_pairs_1.get() + thread_idx * (chunk_capacity + 16);
+            state.point_pairs_2 = point_pairs_2.get() + thread_idx * (chunk_capacity + 16);
+            state.scratch_space = scratch_space.get() + thread_idx * chunk_capacity;
+            state.bucket_counts = bucket_counts.get() + thread_idx * max_num_segment_buckets;
+            state.bit_offsets = bit_offsets.get() + thread_idx * 64;
+            state.bucket_empty_status = bucket_empty_status.get() + thread_idx * max_num_segment_buckets;
+            state.point_schedule = schedule.get() + start;
+            state.num_points = static_cast<uint32_t>(end - start);
+            state.num_buckets = static_cast<uint32_t>(last_bucket - first_bucket + 1);
+
+            const AffineElement* output_buckets = reduce_buckets<Curve>(state, true, false);
+            size_t output_it = state.num_points - 1;
+            for (auto range = ranges.rbegin(); range != ranges.rend(); ++range) {
+                const auto [segment_idx, lo, hi] = *range;
+                chunk_sums[chunk].emplace_back(
+                    segment_idx,
+                    accumulate_bucket_range<Curve>(
+                        state, output_buckets, output_it, first_bucket, lo, hi, segments[segment_idx].bucket_offset));
+            }
+        }
+    });
+
+    std::vector<Element> round_sums(segments.size());
+    for (auto& round_sum : round_sums) {
+        round_sum.self_set_infinity();
+    }
+    for (const auto& sums : chunk_sums) {
+        for (const auto& [segment_idx, sum] : sums) {
+            round_sums[segment_idx] += sum;
+        }
+    }
+
+    // Combine the rounds of each MSM, most significant first, then apply the skew correction.
+    for (size_t s = 0; s < segments.size(); ++s) {
+        Element& result = results[msm_start + segments[s].msm];
+        if (segments[s].round > 0 && segments[s].round < layouts[segments[s].msm].num_rounds) {
+            for (size_t i = 0; i < layouts[segments[s].msm].bucket_width + 1; ++i) {
+                result.self_dbl();
+            }
+        }
+        result += round_sums[s];
+    }
+}
+
+} // namespace
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars, typename Curve::AffineElement* point_table)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+
+    std::vector<Element> results(scalars.size());
+    for (auto& result : results) {
+        result.self_set_infinity();
+    }
+
+    // Group consecutive MSMs while their wnaf tables fit in the budget (an MSM larger than the budget is on its own).
+    size_t group_start = 0;
+    size_t group_size = 0;
+    for (size_t k = 0; k < scalars.size(); ++k) {
+        const size_t num_points = scalars[k].size();
+        const size_t msm_size = WNAF_SIZE(get_optimal_bucket_width(num_points) + 1) * 2 * num_points;
+        if (group_size > 0 && group_size + msm_size > MAX_GROUP_SCHEDULE_SIZE) {
+            evaluate_group<Curve>(scalars, point_table, group_start, k, results);
+            group_start = k;
+            group_size = 0;
+        }
+        group_size += msm_size;
+    }
+    if (group_size > 0) {
+        evaluate_group<Curve>(scalars, point_table, group_start, scalars.size(), results);
+    }
+    return results;
+}
+
+template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars, curve::BN254::AffineElement* point_table);
+template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    curve::Grumpkin::AffineElement* point_table);
+
+} // namespace bb::scalar_multiplication
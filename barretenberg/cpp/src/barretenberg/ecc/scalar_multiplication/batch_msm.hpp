@@ -0,0 +1,35 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Computes a batch of MSMs against the same base points: for each k, ∑ᵢ scalars[k][i]⋅Pᵢ.
+ *
+ * @details Running `pippenger_unsafe` once per MSM dispatches threads for every phase of every MSM, and each thread
+ * batches the affine additions (and their inversion) of its share of a single round. Here, the rounds of all MSMs in
+ * the batch are laid out in one schedule, one after another, and every round gets its own range of buckets. That
+ * schedule is split into equal chunks that are reduced with `reduce_buckets` without regard for MSM or round
+ * boundaries, so that:
+ * - each phase (wnaf digits, sorting, bucket reduction) is a single thread dispatch for the batch;
+ * - a batch inversion in `add_affine_points` covers the additions of several rounds or MSMs when these are small;
+ * - small and large MSMs are balanced across threads.
+ * The skew correction of each MSM is one more round, with a single bucket, so it also uses affine additions.
+ *
+ * The schedule of a batch is bounded in size; larger batches are processed in several groups.
+ *
+ * Like `pippenger_unsafe`, this uses incomplete affine addition formulae: the base points must be linearly
+ * independent (as in an SRS).
+ *
+ * @param scalars The scalars of each MSM. MSMs may have different sizes.
+ * @param point_table A pippenger point table (see `generate_pippenger_point_table`) of at least the largest MSM size.
+ * @return The result of each MSM.
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars, typename Curve::AffineElement* point_table);
+
+} // namespace bb::scalar_multiplication
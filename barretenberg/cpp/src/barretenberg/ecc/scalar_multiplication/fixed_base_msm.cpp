@@ -0,0 +1,309 @@
+#include "./fixed_base_msm.hpp"
+#include "./process_buckets.hpp"
+#include "./scalar_multiplication.hpp"
+#include "./wnaf_batch.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/wnaf.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+
+// The largest window we consider. The bucket accumulation of a window costs 2^{width + 1} additions, so wider windows
+// only pay off for MSMs far larger than any SRS we use.
+constexpr size_t MAX_BUCKET_WIDTH = 22;
+// Upper bound on the number of schedule entries reduced in one go, see `construct_addition_chains`.
+constexpr size_t MAX_CHUNK_CAPACITY = 1UL << 20;
+// `construct_addition_chains` prefetches up to 32 schedule entries past the end of a chunk.
+constexpr size_t SCHEDULE_OVERFLOW = 32;
+
+/**
+ * @brief Estimates the cost, in batched affine additions, of an MSM of `num_points` points with windows of
+ * `bucket_width + 1` bits and `num_shifts` precomputed shifts per point. `num_shifts == 1` describes plain pippenger.
+ *
+ * @details Every wnaf entry costs one batched affine addition. Accumulating a set of buckets costs two projective
+ * additions per bucket, each worth about two affine ones.
+ */
+size_t estimate_msm_cost(const size_t num_points, const size_t bucket_width, const size_t num_shifts)
+{
+    const size_t num_rounds = WNAF_SIZE(bucket_width + 1);
+    const size_t num_passes = (num_rounds + num_shifts - 1) / num_shifts;
+    return num_rounds * 2 * num_points + num_passes * (4UL << bucket_width);
+}
+
+template <typename T> std::shared_ptr<T[]> slab_alloc(const size_t num_elements)
+{
+    return std::static_pointer_cast<T[]>(get_mem_slab(num_elements * sizeof(T)));
+}
+
+/**
+ * @brief Given the reduced buckets of one chunk of a sorted point schedule, computes ∑ₖ (2k + 1)⋅bucket[k], where k
+ * ranges over the (absolute) bucket indices of the chunk.
+ */
+template <typename Curve>
+typename Curve::Element accumulate_buckets(const affine_product_runtime_state<Curve>& state,
+                                           const typename Curve::AffineElement* output_buckets,
+                                           const size_t first_bucket,
+                                           const size_t num_buckets)
+{
+    using Element = typename Curve::Element;
+    Element accumulator;
+    accumulator.self_set_infinity();
+    Element running_sum;
+    running_sum.self_set_infinity();
+
+    size_t output_it = state.num_points - 1;
+    for (size_t k = num_buckets - 1; k > 0; --k) {
+        if (__builtin_expect(!state.bucket_empty_status[k], 1)) {
+            running_sum += output_buckets[output_it];
+            --output_it;
+        }
+        accumulator += running_sum;
+    }
+    running_sum += output_buckets[0];
+    accumulator.self_dbl();
+    accumulator += running_sum;
+
+    // Account for the buckets below the chunk: add 2 * first_bucket * running_sum
+    if (first_bucket > 0) {
+        const auto multiplier = static_cast<uint64_t>(first_bucket << 1UL);
+        Element scaled = running_sum;
+        for (size_t bit = numeric::get_msb(multiplier); bit > 0; --bit) {
+            scaled.self_dbl();
+            if (((multiplier >> (bit - 1)) & 1UL) == 1UL) {
+                scaled += running_sum;
+            }
+        }
+        accumulator += scaled;
+    }
+    return accumulator;
+}
+
+} // namespace
+
+template <typename Curve>
+size_t FixedBaseMsm<Curve>::get_max_num_shifts(const size_t num_points, const size_t memory_budget)
+{
+    if (num_points == 0) {
+        return 1;
+    }
+    return std::max(memory_budget / (2 * num_points * sizeof(AffineElement)), static_cast<size_t>(1));
+}
+
+template <typename Curve>
+FixedBaseMsm<Curve>::FixedBaseMsm(const AffineElement* point_table,
+                                  const size_t num_points,
+                                  const size_t memory_budget)
+    : num_points(num_points)
+    , num_threads(get_num_cpus_pow2())
+{
+    // Pick the window that minimises the cost of a full size MSM, given as many shifts as the budget allows.
+    const size_t max_num_shifts = get_max_num_shifts(num_points, memory_budget);
+    size_t best_cost = static_cast<size_t>(-1);
+    bucket_width = 1;
+    for (size_t width = 1; width <= MAX_BUCKET_WIDTH; ++width) {
+        const size_t num_width_shifts = std::min(static_cast<size_t>(WNAF_SIZE(width + 1)), max_num_shifts);
+        const size_t cost = estimate_msm_cost(num_points, width, num_width_shifts);
+        if (cost < best_cost) {
+            best_cost = cost;
+            bucket_width = width;
+        }
+    }
+    num_rounds = WNAF_SIZE(bucket_width + 1);
+    num_shifts = std::min(num_rounds, max_num_shifts);
+    chunk_capacity =
+        std::clamp((2 * num_points + num_threads - 1) / num_threads, static_cast<size_t>(1), MAX_CHUNK_CAPACITY);
+
+    const size_t num_buckets = 1UL << bucket_width;
+    table = slab_alloc<AffineElement>(num_shifts * 2 * num_points);
+    point_schedule = slab_alloc<uint64_t>(num_rounds * 2 * num_points + SCHEDULE_OVERFLOW);
+    skew_table = slab_alloc<bool>(2 * num_points);
+    point_pairs_1 = slab_alloc<AffineElement>(num_threads * (chunk_capacity + 16));
+    point_pairs_2 = slab_alloc<AffineElement>(num_threads * (chunk_capacity + 16));
+    scratch_space = slab_alloc<typename Curve::BaseField>(num_threads * chunk_capacity);
+    bucket_counts = slab_alloc<uint32_t>(num_threads * num_buckets);
+    bit_offsets = slab_alloc<uint32_t>(num_threads * 64);
+    bucket_empty_status = slab_alloc<bool>(num_threads * num_buckets);
+    std::fill_n(point_schedule.get() + num_rounds * 2 * num_points, SCHEDULE_OVERFLOW, 0);
+
+    // Table s holds the point table of the base points multiplied by 2^{s * wnaf_bits}. Only the base points are
+    // doubled; their endomorphism images are derived by `generate_pippenger_point_table`.
+    std::copy(point_table, point_table + 2 * num_points, table.get());
+    const size_t wnaf_bits = bucket_width + 1;
+    run_loop_in_parallel(num_points, [&](size_t start, size_t end) {
+        std::vector<Element> shifted(end - start);
+        for (size_t i = start; i < end; ++i) {
+            shifted[i - start] = Element(point_table[2 * i]);
+        }
+        for (size_t s = 1; s < num_shifts; ++s) {
+            for (auto& point : shifted) {
+                for (size_t k = 0; k < wnaf_bits; ++k) {
+                    point.self_dbl();
+                }
+            }
+            Element::batch_normalize(shifted.data(), shifted.size());
+            AffineElement* range_table = table.get() + s * 2 * num_points + 2 * start;
+            for (size_t i = 0; i < end - start; ++i) {
+                range_table[i] = AffineElement(shifted[i].x, shifted[i].y);
+            }
+            generate_pippenger_point_table<Curve>(range_table, range_table, end - start);
+        }
+    });
+}
+
+template <typename Curve> bool FixedBaseMsm<Curve>::is_effective(const size_t num_scalars) const
+{
+    // Below this size, pippenger falls back to plain scalar multiplications.
+    if (num_scalars > num_points || num_scalars <= num_threads * 8) {
+        return false;
+    }
+    return estimate_msm_cost(num_scalars, bucket_width, num_shifts) <
+           estimate_msm_cost(num_scalars, get_optimal_bucket_width(num_scalars), 1);
+}
+
+template <typename Curve>
+typename Curve::Element FixedBaseMsm<Curve>::multiply(const ScalarField* scalars, const size_t num_scalars)
+{
+    BB_OP_COUNT_TIME();
+    ASSERT(num_scalars <= num_points);
+    Element result;
+    result.self_set_infinity();
+    if (num_scalars == 0) {
+        return result;
+    }
+
+    // Compute the wnaf digits of the endomorphism-split scalars, laid out as in `compute_wnaf_states`: one row of
+    // 2 * num_scalars entries per round, the most significant round first.
+    const size_t row_size = 2 * num_scalars;
+    const size_t wnaf_bits = bucket_width + 1;
+    std::vector<std::vector<uint64_t>> thread_round_counts(num_threads, std::vector<uint64_t>(num_rounds, 0));
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = (thread_idx * num_scalars) / num_threads;
+        const size_t end = ((thread_idx + 1) * num_scalars) / num_threads;
+        std::array<uint64_t, 4 * WNAF_BLOCK_SIZE> split_scalars;
+        for (size_t block_start = start; block_start < end; block_start += WNAF_BLOCK_SIZE) {
+            const size_t block_size = std::min(WNAF_BLOCK_SIZE, end - block_start);
+            for (size_t j = 0; j < block_size; ++j) {
+                ScalarField k1;
+                ScalarField k2;
+                ScalarField::split_into_endomorphism_scalars(scalars[block_start + j].from_montgomery_form(), k1, k2);
+                std::copy(&k1.data[0], &k1.data[2], &split_scalars[4 * j]);
+                std::copy(&k2.data[0], &k2.data[2], &split_scalars[4 * j + 2]);
+            }
+            fixed_wnaf_with_counts_batch(&split_scalars[0],
+                                         2 * block_size,
+                                         point_schedule.get() + 2 * block_start,
+                                         skew_table.get() + 2 * block_start,
+                                         thread_round_counts[thread_idx].data(),
+                                         (2 * block_start) << 32UL,
+                                         row_size,
+                                         wnaf_bits);
+        }
+    });
+
+    // Pass q gathers the rounds whose digits weigh 2^{wnaf_bits * (q * num_shifts + s)}, s < num_shifts. Redirect each
+    // of their entries to the table of shift s, and sort the pass by bucket.
+    const size_t num_passes = (num_rounds + num_shifts - 1) / num_shifts;
+    const auto get_pass_rounds = [&](size_t pass) {
+        const size_t last_round = num_rounds - 1 - pass * num_shifts;
+        const size_t first_round = last_round + 1 - std::min(num_shifts, last_round + 1);
+        return std::make_pair(first_round, last_round);
+    };
+    parallel_for(num_passes, [&](size_t pass) {
+        const auto [first_round, last_round] = get_pass_rounds(pass);
+        for (size_t round = first_round; round <= last_round; ++round) {
+            const uint64_t table_offset = static_cast<uint64_t>((last_round - round) * 2 * num_points) << 32UL;
+            uint64_t* row = point_schedule.get() + round * row_size;
+            for (size_t i = 0; i < row_size; ++i) {
+                if (row[i] != 0xffffffffffffffffULL) {
+                    row[i] += table_offset;
+                }
+            }
+        }
+        process_buckets(point_schedule.get() + first_round * row_size,
+                        (last_round - first_round + 1) * row_size,
+                        static_cast<uint32_t>(wnaf_bits));
+    });
+
+    const size_t num_buckets = 1UL << bucket_width;
+    for (size_t pass = num_passes - 1; pass < num_passes; --pass) {
+        const auto [first_round, last_round] = get_pass_rounds(pass);
+        // Empty entries are sorted to the end of the pass.
+        size_t num_entries = 0;
+        for (size_t round = first_round; round <= last_round; ++round) {
+            for (size_t i = 0; i < num_threads; ++i) {
+                num_entries += thread_round_counts[i][round];
+            }
+        }
+        uint64_t* pass_schedule = point_schedule.get() + first_round * row_size;
+
+        // Split the pass into chunks of consecutive entries (i.e. ranges of buckets) that are reduced independently.
+        const size_t num_chunks = (num_entries + chunk_capacity - 1) / chunk_capacity;
+        std::vector<Element> thread_accumulators(num_threads);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            thread_accumulators[thread_idx].self_set_infinity();
+            for (size_t chunk = thread_idx; chunk < num_chunks; chunk += num_threads) {
+                const size_t start = (chunk * num_entries) / num_chunks;
+                const size_t end = ((chunk + 1) * num_entries) / num_chunks;
+                const size_t first_bucket = pass_schedule[start] & 0x7fffffffU;
+                const size_t last_bucket = pass_schedule[end - 1] & 0x7fffffffU;
+
+                affine_product_runtime_state<Curve> state;
+                state.points = table.get();
+                state.point_pairs_1 = point_pairs_1.get() + thread_idx * (chunk_capacity + 16);
+                state.point_pairs_2 = point_pairs_2.get() + thread_idx * (chunk_capacity + 16);
+                state.scratch_space = scratch_space.get() + thread_idx * chunk_capacity;
+                state.bucket_counts = bucket_counts.get() + thread_idx * num_buckets;
+                state.bit_offsets = bit_offsets.get() + thread_idx * 64;
+                state.bucket_empty_status = bucket_empty_status.get() + thread_idx * num_buckets;
+                state.point_schedule = pass_schedule + start;
+                state.num_points = static_cast<uint32_t>(end - start);
+                state.num_buckets = static_cast<uint32_t>(last_bucket - first_bucket + 1);
+
+                const AffineElement* output_buckets = reduce_buckets<Curve>(state, true, false);
+                thread_accumulators[thread_idx] +=
+                    accumulate_buckets<Curve>(state, output_buckets, first_bucket, last_bucket - first_bucket + 1);
+            }
+        });
+
+        if (pass != num_passes - 1) {
+            for (size_t i = 0; i < wnaf_bits * num_shifts; ++i) {
+                result.self_dbl();
+            }
+        }
+        for (const auto& accumulator : thread_accumulators) {
+            result += accumulator;
+        }
+    }
+
+    // wnaf digits are odd; even scalars were incremented, so subtract the base point once more.
+    std::vector<Element> skew_accumulators(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        skew_accumulators[thread_idx].self_set_infinity();
+        const size_t start = (thread_idx * row_size) / num_threads;
+        const size_t end = ((thread_idx + 1) * row_size) / num_threads;
+        for (size_t i = start; i < end; ++i) {
+            if (skew_table.get()[i]) {
+                skew_accumulators[thread_idx] -= table.get()[i];
+            }
+        }
+    });
+    for (const auto& accumulator : skew_accumulators) {
+        result += accumulator;
+    }
+    return result;
+}
+
+template class FixedBaseMsm<curve::BN254>;
+template class FixedBaseMsm<curve::Grumpkin>;
+
+} // namespace bb::scalar_multiplication
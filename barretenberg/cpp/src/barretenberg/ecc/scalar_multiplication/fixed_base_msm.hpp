@@ -0,0 +1,89 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Multi-scalar multiplication against a fixed set of base points, using precomputed shifts of the bases.
+ *
+ * @details Pippenger splits each (endomorphism-split, 127-bit) scalar into R windows of w bits and, for each window,
+ * sorts the points into buckets, accumulates the buckets and doubles the running result w times. The bucket
+ * accumulation costs ~2^{w} additions per window, regardless of the number of points.
+ *
+ * When the base points never change (e.g. the SRS of a commitment key), we can precompute, for every base point P,
+ * the shifts 2^{w}P, 2^{2w}P, ..., 2^{(K-1)w}P. A scalar digit in window r then becomes a digit in window r mod K of a
+ * shifted base point, so K consecutive windows can share a single set of buckets: the number of bucket accumulations
+ * (and doubling runs) drops from R to ceil(R / K), and larger windows become profitable. With K = R, an MSM is a single
+ * bucket pass with no doublings at all.
+ *
+ * The table holds K copies of the pippenger point table, so K is bounded by a memory budget. The window size is
+ * chosen to minimise the estimated cost of a full size MSM for the given budget.
+ *
+ * Like `pippenger_unsafe`, this uses incomplete affine addition formulae: the base points must be linearly
+ * independent (as in an SRS). Not thread-safe: each instance owns the scratch space of one MSM at a time.
+ */
+template <typename Curve> class FixedBaseMsm {
+  public:
+    using ScalarField = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    /**
+     * @param point_table A pippenger point table (see `generate_pippenger_point_table`) of 2 * num_points points.
+     * @param num_points The number of base points.
+     * @param memory_budget The maximum size in bytes of the precomputed table.
+     */
+    FixedBaseMsm(const AffineElement* point_table, size_t num_points, size_t memory_budget);
+    FixedBaseMsm(const FixedBaseMsm& other) = delete;
+    FixedBaseMsm(FixedBaseMsm&& other) = delete;
+    FixedBaseMsm& operator=(const FixedBaseMsm& other) = delete;
+    FixedBaseMsm& operator=(FixedBaseMsm&& other) = delete;
+    ~FixedBaseMsm() = default;
+
+    /**
+     * @brief Computes ∑ᵢ scalars[i]⋅Pᵢ over the first `num_scalars` base points.
+     */
+    Element multiply(const ScalarField* scalars, size_t num_scalars);
+
+    /**
+     * @brief Returns true if `multiply` is expected to beat `pippenger_unsafe` for an MSM of `num_scalars` points.
+     */
+    [[nodiscard]] bool is_effective(size_t num_scalars) const;
+
+    /**
+     * @brief The number of precomputed shifts per point that a given memory budget allows for `num_points` points.
+     */
+    static size_t get_max_num_shifts(size_t num_points, size_t memory_budget);
+
+    [[nodiscard]] size_t get_num_points() const { return num_points; }
+    [[nodiscard]] size_t get_bucket_width() const { return bucket_width; }
+    [[nodiscard]] size_t get_num_shifts() const { return num_shifts; }
+    [[nodiscard]] size_t get_table_size_in_bytes() const { return num_shifts * 2 * num_points * sizeof(AffineElement); }
+
+  private:
+    size_t num_points;
+    size_t bucket_width;
+    size_t num_rounds;
+    size_t num_shifts;
+    size_t num_threads;
+    size_t chunk_capacity;
+
+    // num_shifts pippenger point tables; table s holds the base points multiplied by 2^{s * (bucket_width + 1)}
+    std::shared_ptr<AffineElement[]> table;
+    // Scratch space for one MSM: the wnaf point schedule (num_rounds x 2 * num_points) and skews
+    std::shared_ptr<uint64_t[]> point_schedule;
+    std::shared_ptr<bool[]> skew_table;
+    // Per-thread scratch space for the affine bucket accumulation of one chunk of the point schedule
+    std::shared_ptr<AffineElement[]> point_pairs_1;
+    std::shared_ptr<AffineElement[]> point_pairs_2;
+    std::shared_ptr<typename Curve::BaseField[]> scratch_space;
+    std::shared_ptr<uint32_t[]> bucket_counts;
+    std::shared_ptr<uint32_t[]> bit_offsets;
+    std::shared_ptr<bool[]> bucket_empty_status;
+};
+
+} // namespace bb::scalar_multiplication
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -7,6 +8,7 @@
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
+#include "./wnaf_batch.hpp"
 
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/op_count.hpp"
@@ -220,28 +222,26 @@ void compute_wnaf_states(uint64_t* point_schedule,
     }
 
     parallel_for(num_threads, [&](size_t i) {
-        Fr T0;
+        // The endomorphism scalars of a block of scalars, each as two 128-bit halves: k1 then k2
+        std::array<uint64_t, 4 * WNAF_BLOCK_SIZE> split_scalars;
         uint64_t* wnaf_table = &point_schedule[(2 * i) * num_initial_points_per_thread];
         const Fr* thread_scalars = &scalars[i * num_initial_points_per_thread];
         bool* skew_table = &input_skew_table[(2 * i) * num_initial_points_per_thread];
         uint64_t offset = i * num_points_per_thread;
 
-        for (uint64_t j = 0; j < num_initial_points_per_thread; ++j) {
-            T0 = thread_scalars[j].from_montgomery_form();
-            Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
-
-            wnaf::fixed_wnaf_with_counts(&T0.data[0],
-                                         &wnaf_table[(j << 1UL)],
-                                         skew_table[j << 1ULL],
-                                         &thread_round_counts[i][0],
-                                         ((j << 1ULL) + offset) << 32ULL,
-                                         num_points,
-                                         wnaf_bits);
-            wnaf::fixed_wnaf_with_counts(&T0.data[2],
-                                         &wnaf_table[(j << 1UL) + 1],
-                                         skew_table[(j << 1UL) + 1],
+        for (uint64_t block_start = 0; block_start < num_initial_points_per_thread; block_start += WNAF_BLOCK_SIZE) {
+            const size_t block_size = std::min(WNAF_BLOCK_SIZE, num_initial_points_per_thread - block_start);
+            for (size_t j = 0; j < block_size; ++j) {
+                Fr T0 = thread_scalars[block_start + j].from_montgomery_form();
+                Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
+                std::copy(&T0.data[0], &T0.data[4], &split_scalars[4 * j]);
+            }
+            fixed_wnaf_with_counts_batch(&split_scalars[0],
+                                         2 * block_size,
+                                         &wnaf_table[block_start << 1UL],
+                                         &skew_table[block_start << 1UL],
                                          &thread_round_counts[i][0],
-                                         ((j << 1UL) + offset + 1) << 32UL,
+                                         ((block_start << 1UL) + offset) << 32UL,
                                          num_points,
                                          wnaf_bits);
         }
@@ -310,109 +310,115 @@ void organize_buckets(uint64_t* point_schedule, const size_t num_points)
 template <typename Curve>
 void add_affine_points(typename Curve::AffineElement* points,
                        const size_t num_points,
-                       typename Curve::BaseField* scratch_space)
+                       typename Curve::BaseField* scratch_space,
+                       const field_kernels::FieldKernel kernel)
 {
     using Fq = typename Curve::BaseField;
-    Fq batch_inversion_accumulator = Fq::one();
-
-    for (size_t i = 0; i < num_points; i += 2) {
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
-    }
+    field_kernels::with_field_ops<Fq>(kernel, [&](auto ops) {
+        Fq batch_inversion_accumulator = Fq::one();
+
+        for (size_t i = 0; i < num_points; i += 2) {
+            scratch_space[i >> 1] = ops.add(points[i].x, points[i + 1].x);           // x2 + x1
+            points[i + 1].x = ops.sub(points[i + 1].x, points[i].x);                 // x2 - x1
+            points[i + 1].y = ops.sub(points[i + 1].y, points[i].y);                 // y2 - y1
+            points[i + 1].y = ops.mul(points[i + 1].y, batch_inversion_accumulator); // (y2 - y1)*accumulator_old
+            batch_inversion_accumulator = ops.mul(batch_inversion_accumulator, points[i + 1].x);
+        }
 
-    if (batch_inversion_accumulator == 0) {
-        throw_or_abort("attempted to invert zero in add_affine_points");
-    } else {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
-    }
+        if (batch_inversion_accumulator == 0) {
+            throw_or_abort("attempted to invert zero in add_affine_points");
+        } else {
+            batch_inversion_accumulator = batch_inversion_accumulator.invert();
+        }
 
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this
-        // prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
-    }
+        for (size_t i = (num_points)-2; i < num_points; i -= 2) {
+            // Memory bandwidth is a bit of a bottleneck here.
+            // There's probably a more elegant way of structuring our data so we don't need to do all of this
+            // prefetching
+            __builtin_prefetch(points + i - 2);
+            __builtin_prefetch(points + i - 1);
+            __builtin_prefetch(points + ((i + num_points - 2) >> 1));
+            __builtin_prefetch(scratch_space + ((i - 2) >> 1));
+
+            points[i + 1].y = ops.mul(points[i + 1].y, batch_inversion_accumulator); // update accumulator
+            batch_inversion_accumulator = ops.mul(batch_inversion_accumulator, points[i + 1].x);
+            points[i + 1].x = ops.sqr(points[i + 1].y);
+            points[(i + num_points) >> 1].x = ops.sub(points[i + 1].x, scratch_space[i >> 1]); // x3 = lambda_squared
+                                                                                               // - x2 - x1
+            points[i].x = ops.sub(points[i].x, points[(i + num_points) >> 1].x);
+            points[i].x = ops.mul(points[i].x, points[i + 1].y);
+            points[(i + num_points) >> 1].y = ops.sub(points[i].x, points[i].y);
+        }
+    });
 }
 
 template <typename Curve>
 void add_affine_points_with_edge_cases(typename Curve::AffineElement* points,
                                        const size_t num_points,
-                                       typename Curve::BaseField* scratch_space)
+                                       typename Curve::BaseField* scratch_space,
+                                       const field_kernels::FieldKernel kernel)
 {
     using Fq = typename Curve::BaseField;
-    Fq batch_inversion_accumulator = Fq::one();
+    field_kernels::with_field_ops<Fq>(kernel, [&](auto ops) {
+        Fq batch_inversion_accumulator = Fq::one();
 
-    for (size_t i = 0; i < num_points; i += 2) {
-        if (points[i].is_point_at_infinity() || points[i + 1].is_point_at_infinity()) {
-            continue;
-        }
-        if (points[i].x == points[i + 1].x) {
-            if (points[i].y == points[i + 1].y) {
-                // double
-                scratch_space[i >> 1] = points[i].x + points[i].x; // 2x
-                Fq x_squared = points[i].x.sqr();
-                points[i + 1].x = points[i].y + points[i].y;         // 2y
-                points[i + 1].y = x_squared + x_squared + x_squared; // 3x^2
-                points[i + 1].y *= batch_inversion_accumulator;
-                batch_inversion_accumulator *= (points[i + 1].x);
+        for (size_t i = 0; i < num_points; i += 2) {
+            if (points[i].is_point_at_infinity() || points[i + 1].is_point_at_infinity()) {
+                continue;
+            }
+            if (points[i].x == points[i + 1].x) {
+                if (points[i].y == points[i + 1].y) {
+                    // double
+                    scratch_space[i >> 1] = ops.add(points[i].x, points[i].x); // 2x
+                    Fq x_squared = ops.sqr(points[i].x);
+                    points[i + 1].x = ops.add(points[i].y, points[i].y);                 // 2y
+                    points[i + 1].y = ops.add(ops.add(x_squared, x_squared), x_squared); // 3x^2
+                    points[i + 1].y = ops.mul(points[i + 1].y, batch_inversion_accumulator);
+                    batch_inversion_accumulator = ops.mul(batch_inversion_accumulator, points[i + 1].x);
+                    continue;
+                }
+                points[i].self_set_infinity();
+                points[i + 1].self_set_infinity();
                 continue;
             }
-            points[i].self_set_infinity();
-            points[i + 1].self_set_infinity();
-            continue;
-        }
 
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
-    }
-    if (!batch_inversion_accumulator.is_zero()) {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
-    }
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this
-        // prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        if (points[i].is_point_at_infinity()) {
-            points[(i + num_points) >> 1] = points[i + 1];
-            continue;
+            scratch_space[i >> 1] = ops.add(points[i].x, points[i + 1].x);           // x2 + x1
+            points[i + 1].x = ops.sub(points[i + 1].x, points[i].x);                 // x2 - x1
+            points[i + 1].y = ops.sub(points[i + 1].y, points[i].y);                 // y2 - y1
+            points[i + 1].y = ops.mul(points[i + 1].y, batch_inversion_accumulator); // (y2 - y1)*accumulator_old
+            batch_inversion_accumulator = ops.mul(batch_inversion_accumulator, points[i + 1].x);
         }
-        if (points[i + 1].is_point_at_infinity()) {
-            points[(i + num_points) >> 1] = points[i];
-            continue;
+        if (!batch_inversion_accumulator.is_zero()) {
+            batch_inversion_accumulator = batch_inversion_accumulator.invert();
         }
+        for (size_t i = (num_points)-2; i < num_points; i -= 2) {
+            // Memory bandwidth is a bit of a bottleneck here.
+            // There's probably a more elegant way of structuring our data so we don't need to do all of this
+            // prefetching
+            __builtin_prefetch(points + i - 2);
+            __builtin_prefetch(points + i - 1);
+            __builtin_prefetch(points + ((i + num_points - 2) >> 1));
+            __builtin_prefetch(scratch_space + ((i - 2) >> 1));
+
+            if (points[i].is_point_at_infinity()) {
+                points[(i + num_points) >> 1] = points[i + 1];
+                continue;
+            }
+            if (points[i + 1].is_point_at_infinity()) {
+                points[(i + num_points) >> 1] = points[i];
+                continue;
+            }
 
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
-    }
+            points[i + 1].y = ops.mul(points[i + 1].y, batch_inversion_accumulator); // update accumulator
+            batch_inversion_accumulator = ops.mul(batch_inversion_accumulator, points[i + 1].x);
+            points[i + 1].x = ops.sqr(points[i + 1].y);
+            points[(i + num_points) >> 1].x = ops.sub(points[i + 1].x, scratch_space[i >> 1]); // x3 = lambda_squared
+                                                                                               // - x2 - x1
+            points[i].x = ops.sub(points[i].x, points[(i + num_points) >> 1].x);
+            points[i].x = ops.mul(points[i].x, points[i + 1].y);
+            points[(i + num_points) >> 1].y = ops.sub(points[i].x, points[i].y);
+        }
+    });
 }
 
 /**
@@ -963,16 +969,24 @@ template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineE
                                                            curve::BN254::AffineElement* table,
                                                            size_t num_points);
 
+template void compute_wnaf_states<curve::BN254>(uint64_t* point_schedule,
+                                                bool* input_skew_table,
+                                                uint64_t* round_counts,
+                                                const curve::BN254::ScalarField* scalars,
+                                                const size_t num_initial_points);
+
 template uint32_t construct_addition_chains<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                           bool empty_bucket_counts = true);
 
 template void add_affine_points<curve::BN254>(curve::BN254::AffineElement* points,
                                               const size_t num_points,
-                                              curve::BN254::BaseField* scratch_space);
+                                              curve::BN254::BaseField* scratch_space,
+                                              const field_kernels::FieldKernel kernel);
 
 template void add_affine_points_with_edge_cases<curve::BN254>(curve::BN254::AffineElement* points,
                                                               const size_t num_points,
-                                                              curve::BN254::BaseField* scratch_space);
+                                                              curve::BN254::BaseField* scratch_space,
+                                                              const field_kernels::FieldKernel kernel);
 
 template void evaluate_addition_chains<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                      const size_t max_bucket_bits,
@@ -1014,16 +1028,24 @@ template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::A
                                                               curve::Grumpkin::AffineElement* table,
                                                               size_t num_points);
 
+template void compute_wnaf_states<curve::Grumpkin>(uint64_t* point_schedule,
+                                                   bool* input_skew_table,
+                                                   uint64_t* round_counts,
+                                                   const curve::Grumpkin::ScalarField* scalars,
+                                                   const size_t num_initial_points);
+
 template uint32_t construct_addition_chains<curve::Grumpkin>(affine_product_runtime_state<curve::Grumpkin>& state,
                                                              bool empty_bucket_counts = true);
 
 template void add_affine_points<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                  const size_t num_points,
-                                                 curve::Grumpkin::BaseField* scratch_space);
+                                                 curve::Grumpkin::BaseField* scratch_space,
+                                                 const field_kernels::FieldKernel kernel);
 
 template void add_affine_points_with_edge_cases<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                                  const size_t num_points,
-                                                                 curve::Grumpkin::BaseField* scratch_space);
+                                                                 curve::Grumpkin::BaseField* scratch_space,
+                                                                 const field_kernels::FieldKernel kernel);
 
 template void evaluate_addition_chains<curve::Grumpkin>(affine_product_runtime_state<curve::Grumpkin>& state,
                                                         const size_t max_bucket_bits,
@@ -122,12 +122,14 @@ uint32_t construct_addition_chains(affine_product_runtime_state<Curve>& state, b
 template <typename Curve>
 void add_affine_points(typename Curve::AffineElement* points,
                        size_t num_points,
-                       typename Curve::BaseField* scratch_space);
+                       typename Curve::BaseField* scratch_space,
+                       field_kernels::FieldKernel kernel = field_kernels::get_field_kernel());
 
 template <typename Curve>
 void add_affine_points_with_edge_cases(typename Curve::AffineElement* points,
                                        size_t num_points,
-                                       typename Curve::BaseField* scratch_space);
+                                       typename Curve::BaseField* scratch_space,
+                                       field_kernels::FieldKernel kernel = field_kernels::get_field_kernel());
 
 template <typename Curve>
 void evaluate_addition_chains(affine_product_runtime_state<Curve>& state,
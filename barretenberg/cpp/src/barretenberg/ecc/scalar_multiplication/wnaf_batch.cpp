@@ -0,0 +1,238 @@
+#include "./wnaf_batch.hpp"
+
+#include "barretenberg/ecc/groups/wnaf.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define WNAF_BATCH_X86_64
+#endif
+
+namespace bb::scalar_multiplication {
+
+namespace {
+
+// The parameters of a block of scalars, laid out for vector loads.
+struct alignas(64) WnafBlock {
+    std::array<uint64_t, WNAF_BLOCK_SIZE> lo;
+    std::array<uint64_t, WNAF_BLOCK_SIZE> hi;
+    // The number of wnaf entries of each scalar (0 for a zero scalar)
+    std::array<uint64_t, WNAF_BLOCK_SIZE> num_entries;
+    // The lowest window of each scalar, plus its skew
+    std::array<uint64_t, WNAF_BLOCK_SIZE> previous;
+};
+
+#ifdef WNAF_BATCH_X86_64
+using u64x4 = uint64_t __attribute__((vector_size(32)));
+using u64x8 = uint64_t __attribute__((vector_size(64)));
+
+/**
+ * @brief Computes the wnaf entries of the first `num_scalars` (a multiple of the vector width) scalars of a block.
+ *
+ * @details Follows `wnaf::fixed_wnaf_with_counts` for all lanes at once. The entry of round r (in row
+ * max_entries - r) is the digit of window r - 1 for r < num_entries, the top window for r = num_entries and empty
+ * beyond. As bits past the top of a scalar are zero, its last window can be read like any other.
+ */
+template <typename Vec>
+inline __attribute__((always_inline)) void wnaf_vector_kernel(const WnafBlock& block,
+                                                              const size_t num_scalars,
+                                                              uint64_t* wnaf,
+                                                              const uint64_t point_index,
+                                                              const uint64_t num_points,
+                                                              const size_t wnaf_bits,
+                                                              const size_t max_entries)
+{
+    constexpr size_t LANES = sizeof(Vec) / sizeof(uint64_t);
+    const uint64_t bit_mask = (1UL << wnaf_bits) - 1UL;
+    for (size_t col = 0; col < num_scalars; col += LANES) {
+        Vec lo;
+        Vec hi;
+        Vec num_entries;
+        Vec previous;
+        Vec point_indices;
+        std::memcpy(&lo, &block.lo[col], sizeof(Vec));
+        std::memcpy(&hi, &block.hi[col], sizeof(Vec));
+        std::memcpy(&num_entries, &block.num_entries[col], sizeof(Vec));
+        std::memcpy(&previous, &block.previous[col], sizeof(Vec));
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            point_indices[lane] = point_index + ((col + lane) << 32UL);
+        }
+
+        for (size_t round = 1; round <= max_entries; ++round) {
+            const size_t position = round * wnaf_bits;
+            Vec slice = lo ^ lo;
+            if (position < 64) {
+                slice = (lo >> position) | (hi << (64 - position));
+            } else if (position < 128) {
+                slice = hi >> (position - 64);
+            }
+            slice &= bit_mask;
+            const Vec predicate = (slice & 1UL) ^ 1UL;
+            const Vec entry =
+                ((((previous - (predicate << wnaf_bits)) ^ (0UL - predicate)) >> 1UL) | (predicate << 31UL)) |
+                point_indices;
+            const Vec top = (previous >> 1UL) | point_indices;
+            const auto is_entry = reinterpret_cast<Vec>(num_entries > round);
+            const auto is_top = reinterpret_cast<Vec>(num_entries == round);
+            const Vec value = (entry & is_entry) | (top & is_top) | ~(is_entry | is_top);
+            std::memcpy(&wnaf[(max_entries - round) * num_points + col], &value, sizeof(Vec));
+            previous = slice + predicate;
+        }
+    }
+}
+
+__attribute__((target("avx2"))) void wnaf_kernel_avx2(const WnafBlock& block,
+                                                      const size_t num_scalars,
+                                                      uint64_t* wnaf,
+                                                      const uint64_t point_index,
+                                                      const uint64_t num_points,
+                                                      const size_t wnaf_bits,
+                                                      const size_t max_entries)
+{
+    wnaf_vector_kernel<u64x4>(block, num_scalars, wnaf, point_index, num_points, wnaf_bits, max_entries);
+}
+
+__attribute__((target("avx512f"))) void wnaf_kernel_avx512(const WnafBlock& block,
+                                                           const size_t num_scalars,
+                                                           uint64_t* wnaf,
+                                                           const uint64_t point_index,
+                                                           const uint64_t num_points,
+                                                           const size_t wnaf_bits,
+                                                           const size_t max_entries)
+{
+    wnaf_vector_kernel<u64x8>(block, num_scalars, wnaf, point_index, num_points, wnaf_bits, max_entries);
+}
+#endif
+
+} // namespace
+
+bool is_wnaf_kernel_supported(const WnafKernel kernel)
+{
+#ifdef WNAF_BATCH_X86_64
+    __builtin_cpu_init();
+    switch (kernel) {
+    case WnafKernel::AVX512:
+        return __builtin_cpu_supports("avx512f") != 0;
+    case WnafKernel::AVX2:
+        return __builtin_cpu_supports("avx2") != 0;
+    default:
+        return true;
+    }
+#else
+    return kernel == WnafKernel::SCALAR;
+#endif
+}
+
+WnafKernel get_wnaf_kernel()
+{
+    static const WnafKernel kernel = []() {
+        for (const auto candidate : { WnafKernel::AVX512, WnafKernel::AVX2 }) {
+            if (is_wnaf_kernel_supported(candidate)) {
+                return candidate;
+            }
+        }
+        return WnafKernel::SCALAR;
+    }();
+    return kernel;
+}
+
+void fixed_wnaf_with_counts_batch(const uint64_t* scalars,
+                                  const size_t num_scalars,
+                                  uint64_t* wnaf,
+                                  bool* skew_map,
+                                  uint64_t* wnaf_round_counts,
+                                  const uint64_t point_index,
+                                  const uint64_t num_points,
+                                  const size_t wnaf_bits,
+                                  const WnafKernel kernel)
+{
+    size_t lanes = 1;
+#ifdef WNAF_BATCH_X86_64
+    if (kernel == WnafKernel::AVX512) {
+        lanes = 8;
+    } else if (kernel == WnafKernel::AVX2) {
+        lanes = 4;
+    }
+#endif
+    if (lanes == 1 || !is_wnaf_kernel_supported(kernel)) {
+        for (size_t i = 0; i < num_scalars; ++i) {
+            wnaf::fixed_wnaf_with_counts(&scalars[2 * i],
+                                         &wnaf[i],
+                                         skew_map[i],
+                                         wnaf_round_counts,
+                                         point_index + (i << 32UL),
+                                         num_points,
+                                         wnaf_bits);
+        }
+        return;
+    }
+
+    const size_t max_entries = WNAF_SIZE(wnaf_bits);
+    const uint64_t bit_mask = (1UL << wnaf_bits) - 1UL;
+    WnafBlock block;
+    for (size_t block_start = 0; block_start < num_scalars; block_start += WNAF_BLOCK_SIZE) {
+        const size_t block_size = std::min(WNAF_BLOCK_SIZE, num_scalars - block_start);
+        const size_t num_vector_scalars = block_size - (block_size % lanes);
+
+        // The number of scalars of the block with each number of wnaf entries
+        std::array<uint64_t, 129> entry_counts{};
+        for (size_t i = 0; i < num_vector_scalars; ++i) {
+            const uint64_t* scalar = &scalars[2 * (block_start + i)];
+            bool& skew = skew_map[block_start + i];
+            block.lo[i] = scalar[0];
+            block.hi[i] = scalar[1];
+            if ((scalar[0] | scalar[1]) == 0) {
+                skew = false;
+                block.num_entries[i] = 0;
+                block.previous[i] = 0;
+            } else {
+                const uint64_t num_bits = wnaf::get_num_scalar_bits(scalar) + 1;
+                skew = (scalar[0] & 1) == 0;
+                block.num_entries[i] = (num_bits + wnaf_bits - 1) / wnaf_bits;
+                block.previous[i] = (scalar[0] & bit_mask) + static_cast<uint64_t>(skew);
+            }
+            ++entry_counts[block.num_entries[i]];
+        }
+
+#ifdef WNAF_BATCH_X86_64
+        if (kernel == WnafKernel::AVX512) {
+            wnaf_kernel_avx512(block,
+                               num_vector_scalars,
+                               &wnaf[block_start],
+                               point_index + (block_start << 32UL),
+                               num_points,
+                               wnaf_bits,
+                               max_entries);
+        } else {
+            wnaf_kernel_avx2(block,
+                             num_vector_scalars,
+                             &wnaf[block_start],
+                             point_index + (block_start << 32UL),
+                             num_points,
+                             wnaf_bits,
+                             max_entries);
+        }
+#endif
+
+        // Round r has an entry for every scalar with at least r entries
+        uint64_t num_longer_scalars = 0;
+        for (size_t round = max_entries; round > 0; --round) {
+            num_longer_scalars += entry_counts[round];
+            wnaf_round_counts[max_entries - round] += num_longer_scalars;
+        }
+
+        for (size_t i = block_start + num_vector_scalars; i < block_start + block_size; ++i) {
+            wnaf::fixed_wnaf_with_counts(&scalars[2 * i],
+                                         &wnaf[i],
+                                         skew_map[i],
+                                         wnaf_round_counts,
+                                         point_index + (i << 32UL),
+                                         num_points,
+                                         wnaf_bits);
+        }
+    }
+}
+
+} // namespace bb::scalar_multiplication
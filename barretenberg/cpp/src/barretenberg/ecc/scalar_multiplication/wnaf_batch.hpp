@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Implementations of `fixed_wnaf_with_counts_batch`. The vector kernels are only available on x86-64 CPUs that
+ * support the corresponding instruction set.
+ */
+enum class WnafKernel { SCALAR, AVX2, AVX512 };
+
+/**
+ * @brief The number of scalars that callers of `fixed_wnaf_with_counts_batch` should split and pass at once; the
+ * kernels prepare their parameters in blocks of this size.
+ */
+constexpr size_t WNAF_BLOCK_SIZE = 64;
+
+/**
+ * @brief The fastest wnaf kernel supported by this CPU (detected once, using cpuid).
+ */
+WnafKernel get_wnaf_kernel();
+
+/**
+ * @brief Whether a wnaf kernel can run on this CPU.
+ */
+bool is_wnaf_kernel_supported(WnafKernel kernel);
+
+/**
+ * @brief Computes the wnaf schedule entries of `num_scalars` 128-bit scalars, exactly as `wnaf::fixed_wnaf_with_counts`
+ * would for each of them.
+ *
+ * @details Scalar i, given by the limbs scalars[2i] and scalars[2i + 1], is written to column i of `wnaf` (the rounds
+ * of a column are `num_points` entries apart) and `skew_map[i]`, with point index `point_index + (i << 32)`.
+ *
+ * The vector kernels compute the digits of 4 (AVX2) or 8 (AVX-512) scalars at once: every lane runs through all rounds,
+ * and writes a digit, its top digit or an empty entry depending on the length of its scalar.
+ */
+void fixed_wnaf_with_counts_batch(const uint64_t* scalars,
+                                  size_t num_scalars,
+                                  uint64_t* wnaf,
+                                  bool* skew_map,
+                                  uint64_t* wnaf_round_counts,
+                                  uint64_t point_index,
+                                  uint64_t num_points,
+                                  size_t wnaf_bits,
+                                  WnafKernel kernel = get_wnaf_kernel());
+
+} // namespace bb::scalar_multiplication
@@ -9,7 +9,7 @@ template <class Flavor>
 void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
 {
     // Construct wire polynomials, selector polynomials, and copy cycles from raw circuit data
-    auto trace_data = construct_trace_data(builder, proving_key.circuit_size, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key, is_structured);
 
     add_wires_and_selectors_to_proving_key(trace_data, builder, proving_key);
 
@@ -31,15 +31,9 @@ void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(TraceData&
                                                                      typename Flavor::ProvingKey& proving_key)
 {
     if constexpr (IsHonkFlavor<Flavor>) {
-        for (auto [pkey_wire, trace_wire] : zip_view(proving_key.polynomials.get_wires(), trace_data.wires)) {
-            pkey_wire = trace_wire.share();
-        }
-        proving_key.polynomials.set_shifted(); // Ensure shifted wires are set correctly
-        for (auto [pkey_selector, trace_selector] :
-             zip_view(proving_key.polynomials.get_selectors(), trace_data.selectors)) {
-            pkey_selector = trace_selector.share();
-        }
+        // The trace data was written directly into the wires and selectors of the proving key
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
+        proving_key.active_row_ranges = trace_data.active_row_ranges;
     } else if constexpr (IsPlonkFlavor<Flavor>) {
         for (size_t idx = 0; idx < trace_data.wires.size(); ++idx) {
             std::string wire_tag = "w_" + std::to_string(idx + 1) + "_lagrange";
@@ -71,10 +65,10 @@ void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(TraceData& trace
 
 template <class Flavor>
 typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_trace_data(Builder& builder,
-                                                                                          size_t dyadic_circuit_size,
+                                                                                          ProvingKey& proving_key,
                                                                                           bool is_structured)
 {
-    TraceData trace_data{ dyadic_circuit_size, builder };
+    TraceData trace_data{ builder, proving_key };
 
     // Complete the public inputs execution trace block from builder.public_inputs
     populate_public_inputs_block(builder);
@@ -115,6 +109,9 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
         if (block.is_pub_inputs) {
             trace_data.pub_inputs_offset = offset;
         }
+        if (block_size > 0) {
+            trace_data.active_row_ranges.emplace_back(offset, offset + block_size);
+        }
 
         // If the trace is structured, we populate the data from the next block at a fixed block size offset
         if (is_structured) {
@@ -126,6 +123,22 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
     return trace_data;
 }
 
+template <class Flavor> size_t ExecutionTrace_<Flavor>::compute_trace_size(Builder& builder, bool is_structured)
+{
+    // Mirrors the placement of the blocks in construct_trace_data
+    size_t offset = Flavor::has_zero_row ? 1 : 0;
+    size_t trace_size = offset;
+    for (auto& block : builder.blocks.get()) {
+        // The public inputs block is only populated along with the trace
+        const size_t block_size = block.is_pub_inputs ? builder.public_inputs.size() : block.size();
+        if (block_size > 0) {
+            trace_size = offset + block_size;
+        }
+        offset += is_structured ? block.get_fixed_size() : block_size;
+    }
+    return trace_size;
+}
+
 template <class Flavor> void ExecutionTrace_<Flavor>::populate_public_inputs_block(Builder& builder)
 {
     // Update the public inputs block
@@ -23,15 +23,28 @@ template <class Flavor> class ExecutionTrace_ {
         std::vector<CyclicPermutation> copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
+        // The rows [start, end) of each nonempty block; in a structured trace the rows in between are padding
+        std::vector<std::pair<size_t, size_t>> active_row_ranges;
 
-        TraceData(size_t dyadic_circuit_size, Builder& builder)
+        TraceData(Builder& builder, ProvingKey& proving_key)
         {
-            // Initializate the wire and selector polynomials
-            for (auto& wire : wires) {
-                wire = Polynomial(dyadic_circuit_size);
-            }
-            for (auto& selector : selectors) {
-                selector = Polynomial(dyadic_circuit_size);
+            if constexpr (IsHonkFlavor<Flavor>) {
+                // Write directly into the wire and selector polynomials of the proving key, whose windows cover the
+                // trace (see compute_trace_size)
+                for (auto [wire, key_wire] : zip_view(wires, proving_key.polynomials.get_wires())) {
+                    wire = key_wire.share();
+                }
+                for (auto [selector, key_selector] : zip_view(selectors, proving_key.polynomials.get_selectors())) {
+                    selector = key_selector.share();
+                }
+            } else {
+                // Initializate the wire and selector polynomials
+                for (auto& wire : wires) {
+                    wire = Polynomial(proving_key.circuit_size);
+                }
+                for (auto& selector : selectors) {
+                    selector = Polynomial(proving_key.circuit_size);
+                }
             }
             copy_cycles.resize(builder.variables.size());
         }
@@ -50,6 +63,15 @@ template <class Flavor> class ExecutionTrace_ {
      */
     static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
 
+    /**
+     * @brief The number of rows up to the end of the last nonempty block of the trace, beyond which the wire and
+     * selector polynomials vanish
+     *
+     * @param builder
+     * @param is_structured whether or not the trace is to be structured with a fixed block size
+     */
+    static size_t compute_trace_size(Builder& builder, bool is_structured = false);
+
   private:
     /**
      * @brief Add the wire and selector polynomials from the trace data to a honk or plonk proving key
@@ -83,11 +105,11 @@ template <class Flavor> class ExecutionTrace_ {
      * @brief Construct wire polynomials, selector polynomials and copy cycles from raw circuit data
      *
      * @param builder
-     * @param dyadic_circuit_size
+     * @param proving_key
      * @param is_structured whether or not the trace is to be structured with a fixed block size
      * @return TraceData
      */
-    static TraceData construct_trace_data(Builder& builder, size_t dyadic_circuit_size, bool is_structured = false);
+    static TraceData construct_trace_data(Builder& builder, ProvingKey& proving_key, bool is_structured = false);
 
     /**
      * @brief Populate the public inputs block
@@ -75,6 +75,7 @@
 #include <array>
 #include <barretenberg/srs/global_crs.hpp>
 #include <concepts>
+#include <utility>
 #include <vector>
 
 namespace bb {
@@ -115,6 +116,10 @@ template <typename FF, typename CommitmentKey_> class ProvingKey_ {
     // folded element by element.
     std::vector<FF> public_inputs;
 
+    // Ranges [start, end) of rows that may hold non-trivial data, i.e. outside of which the polynomials only contain
+    // the padding of the execution trace (see ProverInstance_). Sumcheck skips the edges lying entirely in the padding.
+    std::vector<std::pair<size_t, size_t>> active_row_ranges;
+
     ProvingKey_() = default;
     ProvingKey_(const size_t circuit_size, const size_t num_public_inputs)
     {
@@ -0,0 +1,60 @@
+#pragma once
+#include "barretenberg/common/zip_view.hpp"
+#include <cstddef>
+
+namespace bb {
+
+/**
+ * @brief The value of a prover polynomial at the current row of a RowView, read in place from the polynomial.
+ */
+template <typename FF> class ColumnValue {
+  public:
+    ColumnValue() = default;
+    ColumnValue(const FF* coefficients, const size_t* row)
+        : coefficients_(coefficients)
+        , row_(row)
+    {}
+
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    operator const FF&() const { return coefficients_[*row_]; }
+    bool operator==(const FF& other) const { return coefficients_[*row_] == other; }
+
+  private:
+    const FF* coefficients_ = nullptr;
+    const size_t* row_ = nullptr;
+};
+
+/**
+ * @brief A row of the prover polynomials of a flavor, with the same members as its AllValues.
+ *
+ * @details ProverPolynomials::get_row copies the value of every polynomial at a row, i.e. hundreds of field elements
+ * for the AVM, while a relation typically reads a few dozen of them. A RowView instead reads each value from its
+ * polynomial when it is accessed, and moving it to another row is a single write. It is meant for evaluating relations
+ * row by row outside of sumcheck, e.g. to check a circuit or compute log-derivative inverses.
+ *
+ * @tparam AllEntities The flavor's AllEntities template
+ */
+template <typename FF, template <typename> class AllEntities> class RowView : public AllEntities<ColumnValue<FF>> {
+  public:
+    template <typename Polynomials> explicit RowView(const Polynomials& polynomials, size_t row = 0)
+        : row_(row)
+    {
+        for (auto [value, polynomial] : zip_view(this->get_all(), polynomials.get_all())) {
+            value = ColumnValue<FF>(polynomial.begin(), &row_);
+        }
+    }
+    // The values point to the row of this object
+    RowView(const RowView& other) = delete;
+    RowView(RowView&& other) = delete;
+    RowView& operator=(const RowView& other) = delete;
+    RowView& operator=(RowView&& other) = delete;
+    ~RowView() = default;
+
+    void set_row(size_t row) { row_ = row; }
+    size_t get_row() const { return row_; }
+
+  private:
+    size_t row_;
+};
+
+} // namespace bb
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/eccvm/eccvm_circuit_builder.hpp"
 #include "barretenberg/eccvm/eccvm_prover.hpp"
 #include "barretenberg/eccvm/eccvm_trace_checker.hpp"
@@ -39,6 +40,7 @@ class GoblinProver {
     using TranslatorBuilder = bb::TranslatorCircuitBuilder;
     using TranslatorProver = bb::TranslatorProver;
     using TranslatorProvingKey = bb::TranslatorFlavor::ProvingKey;
+    using TranslatorCommitmentKey = bb::TranslatorFlavor::CommitmentKey;
     using RecursiveMergeVerifier = bb::stdlib::recursion::goblin::MergeRecursiveVerifier_<MegaCircuitBuilder>;
     using MergeProver = bb::MergeProver_<MegaFlavor>;
     using VerificationKey = MegaFlavor::VerificationKey;
@@ -64,6 +66,9 @@ class GoblinProver {
     std::unique_ptr<TranslatorBuilder> translator_builder;
     std::unique_ptr<TranslatorProver> translator_prover;
     std::unique_ptr<ECCVMProver> eccvm_prover;
+    // Computed ahead of the translator circuit, see precompute_translator_keys
+    std::shared_ptr<TranslatorProvingKey> translator_key;
+    std::shared_ptr<TranslatorCommitmentKey> translator_commitment_key;
 
     GoblinAccumulationOutput accumulator; // Used only for ACIR methods for now
 
@@ -152,6 +157,17 @@ class GoblinProver {
         goblin_proof.translation_evaluations = eccvm_prover->translation_evaluations;
     };
 
+    /**
+     * @brief Compute the translator proving key (but for its witness) and commitment key
+     * @details The translator circuit depends on the ECCVM challenges, but its size only depends on the op queue. So
+     * these can be computed before the ECCVM proof is complete.
+     */
+    void precompute_translator_keys()
+    {
+        translator_key = std::make_shared<TranslatorProvingKey>(TranslatorBuilder::compute_num_gates(op_queue));
+        translator_commitment_key = std::make_shared<TranslatorCommitmentKey>(translator_key->circuit_size);
+    };
+
     /**
      * @brief Construct a translator proof
      *
@@ -160,21 +176,29 @@ class GoblinProver {
     {
         translator_builder = std::make_unique<TranslatorBuilder>(
             eccvm_prover->translation_batching_challenge_v, eccvm_prover->evaluation_challenge_x, op_queue);
-        translator_prover = std::make_unique<TranslatorProver>(*translator_builder, eccvm_prover->transcript);
+        if (translator_key) {
+            translator_prover = std::make_unique<TranslatorProver>(*translator_builder,
+                                                                   eccvm_prover->transcript,
+                                                                   std::move(translator_key),
+                                                                   std::move(translator_commitment_key));
+        } else {
+            translator_prover = std::make_unique<TranslatorProver>(*translator_builder, eccvm_prover->transcript);
+        }
         goblin_proof.translator_proof = translator_prover->construct_proof();
     };
 
     /**
      * @brief Constuct a full Goblin proof (ECCVM, Translator, merge)
      * @details The merge proof is assumed to already have been constucted in the last accumulate step. It is simply
-     * moved into the final proof here.
+     * moved into the final proof here. The translator keys are computed concurrently with the ECCVM proof, which
+     * leaves the proof unchanged.
      *
      * @return Proof
      */
     GoblinProof prove()
     {
         goblin_proof.merge_proof = std::move(merge_proof);
-        prove_eccvm();
+        parallel_invoke([this] { prove_eccvm(); }, [this] { precompute_translator_keys(); });
         prove_translator();
         return goblin_proof;
     };
@@ -57,4 +57,31 @@ TEST_F(GoblinTests, MultipleCircuits)
     EXPECT_TRUE(verified);
 }
 
+/**
+ * @brief Check that computing the translator keys concurrently with the ECCVM proof does not change the proof
+ *
+ */
+TEST_F(GoblinTests, ConcurrentProofMatchesSequentialProof)
+{
+    GoblinProver goblin;
+    for (size_t idx = 0; idx < 3; ++idx) {
+        auto circuit = construct_mock_circuit(goblin.op_queue);
+        goblin.merge(circuit);
+    }
+
+    goblin.prove_eccvm();
+    goblin.prove_translator();
+    const GoblinProof sequential_proof = goblin.goblin_proof;
+
+    GoblinProof proof = goblin.prove();
+    EXPECT_EQ(proof.eccvm_proof, sequential_proof.eccvm_proof);
+    EXPECT_EQ(proof.translator_proof, sequential_proof.translator_proof);
+    EXPECT_EQ(proof.translation_evaluations.Px, sequential_proof.translation_evaluations.Px);
+
+    auto eccvm_vkey = std::make_shared<ECCVMVerificationKey>(goblin.get_eccvm_proving_key());
+    auto translator_vkey = std::make_shared<TranslatorVerificationKey>(goblin.get_translator_proving_key());
+    GoblinVerifier goblin_verifier{ eccvm_vkey, translator_vkey };
+    EXPECT_TRUE(goblin_verifier.verify(proof));
+}
+
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/787) Expand these tests.
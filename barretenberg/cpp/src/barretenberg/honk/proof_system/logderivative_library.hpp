@@ -1,4 +1,6 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
 #include <typeinfo>
 
 namespace bb {
@@ -21,6 +23,8 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * The rows are processed in parallel chunks, each of which is batch inverted on its own. Flavors that define a RowView
+ * read the rows in place, the others copy them with get_row.
  */
 template <typename Flavor, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
@@ -33,12 +37,10 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     auto lookup_relation = Relation();
 
     auto& inverse_polynomial = lookup_relation.template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
+    const auto compute_denominator = [&](size_t i, const auto& row) {
         bool has_inverse = lookup_relation.operation_exists_at_row(row);
         if (!has_inverse) {
-            continue;
+            return;
         }
         FF denominator = 1;
         bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
@@ -53,9 +55,22 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
         });
         inverse_polynomial[i] = denominator;
     };
-
-    // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+    run_loop_in_parallel(circuit_size, [&](size_t start, size_t end) {
+        if constexpr (requires { typename Flavor::RowView; }) {
+            typename Flavor::RowView row(polynomials);
+            for (size_t i = start; i < end; ++i) {
+                row.set_row(i);
+                compute_denominator(i, row);
+            }
+        } else {
+            // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
+            for (size_t i = start; i < end; ++i) {
+                compute_denominator(i, polynomials.get_row(i));
+            }
+        }
+        // todo might be inverting zero in field bleh bleh
+        FF::batch_invert(&inverse_polynomial[start], end - start);
+    });
 }
 
 /**
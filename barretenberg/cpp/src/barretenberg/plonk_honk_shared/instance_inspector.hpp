@@ -4,10 +4,10 @@
 
 namespace bb::instance_inspector {
 
-// Determine whether a polynomial has at least one non-zero coefficient
-bool is_non_zero(auto& polynomial)
+// Determine whether a polynomial has at least one non-zero coefficient (all of which lie in its window)
+bool is_non_zero(const auto& polynomial)
 {
-    for (auto& coeff : polynomial) {
+    for (const auto& coeff : polynomial.coeffs()) {
         if (!coeff.is_zero()) {
             return true;
         }
@@ -22,7 +22,7 @@ bool is_non_zero(auto& polynomial)
  */
 void inspect_instance(auto& prover_instance)
 {
-    auto& prover_polys = prover_instance->prover_polynomials;
+    const auto& prover_polys = prover_instance->proving_key.polynomials;
     std::vector<std::string> zero_polys;
     for (auto [label, poly] : zip_view(prover_polys.get_labels(), prover_polys.get_all())) {
         if (!is_non_zero(poly)) {
@@ -48,19 +48,20 @@ void inspect_instance(auto& prover_instance)
 void print_databus_info(auto& prover_instance)
 {
     info("\nInstance Inspector: Printing databus gate info.");
-    auto& key = prover_instance->proving_key;
+    // Read through a const reference so that the polynomials outside of their windows read as zero
+    const auto& polys = prover_instance->proving_key.polynomials;
     for (size_t idx = 0; idx < prover_instance->proving_key.circuit_size; ++idx) {
-        if (key->q_busread[idx] == 1) {
+        if (polys.q_busread[idx] == 1) {
             info("idx = ", idx);
-            info("q_busread = ", key->q_busread[idx]);
-            info("w_l = ", key->w_l[idx]);
-            info("w_r = ", key->w_r[idx]);
+            info("q_busread = ", polys.q_busread[idx]);
+            info("w_l = ", polys.w_l[idx]);
+            info("w_r = ", polys.w_r[idx]);
         }
-        if (key->calldata_read_counts[idx] > 0) {
+        if (polys.calldata_read_counts[idx] > 0) {
             info("idx = ", idx);
-            info("read_counts = ", key->calldata_read_counts[idx]);
-            info("calldata = ", key->calldata[idx]);
-            info("databus_id = ", key->databus_id[idx]);
+            info("read_counts = ", polys.calldata_read_counts[idx]);
+            info("calldata = ", polys.calldata[idx]);
+            info("databus_id = ", polys.databus_id[idx]);
         }
     }
     info();
@@ -71,8 +71,10 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
         typename Flavor::AllValues evaluations;
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): construction of evaluations is equivalent to
         // calling get_row which creates full copies. avoid?
+        // The polynomials are read through their windows, outside of which their coefficients are zero
+        const auto& polynomials = std::as_const(full_polynomials);
         for (size_t i = start; i < end; ++i) {
-            for (auto [eval, full_poly] : zip_view(evaluations.get_all(), full_polynomials.get_all())) {
+            for (auto [eval, full_poly] : zip_view(evaluations.get_all(), polynomials.get_all())) {
                 eval = full_poly.size() > i ? full_poly[i] : 0;
             }
             numerator[i] = GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
@@ -3,6 +3,7 @@
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include "polynomial_arena.hpp"
 #include "polynomial_arithmetic.hpp"
 #include <cstddef>
 #include <fcntl.h>
@@ -18,14 +19,26 @@ namespace bb {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
 template <typename Fr> std::shared_ptr<Fr[]> _allocate_aligned_memory(const size_t n_elements)
 {
+    const size_t size = sizeof(Fr) * n_elements;
+    // Draw from the arena of the current proof, if any (see polynomial_arena.hpp)
+    if (size >= PolynomialArena::MIN_ALLOCATION_SIZE) {
+        if (auto arena = PolynomialArena::current()) {
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+            return std::static_pointer_cast<Fr[]>(arena->allocate(size));
+        }
+    }
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
-    return std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * n_elements));
+    return std::static_pointer_cast<Fr[]>(get_mem_slab(size));
 }
 
-template <typename Fr> void Polynomial<Fr>::allocate_backing_memory(size_t n_elements)
+template <typename Fr>
+void Polynomial<Fr>::allocate_backing_memory(size_t n_elements, size_t start_index, size_t end_index)
 {
+    ASSERT(start_index <= end_index && end_index <= n_elements);
     size_ = n_elements;
-    // capacity() is size_ plus padding for shifted polynomials
+    start_index_ = start_index;
+    end_index_ = end_index;
+    // capacity() is the window plus padding for shifted polynomials
     backing_memory_ = _allocate_aligned_memory<Fr>(capacity());
     coefficients_ = backing_memory_.get();
 }
@@ -59,6 +72,25 @@ template <typename Fr> Polynomial<Fr>::Polynomial(size_t initial_size, DontZeroM
     allocate_backing_memory(initial_size);
 }
 
+/**
+ * @brief Initialize a Polynomial to size 'initial_size', whose coefficients outside of [start_index, end_index) are
+ * zero. Only the window is allocated, and zeroed.
+ */
+template <typename Fr> Polynomial<Fr>::Polynomial(size_t initial_size, size_t start_index, size_t end_index)
+{
+    allocate_backing_memory(initial_size, start_index, end_index);
+    memset(static_cast<void*>(coefficients_), 0, sizeof(Fr) * capacity());
+}
+
+template <typename Fr>
+Polynomial<Fr>::Polynomial(size_t initial_size, size_t start_index, size_t end_index, DontZeroMemory flag)
+{
+    (void)flag;
+    allocate_backing_memory(initial_size, start_index, end_index);
+    // The padding must still read as zero
+    zero_memory_beyond(end_index - start_index);
+}
+
 template <typename Fr>
 Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other)
     : Polynomial<Fr>(other, other.size())
@@ -67,10 +99,17 @@ Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other)
 // fully copying "expensive" constructor
 template <typename Fr> Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other, const size_t target_size)
 {
-    allocate_backing_memory(std::max(target_size, other.size()));
+    const size_t size = std::max(target_size, other.size());
+    // A dense polynomial stays dense, while a windowed one keeps its window
+    if (other.is_dense()) {
+        allocate_backing_memory(size);
+    } else {
+        allocate_backing_memory(size, other.start_index_, other.end_index_);
+    }
 
-    memcpy(static_cast<void*>(coefficients_), static_cast<void*>(other.coefficients_), sizeof(Fr) * other.size_);
-    zero_memory_beyond(other.size_);
+    const size_t window_size = other.end_index_ - other.start_index_;
+    memcpy(static_cast<void*>(coefficients_), static_cast<void*>(other.coefficients_), sizeof(Fr) * window_size);
+    zero_memory_beyond(window_size);
 }
 
 // move constructor
@@ -79,6 +118,8 @@ Polynomial<Fr>::Polynomial(Polynomial<Fr>&& other) noexcept
     : backing_memory_(std::exchange(other.backing_memory_, nullptr))
     , coefficients_(std::exchange(other.coefficients_, nullptr))
     , size_(std::exchange(other.size_, 0))
+    , start_index_(std::exchange(other.start_index_, 0))
+    , end_index_(std::exchange(other.end_index_, 0))
 {}
 
 // span constructor
@@ -110,9 +151,10 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(const Polynomia
     if (this == &other) {
         return *this;
     }
-    allocate_backing_memory(other.size_);
-    memcpy(static_cast<void*>(coefficients_), static_cast<void*>(other.coefficients_), sizeof(Fr) * other.size_);
-    zero_memory_beyond(size_);
+    allocate_backing_memory(other.size_, other.start_index_, other.end_index_);
+    const size_t window_size = end_index_ - start_index_;
+    memcpy(static_cast<void*>(coefficients_), static_cast<void*>(other.coefficients_), sizeof(Fr) * window_size);
+    zero_memory_beyond(window_size);
     return *this;
 }
 
@@ -134,6 +176,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(Polynomial&& ot
     backing_memory_ = std::exchange(other.backing_memory_, nullptr);
     coefficients_ = std::exchange(other.coefficients_, nullptr);
     size_ = std::exchange(other.size_, 0);
+    start_index_ = std::exchange(other.start_index_, 0);
+    end_index_ = std::exchange(other.end_index_, 0);
     return *this;
 }
 
@@ -142,18 +186,63 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share() const
     Polynomial p;
     p.backing_memory_ = backing_memory_;
     p.size_ = size_;
+    p.start_index_ = start_index_;
+    p.end_index_ = end_index_;
     p.coefficients_ = coefficients_;
     return p;
 }
 
+template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share(const size_t offset, const size_t size) const
+{
+    return share(offset, size, 0, size);
+}
+
+template <typename Fr>
+Polynomial<Fr> Polynomial<Fr>::share(const size_t offset,
+                                     const size_t size,
+                                     const size_t start_index,
+                                     const size_t end_index) const
+{
+    ASSERT(start_index <= end_index && end_index <= size);
+    ASSERT(offset + (end_index - start_index) <= end_index_ - start_index_);
+    Polynomial p;
+    p.backing_memory_ = backing_memory_;
+    p.size_ = size;
+    p.start_index_ = start_index;
+    p.end_index_ = end_index;
+    p.coefficients_ = coefficients_ + offset;
+    return p;
+}
+
+template <typename Fr> void Polynomial<Fr>::expand(const size_t start_index, const size_t end_index)
+{
+    if (start_index >= start_index_ && end_index <= end_index_) {
+        return;
+    }
+    Polynomial expanded(size_, std::min(start_index, start_index_), std::max(end_index, end_index_));
+    const size_t window_size = end_index_ - start_index_;
+    if (window_size > 0) {
+        memcpy(static_cast<void*>(expanded.coefficients_ + (start_index_ - expanded.start_index_)),
+               static_cast<void*>(coefficients_),
+               sizeof(Fr) * window_size);
+    }
+    *this = std::move(expanded);
+}
+
 template <typename Fr> Fr Polynomial<Fr>::evaluate(const Fr& z, const size_t target_size) const
 {
-    return polynomial_arithmetic::evaluate(coefficients_, z, target_size);
+    // Coefficients beyond the window are zero, and those before it contribute z^start_index
+    const size_t end = std::min(target_size, end_index_);
+    if (end <= start_index_) {
+        return Fr::zero();
+    }
+    Fr result = polynomial_arithmetic::evaluate(coefficients_, z, end - start_index_);
+    return start_index_ == 0 ? result : result * z.pow(start_index_);
 }
 
 template <typename Fr> Fr Polynomial<Fr>::evaluate(const Fr& z) const
 {
-    return polynomial_arithmetic::evaluate(coefficients_, z, size_);
+    return evaluate(z, size_);
 }
 
 template <typename Fr> bool Polynomial<Fr>::operator==(Polynomial const& rhs) const
@@ -166,9 +255,9 @@ template <typename Fr> bool Polynomial<Fr>::operator==(Polynomial const& rhs) co
     if (size() != rhs.size()) {
         return false;
     }
-    // Each coefficient must agree
+    // Each coefficient must agree, including those outside of either window
     for (size_t i = 0; i < size(); i++) {
-        if (coefficients_[i] != rhs.coefficients_[i]) {
+        if ((*this)[i] != rhs[i]) {
             return false;
         }
     }
@@ -322,11 +411,20 @@ Fr Polynomial<Fr>::evaluate_from_fft(const EvaluationDomain<Fr>& large_domain,
 template <typename Fr> Polynomial<Fr> Polynomial<Fr>::shifted() const
 {
     ASSERT(size_ > 0);
-    ASSERT(coefficients_[0].is_zero());
-    ASSERT(coefficients_[size_].is_zero()); // relies on MAXIMUM_COEFFICIENT_SHIFT >= 1
+    ASSERT((*this)[0].is_zero());
     Polynomial p;
     p.backing_memory_ = backing_memory_;
     p.size_ = size_;
+    if (start_index_ > 0) {
+        // The coefficients stay where they are, and the window moves down by one
+        p.start_index_ = start_index_ - 1;
+        p.end_index_ = end_index_ - 1;
+        p.coefficients_ = coefficients_;
+        return p;
+    }
+    ASSERT(coefficients_[end_index_].is_zero()); // relies on MAXIMUM_COEFFICIENT_SHIFT >= 1
+    p.start_index_ = 0;
+    p.end_index_ = end_index_;
     p.coefficients_ = coefficients_ + 1;
     return p;
 }
@@ -363,10 +461,16 @@ template <typename Fr> void Polynomial<Fr>::set_to_right_shifted(std::span<Fr> c
     zero_memory_beyond(size_);
 }
 
-template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other, Fr scaling_factor)
+template <typename Fr>
+template <typename Op>
+void Polynomial<Fr>::update_window(std::span<const Fr> other, const size_t start_index, Op op)
 {
     const size_t other_size = other.size();
-    ASSERT(in_place_operation_viable(other_size));
+    ASSERT(start_index + other_size <= size_);
+    if (start_index < start_index_ || start_index + other_size > end_index_) {
+        expand(start_index, start_index + other_size);
+    }
+    Fr* coefficients = coefficients_ + (start_index - start_index_);
 
     size_t num_threads = calculate_num_threads(other_size);
     size_t range_per_thread = other_size / num_threads;
@@ -375,56 +479,53 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
         for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] += scaling_factor * other[i];
+            coefficients[i] += op(other[i]);
         }
     });
 }
 
-template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(std::span<const Fr> other)
+template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other, Fr scaling_factor)
 {
-    const size_t other_size = other.size();
-    ASSERT(in_place_operation_viable(other_size));
+    update_window(other, 0, [&](const Fr& coefficient) { return scaling_factor * coefficient; });
+}
 
-    size_t num_threads = calculate_num_threads(other_size);
-    size_t range_per_thread = other_size / num_threads;
-    size_t leftovers = other_size - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] += other[i];
-        }
+template <typename Fr> void Polynomial<Fr>::add_scaled(const Polynomial& other, Fr scaling_factor)
+{
+    update_window(other.coeffs(), other.start_index_, [&](const Fr& coefficient) {
+        return scaling_factor * coefficient;
     });
+}
 
+template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(std::span<const Fr> other)
+{
+    update_window(other, 0, [](const Fr& coefficient) { return coefficient; });
     return *this;
 }
 
-template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(std::span<const Fr> other)
+template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(const Polynomial& other)
 {
-    const size_t other_size = other.size();
-    ASSERT(in_place_operation_viable(other_size));
+    update_window(other.coeffs(), other.start_index_, [](const Fr& coefficient) { return coefficient; });
+    return *this;
+}
 
-    size_t num_threads = calculate_num_threads(other_size);
-    size_t range_per_thread = other_size / num_threads;
-    size_t leftovers = other_size - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_[i] -= other[i];
-        }
-    });
+template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(std::span<const Fr> other)
+{
+    update_window(other, 0, [](const Fr& coefficient) { return -coefficient; });
+    return *this;
+}
 
+template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(const Polynomial& other)
+{
+    update_window(other.coeffs(), other.start_index_, [](const Fr& coefficient) { return -coefficient; });
     return *this;
 }
 
 template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scaling_factor)
 {
-    ASSERT(in_place_operation_viable());
-
-    size_t num_threads = calculate_num_threads(size_);
-    size_t range_per_thread = size_ / num_threads;
-    size_t leftovers = size_ - (range_per_thread * num_threads);
+    const size_t window_size = end_index_ - start_index_;
+    size_t num_threads = calculate_num_threads(window_size);
+    size_t range_per_thread = window_size / num_threads;
+    size_t leftovers = window_size - (range_per_thread * num_threads);
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
@@ -454,16 +555,18 @@ template <typename Fr> Fr Polynomial<Fr>::evaluate_mle(std::span<const Fr> evalu
     pointer tmp_ptr = _allocate_aligned_memory<Fr>(sizeof(Fr) * n_l);
     auto tmp = tmp_ptr.get();
 
-    Fr* prev = coefficients_;
+    // The coefficients outside of the window read as zero
+    const size_t offset = shift ? 1 : 0;
     if (shift) {
-        ASSERT(prev[0] == Fr::zero());
-        prev++;
+        ASSERT((*this)[0] == Fr::zero());
     }
 
     Fr u_l = evaluation_points[0];
     for (size_t i = 0; i < n_l; ++i) {
-        // curr[i] = (Fr(1) - u_l) * prev[i << 1] + u_l * prev[(i << 1) + 1];
-        tmp[i] = prev[i << 1] + u_l * (prev[(i << 1) + 1] - prev[i << 1]);
+        const Fr& even = (*this)[(i << 1) + offset];
+        const Fr& odd = (*this)[(i << 1) + 1 + offset];
+        // curr[i] = (Fr(1) - u_l) * even + u_l * odd;
+        tmp[i] = even + u_l * (odd - even);
     }
     // partially evaluate the m-1 remaining points
     for (size_t l = 1; l < m; ++l) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "evaluation_domain.hpp"
@@ -9,6 +10,20 @@
 namespace bb {
 enum class DontZeroMemory { FLAG };
 
+/**
+ * @brief A polynomial of degree < size(), given by its coefficients.
+ *
+ * @details Only the coefficients in the window [start_index(), end_index()) are stored; the others are zero. Reading
+ * a coefficient outside of the window returns zero without touching memory, so sparse columns (e.g. the Lagrange
+ * polynomials, the lookup tables, or the wires of a structured trace) cost memory and work in proportion to their
+ * window only. Code that handles windowed polynomials reads them with the const operator[] or iterates over coeffs().
+ *
+ * A polynomial whose window is [0, size()) is dense. Every coefficient of a polynomial can still be written to: the
+ * non-const accessors (operator[], at, begin, end and data, and thus the conversions to a std::span) first make the
+ * polynomial dense if the coefficient is outside of the window. This reallocates the polynomial, so it must not happen
+ * while other threads access it, and it no longer shares its memory with its shallow copies (e.g. its shift). A const
+ * polynomial that is not dense cannot be used as a contiguous range.
+ */
 template <typename Fr> class Polynomial {
   public:
     /**
@@ -27,6 +42,9 @@ template <typename Fr> class Polynomial {
     Polynomial(size_t initial_size);
     // Constructor that does not initialize values, use with caution to save time.
     Polynomial(size_t initial_size, DontZeroMemory flag);
+    // A polynomial of size `initial_size` whose nonzero coefficients are within [start_index, end_index)
+    Polynomial(size_t initial_size, size_t start_index, size_t end_index);
+    Polynomial(size_t initial_size, size_t start_index, size_t end_index, DontZeroMemory flag);
     Polynomial(const Polynomial& other);
     Polynomial(const Polynomial& other, size_t target_size);
 
@@ -58,6 +76,22 @@ template <typename Fr> class Polynomial {
      */
     Polynomial share() const;
 
+    /**
+     * Return a shallow view of the `size` coefficients starting at `offset`, i.e. underlying memory is shared.
+     */
+    Polynomial share(size_t offset, size_t size) const;
+
+    /**
+     * Return a shallow view of size `size`, whose window [start_index, end_index) is stored from the `offset`-th
+     * stored coefficient of this one, i.e. underlying memory is shared.
+     */
+    Polynomial share(size_t offset, size_t size, size_t start_index, size_t end_index) const;
+
+    /**
+     * @brief Grow the window to include [start_index, end_index). This reallocates, unless the window already does.
+     */
+    void expand(size_t start_index, size_t end_index);
+
     std::array<uint8_t, 32> hash() const { return crypto::sha256(byte_span()); }
 
     void clear()
@@ -66,6 +100,8 @@ template <typename Fr> class Polynomial {
         // backing_memory_.reset();
         coefficients_ = nullptr;
         size_ = 0;
+        start_index_ = 0;
+        end_index_ = 0;
     }
 
     /**
@@ -78,7 +114,7 @@ template <typename Fr> class Polynomial {
             ASSERT(false);
             info("Checking is_zero on an empty Polynomial!");
         }
-        for (size_t i = 0; i < size(); i++) {
+        for (size_t i = 0; i < end_index_ - start_index_; i++) {
             if (coefficients_[i] != 0) {
                 return false;
             }
@@ -88,21 +124,38 @@ template <typename Fr> class Polynomial {
 
     bool operator==(Polynomial const& rhs) const;
 
-    // Const and non const versions of coefficient accessors
-    Fr const& operator[](const size_t i) const { return coefficients_[i]; }
+    // Const and non const versions of coefficient accessors. Reading a coefficient outside of the window returns zero,
+    // while writing to it makes the polynomial dense.
+    Fr const& operator[](const size_t i) const
+    {
+        if (i < start_index_ || i >= end_index_) {
+            return zero_;
+        }
+        return coefficients_[i - start_index_];
+    }
 
-    Fr& operator[](const size_t i) { return coefficients_[i]; }
+    Fr& operator[](const size_t i)
+    {
+        if (i < start_index_ || i >= end_index_) {
+            make_dense();
+        }
+        return coefficients_[i - start_index_];
+    }
 
     Fr const& at(const size_t i) const
     {
-        ASSERT(i < capacity());
-        return coefficients_[i];
+        ASSERT(i < size_ + MAXIMUM_COEFFICIENT_SHIFT);
+        return (*this)[i];
     };
 
     Fr& at(const size_t i)
     {
-        ASSERT(i < capacity());
-        return coefficients_[i];
+        // The coefficient after the window is padding that can be written to
+        if (i < start_index_ || i >= start_index_ + capacity()) {
+            make_dense();
+        }
+        ASSERT(i < size_ + MAXIMUM_COEFFICIENT_SHIFT);
+        return coefficients_[i - start_index_];
     };
 
     Fr evaluate(const Fr& z, size_t target_size) const;
@@ -143,7 +196,8 @@ template <typename Fr> class Polynomial {
      * @brief Returns an std::span of the left-shift of self.
      *
      * @details If the n coefficients of self are (0, a₁, …, aₙ₋₁),
-     * we returns the view of the n-1 coefficients (a₁, …, aₙ₋₁).
+     * we returns the view of the n-1 coefficients (a₁, …, aₙ₋₁). If the window of self starts after 0, this is the
+     * same memory with the window moved down by one.
      */
     Polynomial shifted() const;
 
@@ -166,6 +220,8 @@ template <typename Fr> class Polynomial {
      * @param scaling_factor scaling factor by which all coefficients of q(X) are multiplied
      */
     void add_scaled(std::span<const Fr> other, Fr scaling_factor);
+    // Only iterates over the window of `other`, the window of self being expanded to include it
+    void add_scaled(const Polynomial& other, Fr scaling_factor);
 
     /**
      * @brief adds the polynomial q(X) 'other'.
@@ -173,6 +229,7 @@ template <typename Fr> class Polynomial {
      * @param other q(X)
      */
     Polynomial& operator+=(std::span<const Fr> other);
+    Polynomial& operator+=(const Polynomial& other);
 
     /**
      * @brief subtracts the polynomial q(X) 'other'.
@@ -180,6 +237,7 @@ template <typename Fr> class Polynomial {
      * @param other q(X)
      */
     Polynomial& operator-=(std::span<const Fr> other);
+    Polynomial& operator-=(const Polynomial& other);
 
     /**
      * @brief sets this = p(X) to s⋅p(X)
@@ -232,22 +290,55 @@ template <typename Fr> class Polynomial {
     void factor_roots(std::span<const Fr> roots) { polynomial_arithmetic::factor_roots(std::span{ *this }, roots); };
     void factor_roots(const Fr& root) { polynomial_arithmetic::factor_roots(std::span{ *this }, root); };
 
-    iterator begin() { return coefficients_; }
-    iterator end() { return coefficients_ + size_; }
-    pointer data() { return backing_memory_; }
+    // Iterating over all coefficients makes the polynomial dense, or requires it to be if it is const
+    iterator begin()
+    {
+        make_dense();
+        return coefficients_;
+    }
+    iterator end()
+    {
+        make_dense();
+        return coefficients_ + size_;
+    }
+    pointer data()
+    {
+        make_dense();
+        return backing_memory_;
+    }
 
     std::span<uint8_t> byte_span() const
     {
+        check_dense();
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         return { reinterpret_cast<uint8_t*>(coefficients_), size_ * sizeof(Fr) };
     }
 
-    const_iterator begin() const { return coefficients_; }
-    const_iterator end() const { return coefficients_ + size_; }
-    const_pointer data() const { return backing_memory_; }
+    const_iterator begin() const
+    {
+        check_dense();
+        return coefficients_;
+    }
+    const_iterator end() const
+    {
+        check_dense();
+        return coefficients_ + size_;
+    }
+    const_pointer data() const
+    {
+        check_dense();
+        return backing_memory_;
+    }
+
+    // The coefficients in the window, the i-th of which is the coefficient of index start_index() + i
+    std::span<Fr> coeffs() { return { coefficients_, end_index_ - start_index_ }; }
+    std::span<const Fr> coeffs() const { return { coefficients_, end_index_ - start_index_ }; }
 
     std::size_t size() const { return size_; }
-    std::size_t capacity() const { return size_ + MAXIMUM_COEFFICIENT_SHIFT; }
+    std::size_t start_index() const { return start_index_; }
+    std::size_t end_index() const { return end_index_; }
+    // The number of coefficients stored, i.e. the window plus padding for shifted polynomials
+    std::size_t capacity() const { return end_index_ - start_index_ + MAXIMUM_COEFFICIENT_SHIFT; }
 
     static Polynomial random(const size_t num_coeffs)
     {
@@ -259,10 +350,26 @@ template <typename Fr> class Polynomial {
   private:
     // allocate a fresh memory pointer for backing memory
     // DOES NOT initialize memory
-    void allocate_backing_memory(size_t n_elements);
+    void allocate_backing_memory(size_t n_elements, size_t start_index, size_t end_index);
+    void allocate_backing_memory(size_t n_elements) { allocate_backing_memory(n_elements, 0, n_elements); }
+
+    bool is_dense() const { return start_index_ == 0 && end_index_ == size_; }
+    void make_dense() { expand(0, size_); }
+    void check_dense() const
+    {
+        if (!is_dense()) {
+            throw_or_abort("Polynomial: a const polynomial that is not dense cannot be used as a contiguous range");
+        }
+    }
+
+    // Adds op(other[i]) to the coefficient start_index + i of self, expanding the window of self to include them
+    template <typename Op> void update_window(std::span<const Fr> other, size_t start_index, Op op);
 
     // safety check for in place operations
-    bool in_place_operation_viable(size_t domain_size = 0) { return (size() >= domain_size); }
+    bool in_place_operation_viable(size_t domain_size = 0)
+    {
+        return start_index_ == 0 && end_index_ >= domain_size;
+    }
 
     void zero_memory_beyond(size_t start_position);
     // When a polynomial is instantiated from a size alone, the memory allocated corresponds to
@@ -279,6 +386,12 @@ template <typename Fr> class Polynomial {
     // 'capacity' of the array. It is not explicitly tied to the degree and is not changed by any operations on the
     // polynomial.
     size_t size_ = 0;
+    // The window of coefficients that are stored, the first of which coefficients_ points to
+    size_t start_index_ = 0;
+    size_t end_index_ = 0;
+
+    // What the coefficients outside of the window read as
+    static constexpr Fr zero_ = Fr::zero();
 };
 
 template <typename Fr> inline std::ostream& operator<<(std::ostream& os, Polynomial<Fr> const& p)
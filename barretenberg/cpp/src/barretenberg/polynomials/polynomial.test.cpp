@@ -59,3 +59,112 @@ TEST(Polynomial, Share)
 
     EXPECT_NE(poly_clone, poly);
 }
+
+// A polynomial that only stores the coefficients in a window, and reads as zero outside of it
+TEST(Polynomial, Window)
+{
+    using FF = bb::fr;
+    using Polynomial = Polynomial<FF>;
+    const size_t SIZE = 16;
+    const size_t START = 5;
+    const size_t END = 9;
+    Polynomial poly(SIZE, START, END);
+    Polynomial dense(SIZE);
+    for (size_t i = START; i < END; ++i) {
+        poly[i] = FF::random_element();
+        dense[i] = poly[i];
+    }
+
+    EXPECT_EQ(poly.size(), SIZE);
+    EXPECT_EQ(poly.coeffs().size(), END - START);
+    EXPECT_EQ(std::as_const(poly)[0], FF(0));
+    EXPECT_EQ(std::as_const(poly)[SIZE - 1], FF(0));
+    EXPECT_EQ(poly, dense);
+
+    const FF z = FF::random_element();
+    EXPECT_EQ(poly.evaluate(z), dense.evaluate(z));
+    std::vector<FF> u(numeric::get_msb(SIZE));
+    for (auto& u_i : u) {
+        u_i = FF::random_element();
+    }
+    EXPECT_EQ(poly.evaluate_mle(u), dense.evaluate_mle(u));
+
+    // The shift reuses the memory of the polynomial
+    auto poly_shifted = poly.shifted();
+    EXPECT_EQ(poly_shifted.start_index(), START - 1);
+    EXPECT_EQ(poly_shifted.coeffs().data(), poly.coeffs().data());
+    auto dense_shifted = dense.shifted();
+    EXPECT_EQ(poly_shifted, dense_shifted);
+    EXPECT_EQ(poly.evaluate_mle(u, /*shift=*/true), dense.evaluate_mle(u, /*shift=*/true));
+
+    // Copies keep the window, and arithmetic only touches it
+    Polynomial copy(poly);
+    EXPECT_EQ(copy.start_index(), START);
+    EXPECT_EQ(copy.end_index(), END);
+    copy *= FF(2);
+    dense += poly;
+    EXPECT_EQ(copy, dense);
+
+    // Expanding the window keeps the coefficients
+    copy.expand(0, SIZE);
+    EXPECT_EQ(copy.start_index(), 0UL);
+    EXPECT_EQ(copy.end_index(), SIZE);
+    EXPECT_EQ(copy, dense);
+}
+
+// Writing to or iterating over all coefficients of a windowed polynomial makes it dense
+TEST(Polynomial, WindowFullAccess)
+{
+    using FF = bb::fr;
+    using Polynomial = Polynomial<FF>;
+    const size_t SIZE = 16;
+    const size_t START = 4;
+    const size_t END = 12;
+
+    auto random_windowed = [&]() {
+        Polynomial poly(SIZE, START, END);
+        for (auto& coeff : poly.coeffs()) {
+            coeff = FF::random_element();
+        }
+        return poly;
+    };
+
+    // A write outside of the window keeps the other coefficients
+    Polynomial poly = random_windowed();
+    Polynomial expected(poly);
+    expected.expand(0, SIZE);
+    poly[SIZE - 1] = FF(7);
+    expected[SIZE - 1] = FF(7);
+    EXPECT_EQ(poly.start_index(), 0UL);
+    EXPECT_EQ(poly.end_index(), SIZE);
+    EXPECT_EQ(poly, expected);
+
+    // Iterating over a non-const polynomial visits all of its coefficients
+    poly = random_windowed();
+    size_t num_coeffs = 0;
+    for (auto& coeff : poly) {
+        coeff += FF(1);
+        num_coeffs++;
+    }
+    EXPECT_EQ(num_coeffs, SIZE);
+    EXPECT_EQ(poly[0], FF(1));
+    EXPECT_EQ(poly[SIZE - 1], FF(1));
+
+    // Arithmetic with a span expands the window to that of the span
+    poly = random_windowed();
+    expected = poly;
+    expected.expand(0, SIZE);
+    std::vector<FF> other(SIZE);
+    for (auto& coeff : other) {
+        coeff = FF::random_element();
+    }
+    poly += other;
+    for (size_t i = 0; i < SIZE; ++i) {
+        expected[i] += other[i];
+    }
+    EXPECT_EQ(poly, expected);
+
+    // A const polynomial that is not dense cannot be used as a contiguous range
+    const Polynomial windowed = random_windowed();
+    EXPECT_ANY_THROW(windowed.begin());
+}
@@ -0,0 +1,206 @@
+#include "polynomial_arena.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace bb {
+
+namespace {
+constexpr size_t PAGE_SIZE = size_t(1) << 12;
+constexpr size_t HUGE_PAGE_SIZE = size_t(1) << 21;
+
+size_t round_up(size_t size, size_t alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+PolynomialArena::PolynomialArena()
+    : PolynomialArena(Options{})
+{}
+
+PolynomialArena::PolynomialArena(Options options)
+    : options_(options)
+    , state_(std::make_shared<State>())
+{}
+
+PolynomialArena::~PolynomialArena()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+    state_->destroyed = true;
+    for (auto& [size, buffers] : state_->free_buffers) {
+        for (void* ptr : buffers) {
+            unmap(ptr, size);
+            state_->stats.mapped_bytes -= size;
+        }
+    }
+    state_->free_buffers.clear();
+}
+
+size_t PolynomialArena::mapped_size(size_t size) const
+{
+    // Huge pages are only worth it (and for HUGETLB, only possible) for whole huge pages
+    if (options_.backing == Backing::HUGETLB ||
+        (options_.backing == Backing::TRANSPARENT_HUGE_PAGES && size >= HUGE_PAGE_SIZE)) {
+        return round_up(size, HUGE_PAGE_SIZE);
+    }
+    return round_up(size, PAGE_SIZE);
+}
+
+void* PolynomialArena::map(size_t size)
+{
+    void* ptr = nullptr;
+#if defined(__linux__)
+    if (options_.backing == Backing::HUGETLB) {
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr == MAP_FAILED) {
+            ptr = nullptr;
+        }
+    }
+    if (ptr == nullptr && size % HUGE_PAGE_SIZE == 0 && options_.backing != Backing::DEFAULT) {
+        // Over-map so that the buffer can start on a huge page boundary, which transparent huge pages require
+        void* region = mmap(nullptr, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED) {
+            throw_or_abort("PolynomialArena: failed to map " + std::to_string(size) + " bytes");
+        }
+        auto start = reinterpret_cast<uintptr_t>(region); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        const uintptr_t aligned_start = round_up(start, HUGE_PAGE_SIZE);
+        if (aligned_start > start) {
+            munmap(region, aligned_start - start);
+        }
+        if (const size_t tail = HUGE_PAGE_SIZE - (aligned_start - start); tail > 0) {
+            munmap(reinterpret_cast<void*>(aligned_start + size), tail); // NOLINT
+        }
+        ptr = reinterpret_cast<void*>(aligned_start); // NOLINT(performance-no-int-to-ptr)
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+    if (ptr == nullptr) {
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) {
+            throw_or_abort("PolynomialArena: failed to map " + std::to_string(size) + " bytes");
+        }
+    }
+#else
+    ptr = aligned_alloc(32, size);
+#endif
+
+    if (options_.prefault) {
+        auto* bytes = static_cast<volatile uint8_t*>(ptr);
+        run_loop_in_parallel(size / PAGE_SIZE, [bytes](size_t start, size_t end) {
+            for (size_t page = start; page < end; ++page) {
+                bytes[page * PAGE_SIZE] = 0;
+            }
+        });
+    }
+    return ptr;
+}
+
+void PolynomialArena::unmap(void* ptr, size_t size)
+{
+#if defined(__linux__)
+    munmap(ptr, size);
+#else
+    static_cast<void>(size);
+    aligned_free(ptr);
+#endif
+}
+
+std::shared_ptr<void> PolynomialArena::allocate(size_t size)
+{
+    const size_t buffer_size = mapped_size(size);
+    void* ptr = nullptr;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+        auto it = state_->free_buffers.find(buffer_size);
+        if (it != state_->free_buffers.end() && !it->second.empty()) {
+            ptr = it->second.back();
+            it->second.pop_back();
+            state_->stats.num_reused++;
+        }
+    }
+    // Map outside of the lock, as prefaulting may take a while
+    const bool is_new = ptr == nullptr;
+    if (is_new) {
+        ptr = map(buffer_size);
+    }
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+        Stats& stats = state_->stats;
+        if (is_new) {
+            stats.num_mapped++;
+            stats.mapped_bytes += buffer_size;
+            stats.peak_mapped_bytes = std::max(stats.peak_mapped_bytes, stats.mapped_bytes);
+        }
+        stats.live_bytes += buffer_size;
+        stats.peak_live_bytes = std::max(stats.peak_live_bytes, stats.live_bytes);
+    }
+    return { ptr, [state = state_, buffer_size](void* p) { state->free(p, buffer_size); } };
+}
+
+void PolynomialArena::State::free(void* ptr, size_t mapped_size)
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    stats.live_bytes -= mapped_size;
+    if (destroyed) {
+        stats.mapped_bytes -= mapped_size;
+        unmap(ptr, mapped_size);
+        return;
+    }
+    free_buffers[mapped_size].push_back(ptr);
+}
+
+void PolynomialArena::release()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+    for (auto& [size, buffers] : state_->free_buffers) {
+        for (void* ptr : buffers) {
+            unmap(ptr, size);
+            state_->stats.mapped_bytes -= size;
+        }
+    }
+    state_->free_buffers.clear();
+}
+
+PolynomialArena::Stats PolynomialArena::get_stats() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+    return state_->stats;
+}
+
+std::shared_ptr<PolynomialArena> PolynomialArena::current()
+{
+    return task_locals().polynomial_arena;
+}
+
+PolynomialArena::Scope::Scope(std::shared_ptr<PolynomialArena> arena)
+    : previous_(std::exchange(task_locals().polynomial_arena, std::move(arena)))
+{}
+
+PolynomialArena::Scope::~Scope()
+{
+    // Scopes live on the stack of a thread (or of a task, whose TaskLocals are restored when it returns), so they
+    // close in the reverse order of opening
+    task_locals().polynomial_arena = std::move(previous_);
+}
+
+} // namespace bb
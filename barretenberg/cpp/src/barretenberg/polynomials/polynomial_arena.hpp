@@ -0,0 +1,136 @@
+#pragma once
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace bb {
+
+/**
+ * @brief A memory arena for the coefficients of the polynomials of a proof.
+ *
+ * @details A proof allocates and frees hundreds of polynomials of a handful of sizes. Drawn from the heap (see
+ * common/slab_allocator.hpp), they fragment it, fault their pages in on first touch each time, and leave the process
+ * RSS high once the proof is done. An arena instead maps large buffers itself (optionally backed by huge pages), keeps
+ * them when they are freed, and hands them out again to polynomials of the same size. Everything it holds is released
+ * when it is destroyed, or with `release`.
+ *
+ * Polynomials draw from the arena of the innermost live `PolynomialArena::Scope`, e.g.
+ *
+ *     auto arena = std::make_shared<PolynomialArena>();
+ *     {
+ *         PolynomialArena::Scope scope(arena);
+ *         ... // polynomials constructed here, including by the tasks forked here, use the arena
+ *     }
+ *
+ * The scope applies to the calling thread and to the tasks it spawns on the scheduler, whichever thread runs them (see
+ * TaskLocals in common/task_scheduler.hpp), but not to other computations running concurrently: e.g. an instance
+ * constructed in the background and a proof in the foreground each allocate from their own arena. Polynomials may
+ * outlive both the scope and the arena: their memory returns to the arena if it still exists, and is unmapped
+ * otherwise.
+ *
+ * Allocations smaller than MIN_ALLOCATION_SIZE are served by the slab allocator as before.
+ */
+class PolynomialArena {
+  public:
+    enum class Backing {
+        // Regular pages
+        DEFAULT,
+        // Regular mappings, advised to be backed by transparent huge pages where the kernel supports them
+        TRANSPARENT_HUGE_PAGES,
+        // Explicit huge pages (MAP_HUGETLB), which must have been reserved by the system. Falls back to
+        // TRANSPARENT_HUGE_PAGES when none are available.
+        HUGETLB,
+    };
+
+    struct Options {
+        Backing backing = Backing::TRANSPARENT_HUGE_PAGES;
+        // Fault in the pages of new mappings from all threads, with the same partition of the range as
+        // run_loop_in_parallel, so that on NUMA systems each page is local to the thread that will typically process it
+        bool prefault = false;
+    };
+
+    struct Stats {
+        // Bytes held by live polynomials
+        size_t live_bytes = 0;
+        // High-water mark of live_bytes
+        size_t peak_live_bytes = 0;
+        // Bytes mapped by the arena, i.e. live_bytes plus the freed buffers kept for reuse
+        size_t mapped_bytes = 0;
+        // High-water mark of mapped_bytes
+        size_t peak_mapped_bytes = 0;
+        // Number of allocations served by reusing a freed buffer
+        size_t num_reused = 0;
+        // Number of allocations that required a new mapping
+        size_t num_mapped = 0;
+    };
+
+    static constexpr size_t MIN_ALLOCATION_SIZE = size_t(1) << 16;
+
+    PolynomialArena();
+    explicit PolynomialArena(Options options);
+    PolynomialArena(const PolynomialArena& other) = delete;
+    PolynomialArena(PolynomialArena&& other) = delete;
+    PolynomialArena& operator=(const PolynomialArena& other) = delete;
+    PolynomialArena& operator=(PolynomialArena&& other) = delete;
+    ~PolynomialArena();
+
+    /**
+     * @brief Allocate at least `size` bytes, 32 byte aligned. The memory is freed by the deleter of the result.
+     */
+    std::shared_ptr<void> allocate(size_t size);
+
+    /**
+     * @brief Unmap the freed buffers kept for reuse. Live polynomials are unaffected.
+     */
+    void release();
+
+    Stats get_stats() const;
+
+    /**
+     * @brief The arena of the innermost live Scope of the calling thread or task, if any.
+     */
+    static std::shared_ptr<PolynomialArena> current();
+
+    /**
+     * @brief Makes polynomials draw from `arena` for the lifetime of the scope.
+     */
+    class Scope {
+      public:
+        explicit Scope(std::shared_ptr<PolynomialArena> arena);
+        Scope(const Scope& other) = delete;
+        Scope(Scope&& other) = delete;
+        Scope& operator=(const Scope& other) = delete;
+        Scope& operator=(Scope&& other) = delete;
+        ~Scope();
+
+      private:
+        std::shared_ptr<PolynomialArena> previous_;
+    };
+
+  private:
+    // Shared with the deleters of the allocations, so that they can outlive the arena
+    struct State {
+#ifndef NO_MULTITHREADING
+        std::mutex mutex;
+#endif
+        // Freed buffers by mapped size
+        std::map<size_t, std::vector<void*>> free_buffers;
+        Stats stats;
+        bool destroyed = false;
+
+        void free(void* ptr, size_t mapped_size);
+    };
+
+    size_t mapped_size(size_t size) const;
+    void* map(size_t size);
+    static void unmap(void* ptr, size_t size);
+
+    Options options_;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace bb
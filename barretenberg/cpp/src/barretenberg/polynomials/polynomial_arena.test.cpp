@@ -0,0 +1,163 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
+
+using namespace bb;
+
+class PolynomialArenaTests : public ::testing::Test {
+  protected:
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    static constexpr size_t SIZE = size_t(1) << 12; // 128 KiB of coefficients
+};
+
+// Polynomials constructed in a scope draw from its arena, and their memory is reused once they are freed
+TEST_F(PolynomialArenaTests, ReusesFreedMemory)
+{
+    auto arena = std::make_shared<PolynomialArena>();
+    {
+        PolynomialArena::Scope scope(arena);
+        FF* first_coefficients = nullptr;
+        {
+            auto poly = Polynomial::random(SIZE);
+            first_coefficients = poly.begin();
+            EXPECT_GE(arena->get_stats().live_bytes, SIZE * sizeof(FF));
+        }
+        EXPECT_EQ(arena->get_stats().live_bytes, 0UL);
+
+        // A polynomial of the same size gets the same (zeroed) memory back
+        Polynomial poly(SIZE);
+        EXPECT_EQ(poly.begin(), first_coefficients);
+        for (const auto& coefficient : poly) {
+            EXPECT_EQ(coefficient, FF(0));
+        }
+
+        auto stats = arena->get_stats();
+        EXPECT_EQ(stats.num_mapped, 1UL);
+        EXPECT_EQ(stats.num_reused, 1UL);
+        EXPECT_EQ(stats.live_bytes, stats.mapped_bytes);
+    }
+
+    // Outside of the scope, polynomials are allocated as usual
+    Polynomial poly(SIZE);
+    EXPECT_EQ(arena->get_stats().num_mapped, 1UL);
+    EXPECT_EQ(arena->get_stats().live_bytes, 0UL);
+}
+
+TEST_F(PolynomialArenaTests, Stats)
+{
+    auto arena = std::make_shared<PolynomialArena>();
+    PolynomialArena::Scope scope(arena);
+    {
+        std::vector<Polynomial> polys;
+        for (size_t i = 0; i < 4; ++i) {
+            polys.emplace_back(SIZE);
+        }
+        auto stats = arena->get_stats();
+        EXPECT_EQ(stats.num_mapped, 4UL);
+        EXPECT_EQ(stats.live_bytes, stats.peak_live_bytes);
+        polys.resize(1);
+    }
+    auto stats = arena->get_stats();
+    EXPECT_EQ(stats.live_bytes, 0UL);
+    EXPECT_EQ(stats.mapped_bytes, stats.peak_live_bytes);
+    EXPECT_EQ(stats.peak_mapped_bytes, stats.peak_live_bytes);
+
+    // Releasing the arena unmaps the freed memory
+    arena->release();
+    EXPECT_EQ(arena->get_stats().mapped_bytes, 0UL);
+    EXPECT_EQ(arena->get_stats().peak_live_bytes, stats.peak_live_bytes);
+}
+
+// Small polynomials do not use the arena
+TEST_F(PolynomialArenaTests, SmallPolynomials)
+{
+    auto arena = std::make_shared<PolynomialArena>();
+    PolynomialArena::Scope scope(arena);
+    Polynomial poly(16);
+    EXPECT_EQ(arena->get_stats().num_mapped, 0UL);
+}
+
+// Polynomials remain valid after their arena is destroyed
+TEST_F(PolynomialArenaTests, PolynomialsOutliveArena)
+{
+    Polynomial poly;
+    {
+        auto arena = std::make_shared<PolynomialArena>();
+        PolynomialArena::Scope scope(arena);
+        poly = Polynomial::random(SIZE);
+    }
+    auto copy = Polynomial(poly);
+    EXPECT_EQ(copy, poly);
+}
+
+TEST_F(PolynomialArenaTests, Scopes)
+{
+    EXPECT_EQ(PolynomialArena::current(), nullptr);
+    auto outer = std::make_shared<PolynomialArena>();
+    auto inner = std::make_shared<PolynomialArena>();
+    {
+        PolynomialArena::Scope outer_scope(outer);
+        {
+            PolynomialArena::Scope inner_scope(inner);
+            EXPECT_EQ(PolynomialArena::current(), inner);
+        }
+        EXPECT_EQ(PolynomialArena::current(), outer);
+    }
+    EXPECT_EQ(PolynomialArena::current(), nullptr);
+}
+
+// A scope applies to the tasks forked under it, whichever thread runs them, but not to other threads
+TEST_F(PolynomialArenaTests, ScopesFollowTasks)
+{
+    auto arena = std::make_shared<PolynomialArena>();
+    auto other = std::make_shared<PolynomialArena>();
+    PolynomialArena::Scope scope(arena);
+
+    constexpr size_t num_iterations = 64;
+    std::vector<std::shared_ptr<PolynomialArena>> arenas(num_iterations);
+    parallel_for(num_iterations, [&](size_t i) { arenas[i] = PolynomialArena::current(); });
+    for (const auto& current : arenas) {
+        EXPECT_EQ(current, arena);
+    }
+
+    // Another thread opens and closes a scope of its own while this one is open
+    std::shared_ptr<PolynomialArena> before;
+    std::shared_ptr<PolynomialArena> inside;
+    std::thread thread([&]() {
+        before = PolynomialArena::current();
+        PolynomialArena::Scope other_scope(other);
+        TaskGroup group;
+        group.run([&]() { inside = PolynomialArena::current(); });
+        group.wait();
+    });
+    thread.join();
+    EXPECT_EQ(before, nullptr);
+    EXPECT_EQ(inside, other);
+    EXPECT_EQ(PolynomialArena::current(), arena);
+}
+
+TEST_F(PolynomialArenaTests, Backings)
+{
+    using Backing = PolynomialArena::Backing;
+    // Huge pages may not be available, in which case the arena falls back to regular pages
+    for (auto backing : { Backing::DEFAULT, Backing::TRANSPARENT_HUGE_PAGES, Backing::HUGETLB }) {
+        for (bool prefault : { false, true }) {
+            auto arena = std::make_shared<PolynomialArena>(
+                PolynomialArena::Options{ .backing = backing, .prefault = prefault });
+            PolynomialArena::Scope scope(arena);
+            // Large enough for huge pages
+            Polynomial poly(size_t(1) << 17);
+            for (size_t i = 0; i < poly.size(); ++i) {
+                poly[i] = FF(i);
+            }
+            auto copy = Polynomial(poly);
+            EXPECT_EQ(copy, poly);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(poly.begin()) % 32, 0UL); // NOLINT
+        }
+    }
+}
@@ -270,13 +270,7 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
             if (m != (domain.size >> 1)) {
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                    scratch_space[k1 + j1] += temp;
-                }
+                field_kernels::fft_butterflies(scratch_space, round_roots, m, start, end);
             } else {
                 for (size_t i = start; i < end; ++i) {
                     size_t k1 = (i & index_mask) << 1;
@@ -330,8 +324,6 @@ void fft_inner_parallel(
     // outer FFT loop
     for (size_t m = 2; m < (domain.size); m <<= 1) {
         parallel_for(domain.num_threads, [&](size_t j) {
-            Fr temp;
-
             // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
             // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
             // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
@@ -354,39 +346,16 @@ void fft_inner_parallel(
             // of size x, the first x iterations will index the subgroup elements in order, then for the next x
             // iterations, we loop back to the start.
 
-            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-            const size_t block_mask = m - 1;
-
-            // The next problem to tackle, is we now need to efficiently index the polynomial element in
-            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-            // block_mask)`
-            const size_t index_mask = ~block_mask;
+            // The nested loops over the blocks of the round and over the roots of a block are flattened into a single
+            // loop, whose iteration `i` is the butterfly of the elements (i & ~(m - 1)) * 2 + (i & (m - 1)) and m
+            // further, with the root i & (m - 1) (see field_kernels::fft_butterflies).
 
             // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
             // our indexer, because we don't store the precomputed root values for the 1st round (because they're
             // all 1).
             const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
 
-            // Finally, we want to treat the final round differently from the others,
-            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-            // `scratch_space`
-            for (size_t i = start; i < end; ++i) {
-                size_t k1 = (i & index_mask) << 1;
-                size_t j1 = i & block_mask;
-                temp = round_roots[j1] * target[k1 + j1 + m];
-                target[k1 + j1 + m] = target[k1 + j1] - temp;
-                target[k1 + j1] += temp;
-            }
+            field_kernels::fft_butterflies(target, round_roots, m, start, end);
         });
     }
 }
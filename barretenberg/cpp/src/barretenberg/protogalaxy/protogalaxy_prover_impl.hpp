@@ -79,14 +79,12 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
     next_accumulator->target_sum = next_target_sum;
     next_accumulator->gate_challenges = instances.next_gate_challenges;
 
-    // Initialize accumulator proving key polynomials
+    // Initialize accumulator proving key polynomials. Each polynomial is only folded over its window (see Polynomial),
+    // which is grown to include the windows of the polynomials folded into it.
     auto accumulator_polys = next_accumulator->proving_key.polynomials.get_all();
     run_loop_in_parallel(Flavor::NUM_FOLDED_ENTITIES, [&](size_t start_idx, size_t end_idx) {
         for (size_t poly_idx = start_idx; poly_idx < end_idx; poly_idx++) {
-            auto& acc_poly = accumulator_polys[poly_idx];
-            for (auto& acc_el : acc_poly) {
-                acc_el *= lagranges[0];
-            }
+            accumulator_polys[poly_idx] *= lagranges[0];
         }
     });
 
@@ -96,13 +94,15 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
         run_loop_in_parallel(Flavor::NUM_FOLDED_ENTITIES, [&](size_t start_idx, size_t end_idx) {
             for (size_t poly_idx = start_idx; poly_idx < end_idx; poly_idx++) {
                 auto& acc_poly = accumulator_polys[poly_idx];
-                auto& inst_poly = input_polys[poly_idx];
-                for (auto [acc_el, inst_el] : zip_view(acc_poly, inst_poly)) {
-                    acc_el += inst_el * lagranges[inst_idx];
-                }
+                const auto& inst_poly = input_polys[poly_idx];
+                ASSERT(inst_poly.size() <= acc_poly.size());
+                acc_poly.expand(inst_poly.start_index(), inst_poly.end_index());
+                acc_poly.add_scaled(inst_poly, lagranges[inst_idx]);
             }
         });
     }
+    // Expanding a polynomial reallocates it, so the shifts are taken again
+    next_accumulator->proving_key.polynomials.set_shifted();
 
     // Evaluate the combined batching  α_i univariate at challenge to obtain next α_i and send it to the
     // verifier, where i ∈ {0,...,NUM_SUBRELATIONS - 1}
@@ -185,6 +185,8 @@ template <class ProverInstances>
 FoldingResult<typename ProverInstances::Flavor> ProtoGalaxyProver_<ProverInstances>::fold_instances()
 {
     BB_OP_COUNT_TIME_NAME("ProtogalaxyProver::fold_instances");
+    // The accumulator is instances[0], which the next accumulator is made from
+    PolynomialArena::Scope arena_scope(instances[0]->arena);
     // Ensure instances are all of the same size
     for (size_t idx = 0; idx < ProverInstances::NUM - 1; ++idx) {
         ASSERT(instances[idx]->proving_key.circuit_size == instances[idx + 1]->proving_key.circuit_size);
@@ -1,6 +1,7 @@
 #pragma once
 #include <array>
 #include <tuple>
+#include <utility>
 
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -193,22 +194,24 @@ template <typename FF_> class DatabusLookupRelationImpl {
                                               const size_t circuit_size)
     {
         auto& inverse_polynomial = BusData<bus_idx, Polynomials>::inverses(polynomials);
+        // The selectors and databus columns only store a window of their rows, which reads as zero outside of it
+        const auto& columns = std::as_const(polynomials);
         bool is_read = false;
         bool nonzero_read_count = false;
         for (size_t i = 0; i < circuit_size; ++i) {
             // Determine if the present row contains a databus operation
-            auto& q_busread = polynomials.q_busread[i];
+            const auto& q_busread = columns.q_busread[i];
             if constexpr (bus_idx == 0) { // calldata
-                is_read = q_busread == 1 && polynomials.q_l[i] == 1;
-                nonzero_read_count = polynomials.calldata_read_counts[i] > 0;
+                is_read = q_busread == 1 && columns.q_l[i] == 1;
+                nonzero_read_count = columns.calldata_read_counts[i] > 0;
             }
             if constexpr (bus_idx == 1) { // return data
-                is_read = q_busread == 1 && polynomials.q_r[i] == 1;
-                nonzero_read_count = polynomials.return_data_read_counts[i] > 0;
+                is_read = q_busread == 1 && columns.q_r[i] == 1;
+                nonzero_read_count = columns.return_data_read_counts[i] > 0;
             }
             // We only compute the inverse if this row contains a read gate or data that has been read
             if (is_read || nonzero_read_count) {
-                auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
+                auto row = columns.get_row(i); // Note: this is a copy. use sparingly!
                 inverse_polynomial[i] = compute_read_term<FF>(row, relation_parameters) *
                                         compute_write_term<FF, bus_idx>(row, relation_parameters);
             }
@@ -0,0 +1,195 @@
+#include "mmap_prover_crs.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs::factories {
+
+#ifndef __wasm__
+namespace {
+
+/**
+ * @brief Reads the header of a prepared CRS file and checks it describes at least `num_points` points of `Curve`.
+ * @return An empty string if the file is usable, otherwise a description of why it is not.
+ */
+template <typename Curve> std::string check_prepared_crs(std::string const& path, size_t num_points)
+{
+    using AffineElement = typename Curve::AffineElement;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return "file does not exist";
+    }
+    PreparedCrsHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(PreparedCrsHeader));
+    if (!file) {
+        return "file is too small to hold a header";
+    }
+    if (header.magic != PREPARED_CRS_MAGIC) {
+        return "bad magic";
+    }
+    if (header.version != PREPARED_CRS_VERSION) {
+        return format("unsupported version ", header.version);
+    }
+    if (header.curve_id != prepared_crs_curve_id<Curve>() || header.point_size != sizeof(AffineElement)) {
+        return "file was prepared for a different curve";
+    }
+    if (header.data_offset != PREPARED_CRS_DATA_OFFSET) {
+        return "unexpected data offset";
+    }
+    if (header.num_points < num_points) {
+        return format("file holds ", header.num_points, " points, but ", num_points, " are required");
+    }
+    if (header.num_table_points < scalar_multiplication::point_table_size(header.num_points)) {
+        return "prefetch overflow region is too small for this host";
+    }
+    const auto expected_size = header.data_offset + header.num_table_points * header.point_size;
+    std::error_code ec;
+    const auto file_size = std::filesystem::file_size(path, ec);
+    if (ec || file_size < expected_size) {
+        return "file is truncated";
+    }
+    return "";
+}
+
+} // namespace
+#endif
+
+template <typename Curve>
+void write_prepared_crs(std::string const& path, typename Curve::AffineElement const* points, const size_t num_points)
+{
+    std::vector<typename Curve::AffineElement> point_table(2 * num_points);
+    std::copy(points, points + num_points, point_table.begin());
+    scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.data(), point_table.data(), num_points);
+    write_prepared_crs_point_table<Curve>(path, point_table.data(), num_points);
+}
+
+template <typename Curve>
+void write_prepared_crs_point_table(std::string const& path,
+                                    typename Curve::AffineElement const* point_table,
+                                    const size_t num_points)
+{
+#ifdef __wasm__
+    static_cast<void>(path);
+    static_cast<void>(point_table);
+    static_cast<void>(num_points);
+    throw_or_abort("Prepared crs files are not supported in wasm builds.");
+#else
+    using AffineElement = typename Curve::AffineElement;
+
+    PreparedCrsHeader header{ .magic = PREPARED_CRS_MAGIC,
+                              .version = PREPARED_CRS_VERSION,
+                              .curve_id = prepared_crs_curve_id<Curve>(),
+                              .point_size = sizeof(AffineElement),
+                              .num_points = num_points,
+                              .num_table_points = scalar_multiplication::point_table_size(num_points),
+                              .data_offset = PREPARED_CRS_DATA_OFFSET };
+    std::vector<char> header_page(PREPARED_CRS_DATA_OFFSET, 0);
+    memcpy(header_page.data(), &header, sizeof(PreparedCrsHeader));
+    // Pippenger prefetches points beyond the end of the point table, which must be mapped and zeroed.
+    const std::vector<char> overflow((header.num_table_points - 2 * num_points) * sizeof(AffineElement), 0);
+
+    // Write to a temporary file and rename it into place, so that other processes never map a partial file.
+    const std::string tmp_path = format(path, ".tmp.", std::to_string(getpid()));
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw_or_abort(format("Failed to open prepared crs file for writing: ", tmp_path));
+        }
+        file.write(header_page.data(), static_cast<std::streamsize>(header_page.size()));
+        file.write(reinterpret_cast<const char*>(point_table),
+                   static_cast<std::streamsize>(2 * num_points * sizeof(AffineElement)));
+        file.write(overflow.data(), static_cast<std::streamsize>(overflow.size()));
+        if (!file) {
+            throw_or_abort(format("Failed to write prepared crs file: ", tmp_path));
+        }
+    }
+    std::filesystem::rename(tmp_path, path);
+#endif
+}
+
+template <typename Curve> bool is_prepared_crs_usable(std::string const& path, const size_t num_points)
+{
+#ifdef __wasm__
+    static_cast<void>(path);
+    static_cast<void>(num_points);
+    return false;
+#else
+    return check_prepared_crs<Curve>(path, num_points).empty();
+#endif
+}
+
+template <typename Curve>
+MmapProverCrs<Curve>::MmapProverCrs(std::string const& path, const size_t num_points)
+    : num_points(num_points)
+{
+#ifdef __wasm__
+    static_cast<void>(path);
+    throw_or_abort("MmapProverCrs is not supported in wasm builds.");
+#else
+    const auto error = check_prepared_crs<Curve>(path, num_points);
+    if (!error.empty()) {
+        throw_or_abort(format("Cannot use prepared crs at ", path, ": ", error));
+    }
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort(format("Failed to open prepared crs file: ", path));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw_or_abort(format("Failed to stat prepared crs file: ", path));
+    }
+    mapping_size_ = static_cast<size_t>(st.st_size);
+    // A private writable mapping, so that writes through get_monomial_points() are copied on write rather than
+    // faulting (or reaching the file). Pages that are only read are still shared through the page cache.
+    mapping_ = mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw_or_abort(format("Failed to mmap prepared crs file: ", path));
+    }
+    // The pippenger point table was computed when the file was written, so the points are used as they are
+    monomials_ = reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(mapping_) + PREPARED_CRS_DATA_OFFSET);
+#endif
+}
+
+template <typename Curve> MmapProverCrs<Curve>::~MmapProverCrs()
+{
+#ifndef __wasm__
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mapping_size_);
+    }
+#endif
+}
+
+template void write_prepared_crs<curve::BN254>(std::string const& path,
+                                               curve::BN254::AffineElement const* points,
+                                               size_t num_points);
+template void write_prepared_crs<curve::Grumpkin>(std::string const& path,
+                                                  curve::Grumpkin::AffineElement const* points,
+                                                  size_t num_points);
+template void write_prepared_crs_point_table<curve::BN254>(std::string const& path,
+                                                           curve::BN254::AffineElement const* point_table,
+                                                           size_t num_points);
+template void write_prepared_crs_point_table<curve::Grumpkin>(std::string const& path,
+                                                              curve::Grumpkin::AffineElement const* point_table,
+                                                              size_t num_points);
+template bool is_prepared_crs_usable<curve::BN254>(std::string const& path, size_t num_points);
+template bool is_prepared_crs_usable<curve::Grumpkin>(std::string const& path, size_t num_points);
+template class MmapProverCrs<curve::BN254>;
+template class MmapProverCrs<curve::Grumpkin>;
+
+} // namespace bb::srs::factories
@@ -0,0 +1,103 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "crs_factory.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace bb::srs::factories {
+
+/**
+ * @brief Header of a "prepared" CRS file.
+ *
+ * @details A prepared CRS file holds the monomial points of a CRS after `generate_pippenger_point_table` has been
+ * applied to them, i.e. exactly the in-memory layout consumed by pippenger (Montgomery form, endomorphism points
+ * interleaved). The layout is:
+ *
+ * 0x0000 | PreparedCrsHeader, zero padded to PREPARED_CRS_DATA_OFFSET
+ * 0x1000 | num_table_points affine elements (2 * num_points, followed by a zeroed prefetch overflow region)
+ *
+ * The prefetch overflow region is sized with `point_table_size`, i.e. for the number of threads pippenger uses on the
+ * host that wrote the file.
+ *
+ * The data is page-aligned so that it can be mapped directly into memory and shared between processes through the
+ * page cache. The file is a host-local cache: it is written in native byte order and is regenerated whenever the
+ * header does not match what the current binary expects.
+ */
+struct PreparedCrsHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t curve_id;
+    uint64_t point_size;
+    uint64_t num_points;
+    uint64_t num_table_points;
+    uint64_t data_offset;
+};
+
+constexpr std::array<char, 8> PREPARED_CRS_MAGIC = { 'B', 'B', 'P', 'C', 'R', 'S', '\0', '\0' };
+constexpr uint32_t PREPARED_CRS_VERSION = 1;
+constexpr size_t PREPARED_CRS_DATA_OFFSET = 4096;
+
+template <typename Curve> constexpr uint32_t prepared_crs_curve_id();
+template <> constexpr uint32_t prepared_crs_curve_id<curve::BN254>()
+{
+    return 1;
+}
+template <> constexpr uint32_t prepared_crs_curve_id<curve::Grumpkin>()
+{
+    return 2;
+}
+
+/**
+ * @brief Writes `num_points` monomial points to `path` in the prepared CRS format.
+ * @details The file is written to a temporary location and atomically renamed into place, so concurrent readers only
+ * ever observe complete files.
+ */
+template <typename Curve>
+void write_prepared_crs(std::string const& path, typename Curve::AffineElement const* points, size_t num_points);
+
+/**
+ * @brief As `write_prepared_crs`, but takes an already computed pippenger point table of 2 * num_points points.
+ */
+template <typename Curve>
+void write_prepared_crs_point_table(std::string const& path,
+                                    typename Curve::AffineElement const* point_table,
+                                    size_t num_points);
+
+/**
+ * @brief Returns true if `path` holds a prepared CRS for `Curve` with at least `num_points` points.
+ */
+template <typename Curve> bool is_prepared_crs_usable(std::string const& path, size_t num_points);
+
+/**
+ * @brief A prover CRS backed by a copy-on-write memory mapping of a prepared CRS file.
+ *
+ * @details Construction is O(1): no point is decoded or copied, pages are faulted in lazily by the first MSM that
+ * touches them, and all processes mapping the same file share a single page cache copy. A page that is written to
+ * through the monomial points becomes private to the process, and the file is never modified.
+ */
+template <typename Curve> class MmapProverCrs : public ProverCrs<Curve> {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    MmapProverCrs(std::string const& path, size_t num_points);
+    MmapProverCrs(const MmapProverCrs& other) = delete;
+    MmapProverCrs(MmapProverCrs&& other) = delete;
+    MmapProverCrs& operator=(const MmapProverCrs& other) = delete;
+    MmapProverCrs& operator=(MmapProverCrs&& other) = delete;
+    ~MmapProverCrs() override;
+
+    AffineElement* get_monomial_points() override { return monomials_; }
+
+    [[nodiscard]] size_t get_monomial_size() const override { return num_points; }
+
+  private:
+    size_t num_points;
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    AffineElement* monomials_ = nullptr;
+};
+
+} // namespace bb::srs::factories
@@ -0,0 +1,103 @@
+#include "mmap_prover_crs.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include <filesystem>
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::srs::factories;
+using namespace bb::curve;
+
+namespace {
+template <typename Curve> std::vector<typename Curve::AffineElement> random_points(size_t num_points)
+{
+    std::vector<typename Curve::AffineElement> points(num_points);
+    for (auto& point : points) {
+        point = Curve::AffineElement::random_element();
+    }
+    return points;
+}
+} // namespace
+
+template <typename Curve> class MmapProverCrsTest : public ::testing::Test {
+  protected:
+    // Unique per test, so that concurrent test runs do not share files
+    void SetUp() override
+    {
+        path = std::filesystem::temp_directory_path() /
+               ("mmap_prover_crs_test_" + std::to_string(numeric::get_randomness().get_random_uint64()) + ".dat");
+    }
+    void TearDown() override { std::filesystem::remove(path); }
+
+    std::filesystem::path path;
+};
+
+using Curves = ::testing::Types<BN254, Grumpkin>;
+TYPED_TEST_SUITE(MmapProverCrsTest, Curves);
+
+TYPED_TEST(MmapProverCrsTest, MatchesMemProverCrs)
+{
+    using Curve = TypeParam;
+    const size_t num_points = 1024;
+
+    auto points = random_points<Curve>(num_points);
+    write_prepared_crs<Curve>(this->path, points.data(), num_points);
+
+    EXPECT_TRUE(is_prepared_crs_usable<Curve>(this->path, num_points));
+    EXPECT_TRUE(is_prepared_crs_usable<Curve>(this->path, num_points / 2));
+    EXPECT_FALSE(is_prepared_crs_usable<Curve>(this->path, num_points + 1));
+
+    MemProverCrs<Curve> mem_crs(points);
+    MmapProverCrs<Curve> mmap_crs(this->path, num_points);
+    EXPECT_EQ(mmap_crs.get_monomial_size(), mem_crs.get_monomial_size());
+    EXPECT_EQ(memcmp(mmap_crs.get_monomial_points(),
+                     mem_crs.get_monomial_points(),
+                     sizeof(typename Curve::AffineElement) * num_points * 2),
+              0);
+
+    // The mapped points can be consumed by pippenger directly.
+    std::vector<typename Curve::ScalarField> scalars(num_points);
+    typename Curve::Element expected = Curve::Group::point_at_infinity;
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Curve::ScalarField::random_element();
+        expected += points[i] * scalars[i];
+    }
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    auto result = scalar_multiplication::pippenger_unsafe<Curve>(
+        scalars.data(), mmap_crs.get_monomial_points(), num_points, state);
+    EXPECT_EQ(typename Curve::AffineElement(result), typename Curve::AffineElement(expected));
+}
+
+TYPED_TEST(MmapProverCrsTest, RejectsOtherCurveAndMissingFiles)
+{
+    using Curve = TypeParam;
+    using OtherCurve = std::conditional_t<std::is_same_v<Curve, BN254>, Grumpkin, BN254>;
+    const size_t num_points = 16;
+
+    EXPECT_FALSE(is_prepared_crs_usable<Curve>(this->path, num_points));
+    EXPECT_ANY_THROW(MmapProverCrs<Curve>(this->path, num_points));
+
+    auto points = random_points<OtherCurve>(num_points);
+    write_prepared_crs<OtherCurve>(this->path, points.data(), num_points);
+    EXPECT_FALSE(is_prepared_crs_usable<Curve>(this->path, num_points));
+    EXPECT_ANY_THROW(MmapProverCrs<Curve>(this->path, num_points));
+}
+
+// Writing to the mapped points only changes the copy of the process, not the file
+TYPED_TEST(MmapProverCrsTest, WritesAreCopiedOnWrite)
+{
+    using Curve = TypeParam;
+    const size_t num_points = 16;
+
+    auto points = random_points<Curve>(num_points);
+    write_prepared_crs<Curve>(this->path, points.data(), num_points);
+
+    MmapProverCrs<Curve> mmap_crs(this->path, num_points);
+    const auto first_point = mmap_crs.get_monomial_points()[0];
+    mmap_crs.get_monomial_points()[0] = Curve::AffineElement::random_element();
+    EXPECT_NE(mmap_crs.get_monomial_points()[0], first_point);
+
+    MmapProverCrs<Curve> other_crs(this->path, num_points);
+    EXPECT_EQ(other_crs.get_monomial_points()[0], first_point);
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "../ecc/curves/bn254/bn254.hpp"
 #include "../ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/common/thread.hpp"
 #include <concepts>
 #include <cstdint>
 #include <fstream>
@@ -228,18 +229,24 @@ template <typename Curve> class IO {
             size_t num_elements = elements_size / bytes_per_element;
 
             if (is_little_endian()) {
-                for (size_t i = 0; i < num_elements; ++i) {
-                    elements[i].x.data[0] = __builtin_bswap64(elements[i].x.data[0]);
-                    elements[i].x.data[1] = __builtin_bswap64(elements[i].x.data[1]);
-                    elements[i].x.data[2] = __builtin_bswap64(elements[i].x.data[2]);
-                    elements[i].x.data[3] = __builtin_bswap64(elements[i].x.data[3]);
-                    elements[i].y.data[0] = __builtin_bswap64(elements[i].y.data[0]);
-                    elements[i].y.data[1] = __builtin_bswap64(elements[i].y.data[1]);
-                    elements[i].y.data[2] = __builtin_bswap64(elements[i].y.data[2]);
-                    elements[i].y.data[3] = __builtin_bswap64(elements[i].y.data[3]);
-                    elements[i].x.self_to_montgomery_form();
-                    elements[i].y.self_to_montgomery_form();
-                }
+                // Transcripts hold up to millions of points; decode them in parallel chunks.
+                run_loop_in_parallel(
+                    num_elements,
+                    [elements](size_t start, size_t end) {
+                        for (size_t i = start; i < end; ++i) {
+                            elements[i].x.data[0] = __builtin_bswap64(elements[i].x.data[0]);
+                            elements[i].x.data[1] = __builtin_bswap64(elements[i].x.data[1]);
+                            elements[i].x.data[2] = __builtin_bswap64(elements[i].x.data[2]);
+                            elements[i].x.data[3] = __builtin_bswap64(elements[i].x.data[3]);
+                            elements[i].y.data[0] = __builtin_bswap64(elements[i].y.data[0]);
+                            elements[i].y.data[1] = __builtin_bswap64(elements[i].y.data[1]);
+                            elements[i].y.data[2] = __builtin_bswap64(elements[i].y.data[2]);
+                            elements[i].y.data[3] = __builtin_bswap64(elements[i].y.data[3]);
+                            elements[i].x.self_to_montgomery_form();
+                            elements[i].y.self_to_montgomery_form();
+                        }
+                    },
+                    /*no_multhreading_if_less_or_equal=*/1024);
             }
         } else if constexpr (GivingG2AffineElementType<Curve, AffineElementType>) {
             constexpr size_t bytes_per_element = sizeof(AffineElementType);
@@ -12,6 +12,8 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/batch_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -1040,3 +1042,101 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, FixedBaseMsm)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 2048;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        // include zero and small scalars, whose wnafs have empty rounds
+        scalars[i] = i % 7 == 0 ? Fr(i % 3) : Fr::random_element();
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    const size_t table_size = 2 * num_points * sizeof(AffineElement);
+    // One shift is plain pippenger, a few shifts needs several passes, a large budget gives a single pass.
+    for (const size_t memory_budget : { size_t(0), 3 * table_size, 64 * table_size }) {
+        scalar_multiplication::FixedBaseMsm<Curve> msm(points.get(), num_points, memory_budget);
+        EXPECT_LE(msm.get_table_size_in_bytes(), std::max(memory_budget, table_size));
+
+        for (const size_t num_scalars : { num_points, num_points - 123, size_t(1), size_t(0) }) {
+            scalar_multiplication::pippenger_runtime_state<Curve> state(num_scalars);
+            Element expected =
+                scalar_multiplication::pippenger_unsafe<Curve>(scalars.data(), points.get(), num_scalars, state);
+            Element result = msm.multiply(scalars.data(), num_scalars);
+            EXPECT_EQ(result.normalize(), expected.normalize());
+        }
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, FixedBaseMsmMemoryBudget)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    constexpr size_t num_points = 1024;
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    const size_t table_size = 2 * num_points * sizeof(AffineElement);
+    scalar_multiplication::FixedBaseMsm<Curve> small(points.get(), num_points, table_size);
+    scalar_multiplication::FixedBaseMsm<Curve> large(points.get(), num_points, 64 * table_size);
+
+    // Without extra memory there is nothing to gain over pippenger.
+    EXPECT_EQ(small.get_num_shifts(), 1UL);
+    EXPECT_FALSE(small.is_effective(num_points));
+    // With enough memory, every round gets its own shift, and larger windows pay off.
+    EXPECT_EQ(large.get_num_shifts(), WNAF_SIZE(large.get_bucket_width() + 1));
+    EXPECT_GT(large.get_bucket_width(), small.get_bucket_width());
+    EXPECT_TRUE(large.is_effective(num_points));
+    EXPECT_FALSE(large.is_effective(num_points + 1));
+}
+
+TYPED_TEST(ScalarMultiplicationTests, BatchMsm)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 2048;
+
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+
+    // MSMs of different sizes (so with different windows), including empty and tiny ones, and scalars whose wnafs
+    // have empty rounds.
+    const std::vector<size_t> sizes = { num_points, 1, 0, num_points - 123, 17, 300, num_points, 2 };
+    std::vector<std::vector<Fr>> scalars;
+    for (const size_t size : sizes) {
+        auto& msm_scalars = scalars.emplace_back(size);
+        for (size_t i = 0; i < size; ++i) {
+            msm_scalars[i] = i % 5 == 0 ? Fr(i % 3) : Fr::random_element();
+        }
+    }
+    std::vector<std::span<const Fr>> spans(scalars.begin(), scalars.end());
+
+    auto results = scalar_multiplication::pippenger_batch_unsafe<Curve>(spans, points.get());
+    ASSERT_EQ(results.size(), sizes.size());
+    for (size_t k = 0; k < sizes.size(); ++k) {
+        scalar_multiplication::pippenger_runtime_state<Curve> state(sizes[k]);
+        Element expected =
+            scalar_multiplication::pippenger_unsafe<Curve>(scalars[k].data(), points.get(), sizes[k], state);
+        EXPECT_EQ(results[k].normalize(), expected.normalize());
+    }
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bb::srs {
+
+// Size of a serialized g1 point: x and y, each a big-endian 32 byte integer.
+constexpr size_t SERIALIZED_G1_POINT_SIZE = 64;
+// Number of points decoded per chunk by `stream_g1_points`.
+constexpr size_t STREAMING_CHUNK_NUM_POINTS = 1 << 15;
+// Number of bytes requested from the source per read by `stream_g1_points`.
+constexpr size_t STREAMING_READ_SIZE = 1 << 20;
+
+/**
+ * @brief Decodes `num_points` serialized g1 points, converting them to Montgomery form, in parallel.
+ *
+ * @details Produces the same points as calling `from_buffer<AffineElement>` on each 64 byte slice of `buffer`.
+ * If `expand_point_table` is set, `out` receives the pippenger point table (see `generate_pippenger_point_table`)
+ * instead, and must have room for 2 * num_points points.
+ */
+template <typename Curve>
+void decode_g1_points(const uint8_t* buffer,
+                      typename Curve::AffineElement* out,
+                      size_t num_points,
+                      bool expand_point_table = false)
+{
+    using AffineElement = typename Curve::AffineElement;
+    run_loop_in_parallel(
+        num_points,
+        [&](size_t start, size_t end) {
+            // When expanding, decode the range contiguously at the start of its table slot and expand it in place.
+            AffineElement* range_out = expand_point_table ? out + 2 * start : out + start;
+            for (size_t i = start; i < end; ++i) {
+                range_out[i - start] = AffineElement::serialize_from_buffer(&buffer[i * SERIALIZED_G1_POINT_SIZE],
+                                                                            /* use legacy field order */ true);
+            }
+            if (expand_point_table) {
+                scalar_multiplication::generate_pippenger_point_table<Curve>(range_out, range_out, end - start);
+            }
+        },
+        /*no_multhreading_if_less_or_equal=*/1024);
+}
+
+/**
+ * @brief Reads and decodes `num_points` serialized g1 points from a byte stream, overlapping I/O with decoding.
+ *
+ * @details A reader thread pulls bytes from `read_bytes` into `raw_bytes` while the calling thread decodes every chunk
+ * of STREAMING_CHUNK_NUM_POINTS points as soon as it is complete, using all cores (see `decode_g1_points`). Decoding
+ * (and pippenger point table expansion) therefore proceeds while later bytes are still arriving, and the total time is
+ * bounded by the source rather than by parsing.
+ *
+ * @param read_bytes Reads up to `size` bytes into `dst` and returns the number of bytes read, 0 at end of stream.
+ * @param num_points The number of points to read.
+ * @param raw_bytes Receives the bytes read, e.g. so that a downloaded stream can be cached on disk.
+ * @param out Receives the decoded points, or the pippenger point table if `expand_point_table` is set.
+ * @return The number of points decoded; less than `num_points` if the stream ended early.
+ */
+template <typename Curve>
+size_t stream_g1_points(const std::function<size_t(uint8_t* dst, size_t size)>& read_bytes,
+                        size_t num_points,
+                        std::vector<uint8_t>& raw_bytes,
+                        typename Curve::AffineElement* out,
+                        bool expand_point_table = false)
+{
+    const size_t total_bytes = num_points * SERIALIZED_G1_POINT_SIZE;
+    raw_bytes.resize(total_bytes);
+
+    size_t bytes_read = 0;
+    bool finished = false;
+    // Set by the calling thread if decoding fails, so that the reader stops at its next read.
+    bool stop = false;
+    std::exception_ptr reader_error;
+    std::mutex mutex;
+    std::condition_variable bytes_available;
+
+    const auto read_all = [&]() {
+        try {
+            while (true) {
+                size_t offset = 0;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    offset = bytes_read;
+                    if (stop) {
+                        break;
+                    }
+                }
+                if (offset == total_bytes) {
+                    break;
+                }
+                const size_t size = read_bytes(&raw_bytes[offset], std::min(STREAMING_READ_SIZE, total_bytes - offset));
+                if (size == 0) {
+                    break;
+                }
+                std::unique_lock<std::mutex> lock(mutex);
+                bytes_read += size;
+                bytes_available.notify_one();
+            }
+        } catch (...) {
+            std::unique_lock<std::mutex> lock(mutex);
+            reader_error = std::current_exception();
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        finished = true;
+        bytes_available.notify_one();
+    };
+
+#ifdef NO_MULTITHREADING
+    read_all();
+#else
+    std::thread reader(read_all);
+#endif
+
+    size_t num_decoded = 0;
+    try {
+        while (num_decoded < num_points) {
+            const size_t chunk_end = std::min(num_decoded + STREAMING_CHUNK_NUM_POINTS, num_points);
+            size_t available = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                bytes_available.wait(lock,
+                                     [&] { return finished || bytes_read >= chunk_end * SERIALIZED_G1_POINT_SIZE; });
+                available = std::min(bytes_read / SERIALIZED_G1_POINT_SIZE, chunk_end);
+            }
+            if (available == num_decoded) {
+                // The stream ended before the chunk was complete.
+                break;
+            }
+            auto* chunk_out = expand_point_table ? out + 2 * num_decoded : out + num_decoded;
+            decode_g1_points<Curve>(&raw_bytes[num_decoded * SERIALIZED_G1_POINT_SIZE],
+                                    chunk_out,
+                                    available - num_decoded,
+                                    expand_point_table);
+            num_decoded = available;
+        }
+    } catch (...) {
+        // The reader must be joined before it is destroyed, and it must not keep reading into `raw_bytes`.
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            stop = true;
+        }
+#ifndef NO_MULTITHREADING
+        reader.join();
+#endif
+        throw;
+    }
+
+#ifndef NO_MULTITHREADING
+    reader.join();
+#endif
+    if (reader_error) {
+        std::rethrow_exception(reader_error);
+    }
+    raw_bytes.resize(bytes_read);
+    return num_decoded;
+}
+
+} // namespace bb::srs
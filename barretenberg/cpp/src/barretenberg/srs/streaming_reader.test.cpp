@@ -0,0 +1,78 @@
+#include "streaming_reader.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::curve;
+
+namespace {
+std::vector<uint8_t> serialize_random_points(size_t num_points)
+{
+    std::vector<uint8_t> buffer(num_points * srs::SERIALIZED_G1_POINT_SIZE);
+    for (size_t i = 0; i < num_points; ++i) {
+        BN254::AffineElement::serialize_to_buffer(BN254::AffineElement::random_element(),
+                                                  &buffer[i * srs::SERIALIZED_G1_POINT_SIZE],
+                                                  /* use legacy field order */ true);
+    }
+    return buffer;
+}
+
+// A source that returns the buffer a few bytes at a time, so that reads straddle point and chunk boundaries.
+auto make_source(const std::vector<uint8_t>& buffer, size_t max_read_size)
+{
+    return [&buffer, max_read_size, offset = size_t(0)](uint8_t* dst, size_t size) mutable {
+        size = std::min({ size, max_read_size, buffer.size() - offset });
+        memcpy(dst, &buffer[offset], size);
+        offset += size;
+        return size;
+    };
+}
+} // namespace
+
+TEST(SrsStreamingReader, DecodesSameAsFromBuffer)
+{
+    const size_t num_points = srs::STREAMING_CHUNK_NUM_POINTS + 1000;
+    auto buffer = serialize_random_points(num_points);
+
+    std::vector<uint8_t> raw_bytes;
+    std::vector<BN254::AffineElement> points(num_points);
+    EXPECT_EQ(srs::stream_g1_points<BN254>(make_source(buffer, 1000), num_points, raw_bytes, points.data()),
+              num_points);
+    EXPECT_EQ(raw_bytes, buffer);
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(points[i], from_buffer<BN254::AffineElement>(buffer, i * srs::SERIALIZED_G1_POINT_SIZE));
+    }
+}
+
+TEST(SrsStreamingReader, ExpandsPointTable)
+{
+    const size_t num_points = srs::STREAMING_CHUNK_NUM_POINTS + 1000;
+    auto buffer = serialize_random_points(num_points);
+
+    std::vector<BN254::AffineElement> expected(2 * num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        expected[i] = from_buffer<BN254::AffineElement>(buffer, i * srs::SERIALIZED_G1_POINT_SIZE);
+    }
+    scalar_multiplication::generate_pippenger_point_table<BN254>(expected.data(), expected.data(), num_points);
+
+    std::vector<uint8_t> raw_bytes;
+    std::vector<BN254::AffineElement> point_table(2 * num_points);
+    EXPECT_EQ(srs::stream_g1_points<BN254>(
+                  make_source(buffer, srs::STREAMING_READ_SIZE), num_points, raw_bytes, point_table.data(), true),
+              num_points);
+    EXPECT_EQ(point_table, expected);
+}
+
+TEST(SrsStreamingReader, StopsAtEndOfStream)
+{
+    const size_t num_points = 100;
+    auto buffer = serialize_random_points(num_points);
+    // Drop the last point and a half.
+    buffer.resize(buffer.size() - srs::SERIALIZED_G1_POINT_SIZE * 3 / 2);
+
+    std::vector<uint8_t> raw_bytes;
+    std::vector<BN254::AffineElement> points(num_points);
+    EXPECT_EQ(srs::stream_g1_points<BN254>(make_source(buffer, 7), num_points, raw_bytes, points.data()),
+              num_points - 2);
+    EXPECT_EQ(raw_bytes, buffer);
+}
@@ -339,6 +339,10 @@ class UltraFlavor {
         ProvingKey(const size_t circuit_size, const size_t num_public_inputs)
             : Base(circuit_size, num_public_inputs)
             , polynomials(circuit_size){};
+        // A proving key whose polynomials were allocated by the caller, e.g. as windows over their nonzero rows
+        ProvingKey(const size_t circuit_size, const size_t num_public_inputs, ProverPolynomials&& polynomials)
+            : Base(circuit_size, num_public_inputs)
+            , polynomials(std::move(polynomials)){};
 
         std::vector<uint32_t> memory_read_records;
         std::vector<uint32_t> memory_write_records;
@@ -457,7 +461,7 @@ class UltraFlavor {
             this->pub_inputs_offset = proving_key.pub_inputs_offset;
 
             for (auto [polynomial, commitment] : zip_view(proving_key.polynomials.get_precomputed(), this->get_all())) {
-                commitment = proving_key.commitment_key->commit(polynomial);
+                commitment = proving_key.commitment_key->commit_sparse(polynomial);
             }
         }
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/964): Clean the boilerplate up.
@@ -75,13 +75,14 @@ template <typename Flavor_, size_t NUM_ = 2> struct ProverInstances_ {
     }
 
   private:
-    // Returns a vector containing pointer views to the prover polynomials corresponding to each instance.
+    // Returns a vector containing pointer views to the prover polynomials corresponding to each instance. The views
+    // are const, so that the coefficients outside of the window of a polynomial read as zero.
     auto get_polynomials_views() const
     {
         // As a practical measure, get the first instance's view to deduce the array type
-        std::array<decltype(_data[0]->proving_key.polynomials.get_all()), NUM> views;
+        std::array<decltype(std::as_const(_data[0]->proving_key.polynomials).get_all()), NUM> views;
         for (size_t i = 0; i < NUM; i++) {
-            views[i] = _data[i]->proving_key.polynomials.get_all();
+            views[i] = std::as_const(_data[i]->proving_key.polynomials).get_all();
         }
         return views;
     }
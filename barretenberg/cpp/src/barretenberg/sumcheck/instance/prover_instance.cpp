@@ -30,6 +30,50 @@ template <class Flavor> size_t ProverInstance_<Flavor>::compute_dyadic_size(Circ
     return circuit.get_circuit_subgroup_size(total_num_gates);
 }
 
+template <class Flavor>
+typename Flavor::ProverPolynomials ProverInstance_<Flavor>::allocate_polynomials(Circuit& circuit, bool is_structured)
+{
+    const size_t circuit_size = dyadic_circuit_size;
+    ProverPolynomials polynomials;
+
+    const size_t trace_size = Trace::compute_trace_size(circuit, is_structured);
+    for (auto& wire : polynomials.get_wires()) {
+        wire = Polynomial(circuit_size, 0, trace_size);
+    }
+    for (auto& selector : polynomials.get_selectors()) {
+        selector = Polynomial(circuit_size, 0, trace_size);
+    }
+    polynomials.lagrange_first = Polynomial(circuit_size, 0, 1);
+    polynomials.lagrange_last = Polynomial(circuit_size, circuit_size - 1, circuit_size);
+    // See construct_lookup_table_polynomials
+    for (auto& table : polynomials.get_tables()) {
+        table = Polynomial(circuit_size, circuit_size - circuit.get_tables_size(), circuit_size);
+    }
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        // The ecc op block is the first one of the trace
+        const size_t op_wire_offset = Flavor::has_zero_row ? 1 : 0;
+        const size_t op_wire_end = op_wire_offset + circuit.blocks.ecc_op.size();
+        for (auto& ecc_op_wire : polynomials.get_ecc_op_wires()) {
+            ecc_op_wire = Polynomial(circuit_size, op_wire_offset, op_wire_end);
+        }
+        polynomials.lagrange_ecc_op = Polynomial(circuit_size, op_wire_offset, op_wire_end);
+
+        const size_t calldata_size = circuit.get_calldata().size();
+        const size_t return_data_size = circuit.get_return_data().size();
+        polynomials.calldata = Polynomial(circuit_size, 0, calldata_size);
+        polynomials.calldata_read_counts = Polynomial(circuit_size, 0, calldata_size);
+        polynomials.return_data = Polynomial(circuit_size, 0, return_data_size);
+        polynomials.return_data_read_counts = Polynomial(circuit_size, 0, return_data_size);
+    }
+    for (auto& polynomial : polynomials.get_unshifted()) {
+        if (polynomial.is_empty()) {
+            polynomial = Polynomial(circuit_size);
+        }
+    }
+    polynomials.set_shifted();
+    return polynomials;
+}
+
 /**
  * @brief
  * @details
@@ -66,6 +110,22 @@ void ProverInstance_<Flavor>::construct_databus_polynomials(Circuit& circuit)
     }
 }
 
+template <class Flavor> void ProverInstance_<Flavor>::add_non_trace_active_row_ranges(Circuit& circuit)
+{
+    auto& active_row_ranges = proving_key.active_row_ranges;
+    // lagrange_first and lagrange_last
+    active_row_ranges.emplace_back(0, 1);
+    active_row_ranges.emplace_back(dyadic_circuit_size - 1, dyadic_circuit_size);
+    // The lookup tables and the sorted list polynomials are placed at the end of the trace
+    const size_t lookup_offset = dyadic_circuit_size - circuit.get_tables_size() - circuit.get_lookups_size();
+    active_row_ranges.emplace_back(lookup_offset, dyadic_circuit_size);
+    // The databus columns are placed at the start of the trace
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        const size_t databus_size = std::max(circuit.get_calldata().size(), circuit.get_return_data().size());
+        active_row_ranges.emplace_back(0, databus_size);
+    }
+}
+
 template class ProverInstance_<UltraFlavor>;
 template class ProverInstance_<MegaFlavor>;
 
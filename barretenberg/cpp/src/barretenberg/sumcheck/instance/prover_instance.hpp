@@ -3,6 +3,7 @@
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
 #include "barretenberg/plonk_honk_shared/composer/permutation_lib.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
@@ -41,9 +42,27 @@ template <class Flavor> class ProverInstance_ {
     std::vector<FF> gate_challenges;
     FF target_sum;
 
+    // The memory of the polynomials of the instance and of its proof, released with the instance
+    std::shared_ptr<PolynomialArena> arena = std::make_shared<PolynomialArena>();
+
     ProverInstance_(Circuit& circuit, bool is_structured = false)
     {
         BB_OP_COUNT_TIME_NAME("ProverInstance(Circuit&)");
+        finalize_circuit(circuit, is_structured);
+        construct_from_finalized_circuit(circuit, is_structured);
+    }
+
+    ProverInstance_() = default;
+    ~ProverInstance_() = default;
+
+    /**
+     * @brief Complete the circuit ahead of the construction of its instance
+     * @details This is the only part of the construction that modifies the op queue (shared with the circuits that
+     * follow). So the rest of it, construct_from_finalized_circuit, may run concurrently with the construction of the
+     * next circuit.
+     */
+    static void finalize_circuit(Circuit& circuit, bool is_structured = false)
+    {
         circuit.add_gates_to_ensure_all_polys_are_non_zero();
         circuit.finalize_circuit();
 
@@ -58,6 +77,15 @@ template <class Flavor> class ProverInstance_ {
         if constexpr (IsGoblinFlavor<Flavor>) {
             circuit.op_queue->append_nonzero_ops();
         }
+    }
+
+    /**
+     * @brief Construct the proving key of a circuit that was completed with finalize_circuit
+     */
+    void construct_from_finalized_circuit(Circuit& circuit, bool is_structured = false)
+    {
+        BB_OP_COUNT_TIME_NAME("ProverInstance::construct_from_finalized_circuit");
+        PolynomialArena::Scope arena_scope(arena);
 
         if (is_structured) { // Compute dyadic size based on a structured trace with fixed block size
             dyadic_circuit_size = compute_structured_dyadic_size(circuit);
@@ -65,7 +93,8 @@ template <class Flavor> class ProverInstance_ {
             dyadic_circuit_size = compute_dyadic_size(circuit);
         }
 
-        proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size());
+        proving_key = ProvingKey(
+            dyadic_circuit_size, circuit.public_inputs.size(), allocate_polynomials(circuit, is_structured));
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         Trace::populate(circuit, proving_key, is_structured);
@@ -81,9 +110,12 @@ template <class Flavor> class ProverInstance_ {
 
         construct_lookup_table_polynomials<Flavor>(proving_key.polynomials.get_tables(), circuit, dyadic_circuit_size);
 
+        // Note: must precede the construction of the sorted list polynomials, which adds the tables to the lookup gates
+        add_non_trace_active_row_ranges(circuit);
+
         proving_key.sorted_polynomials = construct_sorted_list_polynomials<Flavor>(circuit, dyadic_circuit_size);
 
-        std::span<FF> public_wires_source = proving_key.polynomials.w_r;
+        const Polynomial& public_wires_source = proving_key.polynomials.w_r;
 
         // Construct the public inputs array
         for (size_t i = 0; i < proving_key.num_public_inputs; ++i) {
@@ -92,9 +124,6 @@ template <class Flavor> class ProverInstance_ {
         }
     }
 
-    ProverInstance_() = default;
-    ~ProverInstance_() = default;
-
   private:
     static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
@@ -112,8 +141,25 @@ template <class Flavor> class ProverInstance_ {
         return builder.get_circuit_subgroup_size(minimum_size);
     }
 
+    /**
+     * @brief Allocate the polynomials of the proving key, each as a window over the rows on which it may be nonzero
+     * (see Polynomial)
+     * @details The wires and selectors cover the trace, the lagrange polynomials their one row, the lookup tables the
+     * end of the trace and, for Goblin, the ecc op wires the ecc op block and the databus columns their data. The
+     * other polynomials are dense.
+     */
+    ProverPolynomials allocate_polynomials(Circuit&, bool is_structured);
+
     void construct_databus_polynomials(Circuit&)
         requires IsGoblinFlavor<Flavor>;
+
+    /**
+     * @brief Add the rows holding data that does not come from the blocks of the execution trace (lagrange
+     * polynomials, lookup tables, sorted lists and databus columns) to the active row ranges of the proving key
+     * @details On the remaining rows, the wires and selectors vanish and every relation contributes zero, provided the
+     * grand products are computed honestly over them.
+     */
+    void add_non_trace_active_row_ranges(Circuit&);
 };
 
 } // namespace bb
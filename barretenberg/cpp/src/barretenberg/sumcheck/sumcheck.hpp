@@ -5,6 +5,9 @@
 #include "barretenberg/transcript/transcript.hpp"
 #include "sumcheck_round.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace bb {
 
 /*! \brief The implementation of the sumcheck Prover for statements of the form \f$\sum_{\vec \ell \in \{0,1\}^d}
@@ -64,6 +67,11 @@ More precisely, it is a table with \f$ 2^{d-1} \f$ rows and \f$ N \f$ columns, s
 (P_j(1,i_1,\ldots, i_{d-1})) - P_j(0, i_1,\ldots, i_{d-1})) \\ = &\ \texttt{full_polynomials}_{2 i,j} + u_0 \cdot
 (\texttt{full_polynomials}_{2i+1,j} - \texttt{full_polynomials}_{2 i,j}) \f}
 
+In practice, this table is not materialized after Round 0: Round 1 reads \p full_polynomials through a \ref
+bb::PartiallyEvaluatedPolynomialsView "view" that computes its rows on access, and the book-keeping table is first
+populated after \f$ u_1 \f$, with \f$ n/4 \f$ rows, in a single allocation. This halves the memory held by sumcheck
+on top of the prover polynomials.
+
 ### Updating Partial Evaluations in Subsequent Rounds
 In Round \f$ i < d-1\f$, \ref partially_evaluate "partially evaluate" updates the first \f$ 2^{d-1 - i} \f$ rows of
 \f$\texttt{partially_evaluated_polynomials}\f$ with the evaluations \f$ P_1(u_0,\ldots, u_i, \vec \ell),\ldots,
@@ -113,6 +121,42 @@ transcript. These operations are taken care of by \ref bb::BaseTranscript "Trans
 ## Output
 The Sumcheck output is specified by \ref bb::SumcheckOutput< Flavor >.
  */
+/**
+ * @brief A read-only view of prover polynomials \f$ P_j \f$ partially evaluated at \f$ u_0 \f$, whose rows are
+ * computed on access: row \f$ i \f$ of column \f$ j \f$ is \f$ P_j(2i) + u_0 \cdot (P_j(2i+1) - P_j(2i)) \f$.
+ */
+template <typename FF> class PartiallyEvaluatedPolynomialsView {
+  public:
+    class Column {
+      public:
+        Column(const Polynomial<FF>& polynomial, const FF& challenge)
+            : polynomial(&polynomial)
+            , challenge(challenge)
+        {}
+        FF operator[](const size_t i) const
+        {
+            // The coefficients outside of the window of the polynomial read as zero
+            const FF& even = (*polynomial)[2 * i];
+            return even + challenge * ((*polynomial)[2 * i + 1] - even);
+        }
+
+      private:
+        const Polynomial<FF>* polynomial;
+        FF challenge;
+    };
+
+    PartiallyEvaluatedPolynomialsView(const auto& polynomials, const FF& challenge)
+    {
+        for (const auto& polynomial : polynomials.get_all()) {
+            columns.emplace_back(polynomial, challenge);
+        }
+    }
+    const std::vector<Column>& get_all() const { return columns; }
+
+  private:
+    std::vector<Column> columns;
+};
+
 template <typename Flavor> class SumcheckProver {
 
   public:
@@ -123,6 +167,7 @@ template <typename Flavor> class SumcheckProver {
     using Transcript = typename Flavor::Transcript;
     using Instance = ProverInstance_<Flavor>;
     using RelationSeparator = typename Flavor::RelationSeparator;
+    using Polynomial = typename Flavor::Polynomial;
 
     /**
      * @brief The size of the hypercube, i.e. \f$ 2^d\f$.
@@ -148,13 +193,13 @@ template <typename Flavor> class SumcheckProver {
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
-        , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , round(multivariate_n){};
 
     /**
      * @brief Compute round univariate, place it in transcript, compute challenge, partially evaluate. Repeat
@@ -162,6 +207,11 @@ template <typename Flavor> class SumcheckProver {
      */
     SumcheckOutput<Flavor> prove(std::shared_ptr<Instance> instance)
     {
+        // The rows outside of the active ranges of a folded instance do not satisfy the relations individually (the
+        // grand products are folded with different challenges), so its edges are all visited.
+        if (!instance->is_accumulator) {
+            round.set_active_row_ranges(instance->proving_key.active_row_ranges);
+        }
         return prove(instance->proving_key.polynomials,
                      instance->relation_parameters,
                      instance->alphas,
@@ -191,18 +241,33 @@ template <typename Flavor> class SumcheckProver {
         std::vector<FF> multivariate_challenge;
         multivariate_challenge.reserve(multivariate_d);
 
-        // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
-        // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns.
+        // In the first round, we compute the first univariate polynomial from the full polynomials.
         auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
         transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
-        round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                  // release memory?        // All but final round
-                                                  // We operate on partially_evaluated_polynomials in place.
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        round.round_size = round.round_size >> 1;
+        round.fold_active_row_ranges();
+        if (multivariate_d == 1) {
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+        } else {
+            // The second round reads the full polynomials partially evaluated on the fly, so that the book-keeping
+            // table #partially_evaluated_polynomials is only populated after the second challenge, with n/4 rows.
+            const PartiallyEvaluatedPolynomialsView<FF> first_evaluations(full_polynomials, round_challenge);
+            round_univariate =
+                round.compute_univariate(first_evaluations, relation_parameters, pow_univariate, alpha);
+            transcript->send_to_verifier("Sumcheck:univariate_1", round_univariate);
+            FF second_challenge = transcript->template get_challenge<FF>("Sumcheck:u_1");
+            multivariate_challenge.emplace_back(second_challenge);
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge, second_challenge);
+            pow_univariate.partially_evaluate(second_challenge);
+            round.round_size = round.round_size >> 1;
+            round.fold_active_row_ranges();
+        }
+        // All but final round
+        // We operate on partially_evaluated_polynomials in place.
+        for (size_t round_idx = 2; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
             round_univariate =
                 round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
@@ -212,6 +277,7 @@ template <typename Flavor> class SumcheckProver {
             partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             pow_univariate.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1;
+            round.fold_active_row_ranges();
         }
 
         // Final round: Extract multivariate evaluations from #partially_evaluated_polynomials and add to transcript
@@ -261,12 +327,50 @@ template <typename Flavor> class SumcheckProver {
      */
     void partially_evaluate(auto& polynomials, size_t round_size, FF round_challenge)
     {
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(polynomials)>, PartiallyEvaluatedMultivariates>) {
+            auto pep_view = partially_evaluated_polynomials.get_all();
+            // after the first round, operate in place on partially_evaluated_polynomials: the i-th coefficient of the
+            // window is written after the coefficients 2i and 2i + 1 are read, and is not read again.
+            parallel_for(pep_view.size(), [&](size_t j) {
+                const Polynomial& poly = pep_view[j];
+                const auto [start, end] = evaluated_window(poly, round_size, 1);
+                Polynomial evaluated = poly.share(0, round_size >> 1, start, end);
+                for (size_t i = start; i < end; ++i) {
+                    evaluated.at(i) = poly[2 * i] + round_challenge * (poly[2 * i + 1] - poly[2 * i]);
+                }
+                pep_view[j] = std::move(evaluated);
+            });
+        } else {
+            const auto& poly_view = std::as_const(polynomials).get_all();
+            allocate_partially_evaluated_polynomials(poly_view, round_size, 1);
+            auto pep_view = partially_evaluated_polynomials.get_all();
+            parallel_for(poly_view.size(), [&](size_t j) {
+                const auto& poly = poly_view[j];
+                for (size_t i = pep_view[j].start_index(); i < pep_view[j].end_index(); ++i) {
+                    pep_view[j].at(i) = poly[2 * i] + round_challenge * (poly[2 * i + 1] - poly[2 * i]);
+                }
+            });
+        }
+    };
+    /**
+     * @brief Evaluate the full polynomials at the first two round challenges \f$ u_0, u_1 \f$ at once, populating the
+     * first \f$ n/4 \f$ rows of #partially_evaluated_polynomials. See \ref
+     * bb::SumcheckProver<Flavor>::partially_evaluate "generic version".
+     *
+     * @param polynomials Honk polynomials at initialization
+     * @param round_size \f$2^{d}\f$
+     */
+    void partially_evaluate(ProverPolynomials& polynomials, size_t round_size, FF first_challenge, FF second_challenge)
+    {
+        const auto& poly_view = std::as_const(polynomials).get_all();
+        allocate_partially_evaluated_polynomials(poly_view, round_size, 2);
         auto pep_view = partially_evaluated_polynomials.get_all();
-        auto poly_view = polynomials.get_all();
-        // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(poly_view.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = poly_view[j][i] + round_challenge * (poly_view[j][i + 1] - poly_view[j][i]);
+            const auto& poly = poly_view[j];
+            for (size_t i = pep_view[j].start_index(); i < pep_view[j].end_index(); ++i) {
+                const FF even = poly[4 * i] + first_challenge * (poly[4 * i + 1] - poly[4 * i]);
+                const FF odd = poly[4 * i + 2] + first_challenge * (poly[4 * i + 3] - poly[4 * i + 2]);
+                pep_view[j].at(i) = even + second_challenge * (odd - even);
             }
         });
     };
@@ -277,14 +381,70 @@ template <typename Flavor> class SumcheckProver {
     template <typename PolynomialT, std::size_t N>
     void partially_evaluate(std::array<PolynomialT, N>& polynomials, size_t round_size, FF round_challenge)
     {
+        allocate_partially_evaluated_polynomials(polynomials, round_size, 1);
         auto pep_view = partially_evaluated_polynomials.get_all();
-        // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(polynomials.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
+            const auto& poly = polynomials[j];
+            for (size_t i = pep_view[j].start_index(); i < pep_view[j].end_index(); ++i) {
+                pep_view[j].at(i) = poly[2 * i] + round_challenge * (poly[2 * i + 1] - poly[2 * i]);
             }
         });
     };
+
+    /**
+     * @brief The window of the evaluations of `polynomial`, of size `round_size`, at `num_challenges` round
+     * challenges, i.e. the rows \f$ i \f$ for which some of the rows it is computed from are in the window of
+     * `polynomial`.
+     */
+    static std::pair<size_t, size_t> evaluated_window(const auto& polynomial,
+                                                      const size_t round_size,
+                                                      const size_t num_challenges)
+    {
+        size_t start = 0;
+        size_t end = round_size;
+        if constexpr (requires { polynomial.start_index(); }) {
+            start = std::min(polynomial.start_index(), round_size);
+            end = std::min(polynomial.end_index(), round_size);
+        }
+        if (start == end) {
+            return { start >> num_challenges, start >> num_challenges };
+        }
+        const size_t mask = (size_t(1) << num_challenges) - 1;
+        return { start >> num_challenges, (end + mask) >> num_challenges };
+    }
+
+    /**
+     * @brief Provides #partially_evaluated_polynomials with storage for the evaluations of `polynomials`, of size
+     * `round_size`, at `num_challenges` round challenges.
+     * @details Each evaluation only stores the window in which the polynomial it is computed from can be nonzero (see
+     * evaluated_window). The windows are consecutive slices of a single allocation, which is not zeroed as the partial
+     * evaluation that follows writes all of their rows.
+     */
+    void allocate_partially_evaluated_polynomials(const auto& polynomials,
+                                                  const size_t round_size,
+                                                  const size_t num_challenges)
+    {
+        auto pep_view = partially_evaluated_polynomials.get_all();
+        const size_t size = round_size >> num_challenges;
+        // The entities that are not evaluated (if `polynomials` is an array of fewer entities) are left empty
+        std::vector<std::pair<size_t, size_t>> windows(pep_view.size());
+        size_t j = 0;
+        for (const auto& polynomial : polynomials) {
+            windows[j++] = evaluated_window(polynomial, round_size, num_challenges);
+        }
+        // Each slice keeps the extra coefficient past its end that every Polynomial has
+        size_t total_size = 0;
+        for (const auto& [start, end] : windows) {
+            total_size += end - start + 1;
+        }
+        Polynomial arena(total_size, DontZeroMemory::FLAG);
+        size_t offset = 0;
+        for (j = 0; j < pep_view.size(); ++j) {
+            const auto [start, end] = windows[j];
+            pep_view[j] = arena.share(offset, size, start, end);
+            offset += end - start + 1;
+        }
+    }
 };
 /*! \brief Implementation of the sumcheck Verifier for statements of the form \f$\sum_{\vec \ell \in \{0,1\}^d}
  pow_{\beta}(\vec \ell) \cdot F \left(P_1(\vec \ell),\ldots, P_N(\vec \ell) \right)  = 0 \f$ for multilinear
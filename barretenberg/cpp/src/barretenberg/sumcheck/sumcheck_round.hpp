@@ -6,6 +6,11 @@
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
 
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <vector>
+
 namespace bb {
 
 /*! \brief Imlementation of the Sumcheck prover round.
@@ -61,6 +66,12 @@ template <typename Flavor> class SumcheckProverRound {
 
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
 
+    /**
+     * @brief Ranges \f$ [start, end) \f$ of rows of the current round's table (with even bounds, sorted and disjoint),
+     * outside of which every edge contributes zero to the round univariate. Empty if every edge is to be visited.
+     */
+    std::vector<std::pair<size_t, size_t>> active_row_ranges;
+
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -69,6 +80,42 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Restrict the first round to the edges that touch the given rows of the execution trace.
+     *
+     * @details Outside of the active rows of a trace (see ProvingKey_::active_row_ranges), the wires, selectors and
+     * tables vanish, the sigma and id polynomials agree and each grand product is multiplied by the same constant on
+     * every row. Each relation then vanishes identically along an edge whose rows (and the row following them, read by
+     * the shifts) are all inactive, so skipping it leaves the round univariate unchanged.
+     *
+     * @param trace_row_ranges Ranges \f$ [start, end) \f$ of active rows of the execution trace, in any order.
+     */
+    void set_active_row_ranges(std::span<const std::pair<size_t, size_t>> trace_row_ranges)
+    {
+        active_row_ranges.clear();
+        for (const auto& [start, end] : trace_row_ranges) {
+            if (start < end) {
+                // The shifted polynomials read row start on the row above it
+                active_row_ranges.emplace_back(start > 0 ? start - 1 : 0, end);
+            }
+        }
+        normalize_active_row_ranges();
+    }
+
+    /**
+     * @brief Update #active_row_ranges after a partial evaluation: row \f$ \ell \f$ of the next table is computed
+     * from the edge \f$ (2\ell, 2\ell + 1) \f$, so it is active if and only if the edge is. Call after halving
+     * #round_size.
+     */
+    void fold_active_row_ranges()
+    {
+        for (auto& [start, end] : active_row_ranges) {
+            start >>= 1;
+            end >>= 1;
+        }
+        normalize_active_row_ranges();
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -140,10 +187,15 @@ template <typename Flavor> class SumcheckProverRound {
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
+        // Only the edges in the active row ranges are visited; these are split evenly between the threads.
+        const std::vector<std::pair<size_t, size_t>> edge_ranges =
+            active_row_ranges.empty() ? std::vector<std::pair<size_t, size_t>>{ { 0, round_size } } : active_row_ranges;
+        size_t num_active_rows = 0;
+        for (const auto& [start, end] : edge_ranges) {
+            num_active_rows += end - start;
+        }
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads_pow2(num_active_rows, min_iterations_per_thread);
 
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -157,21 +209,30 @@ template <typename Flavor> class SumcheckProverRound {
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_polynomial[(edge_idx >> 1) * pow_polynomial.periodicity]);
+            // The active rows of this thread, counted from the start of the first range (an even number of rows each)
+            size_t start = ((thread_idx * num_active_rows / num_threads) >> 1) << 1;
+            size_t end = (((thread_idx + 1) * num_active_rows / num_threads) >> 1) << 1;
+
+            size_t range_offset = 0;
+            for (const auto& [range_start, range_end] : edge_ranges) {
+                const size_t range_size = range_end - range_start;
+                const size_t first_edge = range_start + std::max(start, range_offset) - range_offset;
+                const size_t last_edge = range_start + std::min(end, range_offset + range_size) - range_offset;
+                range_offset += range_size;
+
+                for (size_t edge_idx = first_edge; edge_idx < last_edge; edge_idx += 2) {
+                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+
+                    // Compute the \f$ \ell \f$-th edge's univariate contribution,
+                    // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
+                    // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
+                    // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+                    // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[thread_idx],
+                                                    relation_parameters,
+                                                    pow_polynomial[(edge_idx >> 1) * pow_polynomial.periodicity]);
+                }
             }
         });
 
@@ -263,6 +324,30 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief Widen #active_row_ranges to whole edges within the round, then sort and merge them.
+     */
+    void normalize_active_row_ranges()
+    {
+        for (auto& [start, end] : active_row_ranges) {
+            start = std::min((start >> 1) << 1, round_size);
+            end = std::min(((end + 1) >> 1) << 1, round_size);
+        }
+        std::sort(active_row_ranges.begin(), active_row_ranges.end());
+        std::vector<std::pair<size_t, size_t>> merged_ranges;
+        for (const auto& [start, end] : active_row_ranges) {
+            if (start == end) {
+                continue;
+            }
+            if (!merged_ranges.empty() && start <= merged_ranges.back().second) {
+                merged_ranges.back().second = std::max(merged_ranges.back().second, end);
+            } else {
+                merged_ranges.emplace_back(start, end);
+            }
+        }
+        active_row_ranges = std::move(merged_ranges);
+    }
+
     /**
      * @brief In Round \f$ i \f$, for a given point \f$ \vec \ell \in \{0,1\}^{d-1 - i}\f$, calculate the contribution
      * of each sub-relation to \f$ T^i(X_i) \f$.
@@ -8,6 +8,7 @@
  *
  */
 #include "translator_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/plonk/proof_system/constants.hpp"
@@ -623,18 +624,25 @@ void TranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_ptr<EC
     // We don't care about the last value since we'll recompute it during witness generation anyway
     accumulator_trace.pop_back();
 
-    for (const auto& raw_op : raw_ops) {
-        Fq previous_accumulator = 0;
-        // Pop the last value from accumulator trace and use it as previous accumulator
-        if (!accumulator_trace.empty()) {
-            previous_accumulator = accumulator_trace.back();
-            accumulator_trace.pop_back();
+    // Given the accumulators, the witness values of each operation are independent, so they are computed in parallel,
+    // a block of operations at a time. The gates are then created in order.
+    constexpr size_t BLOCK_SIZE = 1024;
+    std::vector<AccumulationInput> accumulation_steps(std::min(BLOCK_SIZE, raw_ops.size()));
+    for (size_t block_start = 0; block_start < raw_ops.size(); block_start += BLOCK_SIZE) {
+        const size_t block_size = std::min(BLOCK_SIZE, raw_ops.size() - block_start);
+        parallel_for_range(
+            block_size,
+            [&](size_t j) {
+                const size_t i = block_start + j;
+                // The accumulator before operation i, which was pushed to the trace when processing it in reverse
+                const Fq previous_accumulator =
+                    i < accumulator_trace.size() ? accumulator_trace[accumulator_trace.size() - 1 - i] : Fq(0);
+                accumulation_steps[j] = compute_witness_values_for_one_ecc_op(raw_ops[i], previous_accumulator, v, x);
+            },
+            /*grain_size=*/16);
+        for (size_t j = 0; j < block_size; ++j) {
+            create_accumulation_gate(accumulation_steps[j]);
         }
-        // Compute witness values
-        auto one_accumulation_step = compute_witness_values_for_one_ecc_op(raw_op, previous_accumulator, v, x);
-
-        // And put them into the wires
-        create_accumulation_gate(one_accumulation_step);
     }
 }
 bool TranslatorCircuitBuilder::check_circuit()
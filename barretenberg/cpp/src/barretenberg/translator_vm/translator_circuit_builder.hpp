@@ -446,6 +446,16 @@ class TranslatorCircuitBuilder : public CircuitBuilderBase<bb::fr> {
      */
     void feed_ecc_op_queue_into_circuit(std::shared_ptr<ECCOpQueue> ecc_op_queue);
 
+    /**
+     * @brief The number of gates of the circuit fed with `ecc_op_queue`: the zero row and two rows per operation
+     *
+     * @details It does not depend on the challenges, so it is known before the circuit can be built
+     */
+    static size_t compute_num_gates(const std::shared_ptr<ECCOpQueue>& ecc_op_queue)
+    {
+        return 1 + 2 * ecc_op_queue->get_raw_ops().size();
+    }
+
     /**
      * @brief Check the witness satisifies the circuit
      *
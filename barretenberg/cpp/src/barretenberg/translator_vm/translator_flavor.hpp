@@ -132,8 +132,11 @@ class TranslatorFlavor {
 
         inline void compute_lagrange_polynomials(const CircuitBuilder& builder)
         {
-            const size_t mini_circuit_dyadic_size = compute_mini_circuit_dyadic_size(builder);
+            compute_lagrange_polynomials(compute_mini_circuit_dyadic_size(builder));
+        }
 
+        inline void compute_lagrange_polynomials(const size_t mini_circuit_dyadic_size)
+        {
             for (size_t i = 1; i < mini_circuit_dyadic_size - 1; i += 2) {
                 this->lagrange_odd_in_minicircuit[i] = 1;
                 this->lagrange_even_in_minicircuit[i + 1] = 1;
@@ -735,26 +738,39 @@ class TranslatorFlavor {
     };
 
   public:
-    static inline size_t compute_total_num_gates(const CircuitBuilder& builder)
+    static inline size_t compute_total_num_gates(const size_t num_gates)
     {
-        return std::max(builder.num_gates, MINIMUM_MINI_CIRCUIT_SIZE);
+        return std::max(num_gates, MINIMUM_MINI_CIRCUIT_SIZE);
     }
 
-    static inline size_t compute_dyadic_circuit_size(const CircuitBuilder& builder)
+    static inline size_t compute_total_num_gates(const CircuitBuilder& builder)
     {
-        const size_t total_num_gates = compute_total_num_gates(builder);
+        return compute_total_num_gates(builder.num_gates);
+    }
 
+    static inline size_t compute_mini_circuit_dyadic_size(const size_t num_gates)
+    {
         // Next power of 2
-        const size_t mini_circuit_dyadic_size = builder.get_circuit_subgroup_size(total_num_gates);
+        const size_t total_num_gates = compute_total_num_gates(num_gates);
+        const size_t mini_circuit_dyadic_size = 1UL << numeric::get_msb(total_num_gates);
+        return mini_circuit_dyadic_size == total_num_gates ? mini_circuit_dyadic_size : mini_circuit_dyadic_size << 1;
+    }
+
+    static inline size_t compute_mini_circuit_dyadic_size(const CircuitBuilder& builder)
+    {
+        return compute_mini_circuit_dyadic_size(builder.num_gates);
+    }
 
+    static inline size_t compute_dyadic_circuit_size(const size_t num_gates)
+    {
         // The actual circuit size is several times bigger than the trace in the builder, because we use concatenation
         // to bring the degree of relations down, while extending the length.
-        return mini_circuit_dyadic_size * CONCATENATION_GROUP_SIZE;
+        return compute_mini_circuit_dyadic_size(num_gates) * CONCATENATION_GROUP_SIZE;
     }
 
-    static inline size_t compute_mini_circuit_dyadic_size(const CircuitBuilder& builder)
+    static inline size_t compute_dyadic_circuit_size(const CircuitBuilder& builder)
     {
-        return builder.get_circuit_subgroup_size(compute_total_num_gates(builder));
+        return compute_dyadic_circuit_size(builder.num_gates);
     }
 
     /**
@@ -824,9 +840,19 @@ class TranslatorFlavor {
 
         ProvingKey() = default;
         ProvingKey(const CircuitBuilder& builder)
-            : Base(compute_dyadic_circuit_size(builder), 0)
-            , batching_challenge_v(builder.batching_challenge_v)
-            , evaluation_input_x(builder.evaluation_input_x)
+            : ProvingKey(builder.num_gates)
+        {
+            batching_challenge_v = builder.batching_challenge_v;
+            evaluation_input_x = builder.evaluation_input_x;
+        }
+
+        /**
+         * @brief Construct the part of the proving key that only depends on the number of gates, i.e. everything but
+         * the witness and the challenges. As the number of gates is known from the op queue, this can be done before
+         * the circuit is built (see TranslatorCircuitBuilder::compute_num_gates).
+         */
+        explicit ProvingKey(const size_t num_gates)
+            : Base(compute_dyadic_circuit_size(num_gates), 0)
             , polynomials(this->circuit_size)
         {
             // First and last lagrange polynomials (in the full circuit size)
@@ -835,7 +861,7 @@ class TranslatorFlavor {
 
             // Compute polynomials with odd and even indices set to 1 up to the minicircuit margin + lagrange
             // polynomials at second and second to last indices in the minicircuit
-            polynomials.compute_lagrange_polynomials(builder);
+            polynomials.compute_lagrange_polynomials(compute_mini_circuit_dyadic_size(num_gates));
 
             // Compute the numerator for the permutation argument with several repetitions of steps bridging 0 and
             // maximum range constraint compute_extra_range_constraint_numerator();
@@ -21,6 +21,25 @@ TranslatorProver::TranslatorProver(CircuitBuilder& circuit_builder, const std::s
     compute_commitment_key(key->circuit_size);
 }
 
+TranslatorProver::TranslatorProver(CircuitBuilder& circuit_builder,
+                                   const std::shared_ptr<Transcript>& transcript,
+                                   std::shared_ptr<ProvingKey> precomputed_key,
+                                   std::shared_ptr<CommitmentKey> precomputed_commitment_key)
+    : dyadic_circuit_size(Flavor::compute_dyadic_circuit_size(circuit_builder))
+    , mini_circuit_dyadic_size(Flavor::compute_mini_circuit_dyadic_size(circuit_builder))
+    , transcript(transcript)
+    , key(std::move(precomputed_key))
+    , commitment_key(std::move(precomputed_commitment_key))
+{
+    BB_OP_COUNT_TIME();
+
+    ASSERT(key->circuit_size == dyadic_circuit_size);
+    ASSERT(commitment_key->srs->get_monomial_size() >= dyadic_circuit_size);
+    key->batching_challenge_v = circuit_builder.batching_challenge_v;
+    key->evaluation_input_x = circuit_builder.evaluation_input_x;
+    compute_witness(circuit_builder);
+}
+
 /**
  * @brief Compute witness polynomials
  *
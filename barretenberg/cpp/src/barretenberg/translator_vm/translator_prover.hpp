@@ -28,6 +28,14 @@ class TranslatorProver {
     size_t mini_circuit_dyadic_size = 0; // The size of the small circuit that contains non-range constraint relations
 
     explicit TranslatorProver(CircuitBuilder& circuit_builder, const std::shared_ptr<Transcript>& transcript);
+    /**
+     * @brief Construct the prover from a proving key and commitment key that were computed ahead of the circuit, from
+     * its number of gates (see ProvingKey(size_t))
+     */
+    TranslatorProver(CircuitBuilder& circuit_builder,
+                     const std::shared_ptr<Transcript>& transcript,
+                     std::shared_ptr<ProvingKey> precomputed_key,
+                     std::shared_ptr<CommitmentKey> precomputed_commitment_key);
 
     void compute_witness(CircuitBuilder& circuit_builder);
     std::shared_ptr<CommitmentKey> compute_commitment_key(size_t circuit_size);
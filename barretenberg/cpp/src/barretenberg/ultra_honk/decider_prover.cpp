@@ -58,6 +58,7 @@ template <IsUltraFlavor Flavor> HonkProof DeciderProver_<Flavor>::export_proof()
 template <IsUltraFlavor Flavor> HonkProof DeciderProver_<Flavor>::construct_proof()
 {
     BB_OP_COUNT_TIME_NAME("Decider::construct_proof");
+    PolynomialArena::Scope arena_scope(accumulator->arena);
 
     // Run sumcheck subprotocol.
     execute_relation_check_rounds();
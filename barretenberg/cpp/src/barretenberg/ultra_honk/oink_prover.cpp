@@ -65,9 +65,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
 {
     // Commit to the first three wire polynomials of the instance
     // We only commit to the fourth wire polynomial after adding memory recordss
-    witness_commitments.w_l = commitment_key->commit(proving_key.polynomials.w_l);
-    witness_commitments.w_r = commitment_key->commit(proving_key.polynomials.w_r);
-    witness_commitments.w_o = commitment_key->commit(proving_key.polynomials.w_o);
+    auto& polynomials = proving_key.polynomials;
+    auto wire_commitments = commitment_key->commit_batch(RefArray{ polynomials.w_l, polynomials.w_r, polynomials.w_o });
+    witness_commitments.w_l = wire_commitments[0];
+    witness_commitments.w_r = wire_commitments[1];
+    witness_commitments.w_o = wire_commitments[2];
 
     auto wire_comms = witness_commitments.get_wires();
     auto wire_labels = commitment_labels.get_wires();
@@ -77,10 +79,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
 
     if constexpr (IsGoblinFlavor<Flavor>) {
         // Commit to Goblin ECC op wires
-        witness_commitments.ecc_op_wire_1 = commitment_key->commit(proving_key.polynomials.ecc_op_wire_1);
-        witness_commitments.ecc_op_wire_2 = commitment_key->commit(proving_key.polynomials.ecc_op_wire_2);
-        witness_commitments.ecc_op_wire_3 = commitment_key->commit(proving_key.polynomials.ecc_op_wire_3);
-        witness_commitments.ecc_op_wire_4 = commitment_key->commit(proving_key.polynomials.ecc_op_wire_4);
+        witness_commitments.ecc_op_wire_1 = commitment_key->commit_sparse(proving_key.polynomials.ecc_op_wire_1);
+        witness_commitments.ecc_op_wire_2 = commitment_key->commit_sparse(proving_key.polynomials.ecc_op_wire_2);
+        witness_commitments.ecc_op_wire_3 = commitment_key->commit_sparse(proving_key.polynomials.ecc_op_wire_3);
+        witness_commitments.ecc_op_wire_4 = commitment_key->commit_sparse(proving_key.polynomials.ecc_op_wire_4);
 
         auto op_wire_comms = witness_commitments.get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
@@ -89,14 +91,15 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
         }
 
         // Commit to DataBus columns and corresponding read counts
-        witness_commitments.calldata = commitment_key->commit(proving_key.polynomials.calldata);
-        witness_commitments.calldata_read_counts = commitment_key->commit(proving_key.polynomials.calldata_read_counts);
+        witness_commitments.calldata = commitment_key->commit_sparse(proving_key.polynomials.calldata);
+        witness_commitments.calldata_read_counts =
+            commitment_key->commit_sparse(proving_key.polynomials.calldata_read_counts);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata, witness_commitments.calldata);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata_read_counts,
                                      witness_commitments.calldata_read_counts);
-        witness_commitments.return_data = commitment_key->commit(proving_key.polynomials.return_data);
+        witness_commitments.return_data = commitment_key->commit_sparse(proving_key.polynomials.return_data);
         witness_commitments.return_data_read_counts =
-            commitment_key->commit(proving_key.polynomials.return_data_read_counts);
+            commitment_key->commit_sparse(proving_key.polynomials.return_data_read_counts);
         transcript->send_to_verifier(domain_separator + commitment_labels.return_data, witness_commitments.return_data);
         transcript->send_to_verifier(domain_separator + commitment_labels.return_data_read_counts,
                                      witness_commitments.return_data_read_counts);
@@ -120,8 +123,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
         relation_parameters.eta, relation_parameters.eta_two, relation_parameters.eta_three);
     // Commit to the sorted witness-table accumulator and the finalized (i.e. with memory records) fourth wire
     // polynomial
-    witness_commitments.sorted_accum = commitment_key->commit(proving_key.polynomials.sorted_accum);
-    witness_commitments.w_4 = commitment_key->commit(proving_key.polynomials.w_4);
+    auto commitments =
+        commitment_key->commit_batch(RefArray{ proving_key.polynomials.sorted_accum, proving_key.polynomials.w_4 });
+    witness_commitments.sorted_accum = commitments[0];
+    witness_commitments.w_4 = commitments[1];
 
     transcript->send_to_verifier(domain_separator + commitment_labels.sorted_accum, witness_commitments.sorted_accum);
     transcript->send_to_verifier(domain_separator + commitment_labels.w_4, witness_commitments.w_4);
@@ -140,8 +145,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_log_derivative_
         // Compute and commit to the logderivative inverse used in DataBus
         proving_key.compute_logderivative_inverse(relation_parameters);
 
-        witness_commitments.calldata_inverses = commitment_key->commit(proving_key.polynomials.calldata_inverses);
-        witness_commitments.return_data_inverses = commitment_key->commit(proving_key.polynomials.return_data_inverses);
+        witness_commitments.calldata_inverses =
+            commitment_key->commit_sparse(proving_key.polynomials.calldata_inverses);
+        witness_commitments.return_data_inverses =
+            commitment_key->commit_sparse(proving_key.polynomials.return_data_inverses);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata_inverses,
                                      witness_commitments.calldata_inverses);
         transcript->send_to_verifier(domain_separator + commitment_labels.return_data_inverses,
@@ -157,8 +164,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_c
 {
     proving_key.compute_grand_product_polynomials(relation_parameters);
 
-    witness_commitments.z_perm = commitment_key->commit(proving_key.polynomials.z_perm);
-    witness_commitments.z_lookup = commitment_key->commit(proving_key.polynomials.z_lookup);
+    auto commitments =
+        commitment_key->commit_batch(RefArray{ proving_key.polynomials.z_perm, proving_key.polynomials.z_lookup });
+    witness_commitments.z_perm = commitments[0];
+    witness_commitments.z_lookup = commitments[1];
 
     transcript->send_to_verifier(domain_separator + commitment_labels.z_perm, witness_commitments.z_perm);
     transcript->send_to_verifier(domain_separator + commitment_labels.z_lookup, witness_commitments.z_lookup);
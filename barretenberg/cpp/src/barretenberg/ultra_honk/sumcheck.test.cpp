@@ -201,3 +201,80 @@ TEST_F(SumcheckTestsRealCircuit, Ultra)
 
     ASSERT_TRUE(verified);
 }
+
+/**
+ * @brief Check that restricting the Sumcheck Prover to the active rows of a structured trace leaves the proof unchanged
+ *
+ */
+TEST_F(SumcheckTestsRealCircuit, StructuredTraceActiveRows)
+{
+    using Transcript = typename Flavor::Transcript;
+
+    // Create a small circuit, so that most of the structured trace is padding
+    auto builder = UltraCircuitBuilder();
+    FF a = FF::random_element();
+    FF b = FF::random_element();
+    uint32_t a_idx = builder.add_public_variable(a);
+    uint32_t b_idx = builder.add_variable(b);
+    uint32_t c_idx = builder.add_variable(a + b);
+    uint32_t d_idx = builder.add_variable(a * b);
+    for (size_t i = 0; i < 16; i++) {
+        builder.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+        builder.create_mul_gate({ a_idx, b_idx, d_idx, 1, -1, 0 });
+    }
+    size_t ram_id = builder.create_RAM_array(4);
+    for (size_t i = 0; i < 4; ++i) {
+        builder.init_RAM_element(ram_id, i, builder.add_variable(FF(i)));
+    }
+    builder.read_RAM_array(ram_id, builder.add_variable(FF(2)));
+
+    auto instance = std::make_shared<ProverInstance_<Flavor>>(builder, /*is_structured=*/true);
+    auto circuit_size = instance->proving_key.circuit_size;
+    auto log_circuit_size = numeric::get_msb(circuit_size);
+
+    instance->relation_parameters.eta = FF::random_element();
+    instance->relation_parameters.eta_two = FF::random_element();
+    instance->relation_parameters.eta_three = FF::random_element();
+    instance->relation_parameters.beta = FF::random_element();
+    instance->relation_parameters.gamma = FF::random_element();
+    instance->proving_key.compute_sorted_accumulator_polynomials(instance->relation_parameters.eta,
+                                                                 instance->relation_parameters.eta_two,
+                                                                 instance->relation_parameters.eta_three);
+    instance->proving_key.compute_grand_product_polynomials(instance->relation_parameters);
+    for (auto& alpha : instance->alphas) {
+        alpha = FF::random_element();
+    }
+    instance->gate_challenges = std::vector<FF>(log_circuit_size);
+    for (auto& gate_challenge : instance->gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+
+    size_t num_active_rows = 0;
+    for (const auto& [start, end] : instance->proving_key.active_row_ranges) {
+        num_active_rows += end - start;
+    }
+    EXPECT_LT(2 * num_active_rows, circuit_size);
+
+    // Prove over the active rows only
+    auto active_rows_transcript = Transcript::prover_init_empty();
+    auto active_rows_sumcheck = SumcheckProver<Flavor>(circuit_size, active_rows_transcript);
+    auto active_rows_output = active_rows_sumcheck.prove(instance);
+
+    // Prove over all rows
+    auto all_rows_transcript = Transcript::prover_init_empty();
+    auto all_rows_sumcheck = SumcheckProver<Flavor>(circuit_size, all_rows_transcript);
+    auto all_rows_output = all_rows_sumcheck.prove(instance->proving_key.polynomials,
+                                                   instance->relation_parameters,
+                                                   instance->alphas,
+                                                   instance->gate_challenges);
+
+    EXPECT_EQ(active_rows_output.challenge, all_rows_output.challenge);
+    EXPECT_EQ(active_rows_transcript->proof_data, all_rows_transcript->proof_data);
+
+    // The round univariates are consistent, i.e. the skipped edges did not contribute
+    auto verifier_transcript = Transcript::verifier_init_empty(active_rows_transcript);
+    auto sumcheck_verifier = SumcheckVerifier<Flavor>(log_circuit_size, verifier_transcript);
+    auto verifier_output =
+        sumcheck_verifier.verify(instance->relation_parameters, instance->alphas, instance->gate_challenges);
+    EXPECT_TRUE(verifier_output.verified.value());
+}
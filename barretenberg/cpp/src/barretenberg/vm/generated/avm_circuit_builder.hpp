@@ -4,11 +4,10 @@
 #pragma once
 
 #include <vector>
-#ifndef __wasm__
-#include <future>
-#endif
 
+#include "barretenberg/circuit_checker/relation_checker.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
@@ -553,426 +552,440 @@ class AvmCircuitBuilder {
 
     static constexpr size_t num_fixed_columns = 450;
     static constexpr size_t num_polys = 385;
-    std::vector<Row> rows;
 
-    void set_trace(std::vector<Row>&& trace) { rows = std::move(trace); }
-
-    ProverPolynomials compute_polynomials()
+    /**
+     * @brief Take the trace, whose rows are copied field by field into columns (the unshifted prover polynomials) and
+     * then freed.
+     *
+     * @details The trace builders still emit AvmFullRow rows, so the trace is held in memory twice while it is
+     * converted: once as rows and once as columns. Past that, the columns are shared, rather than copied, by
+     * compute_polynomials and thus by the proving key.
+     */
+    void set_trace(std::vector<Row>&& trace)
     {
+        const std::vector<Row> rows = std::move(trace);
+        num_gates = rows.size();
         const auto num_rows = get_circuit_subgroup_size();
-        ProverPolynomials polys;
 
         // Allocate mem for each column
-        for (auto& poly : polys.get_all()) {
-            poly = Polynomial(num_rows);
+        for (auto& column : columns.get_unshifted()) {
+            column = Polynomial(num_rows);
         }
 
-        for (size_t i = 0; i < rows.size(); i++) {
-            polys.main_clk[i] = rows[i].main_clk;
-            polys.main_first[i] = rows[i].main_first;
-            polys.alu_a_hi[i] = rows[i].alu_a_hi;
-            polys.alu_a_lo[i] = rows[i].alu_a_lo;
-            polys.alu_alu_sel[i] = rows[i].alu_alu_sel;
-            polys.alu_b_hi[i] = rows[i].alu_b_hi;
-            polys.alu_b_lo[i] = rows[i].alu_b_lo;
-            polys.alu_borrow[i] = rows[i].alu_borrow;
-            polys.alu_cf[i] = rows[i].alu_cf;
-            polys.alu_clk[i] = rows[i].alu_clk;
-            polys.alu_cmp_rng_ctr[i] = rows[i].alu_cmp_rng_ctr;
-            polys.alu_cmp_sel[i] = rows[i].alu_cmp_sel;
-            polys.alu_div_rng_chk_selector[i] = rows[i].alu_div_rng_chk_selector;
-            polys.alu_div_u16_r0[i] = rows[i].alu_div_u16_r0;
-            polys.alu_div_u16_r1[i] = rows[i].alu_div_u16_r1;
-            polys.alu_div_u16_r2[i] = rows[i].alu_div_u16_r2;
-            polys.alu_div_u16_r3[i] = rows[i].alu_div_u16_r3;
-            polys.alu_div_u16_r4[i] = rows[i].alu_div_u16_r4;
-            polys.alu_div_u16_r5[i] = rows[i].alu_div_u16_r5;
-            polys.alu_div_u16_r6[i] = rows[i].alu_div_u16_r6;
-            polys.alu_div_u16_r7[i] = rows[i].alu_div_u16_r7;
-            polys.alu_divisor_hi[i] = rows[i].alu_divisor_hi;
-            polys.alu_divisor_lo[i] = rows[i].alu_divisor_lo;
-            polys.alu_ff_tag[i] = rows[i].alu_ff_tag;
-            polys.alu_ia[i] = rows[i].alu_ia;
-            polys.alu_ib[i] = rows[i].alu_ib;
-            polys.alu_ic[i] = rows[i].alu_ic;
-            polys.alu_in_tag[i] = rows[i].alu_in_tag;
-            polys.alu_op_add[i] = rows[i].alu_op_add;
-            polys.alu_op_cast[i] = rows[i].alu_op_cast;
-            polys.alu_op_cast_prev[i] = rows[i].alu_op_cast_prev;
-            polys.alu_op_div[i] = rows[i].alu_op_div;
-            polys.alu_op_div_a_lt_b[i] = rows[i].alu_op_div_a_lt_b;
-            polys.alu_op_div_std[i] = rows[i].alu_op_div_std;
-            polys.alu_op_eq[i] = rows[i].alu_op_eq;
-            polys.alu_op_eq_diff_inv[i] = rows[i].alu_op_eq_diff_inv;
-            polys.alu_op_lt[i] = rows[i].alu_op_lt;
-            polys.alu_op_lte[i] = rows[i].alu_op_lte;
-            polys.alu_op_mul[i] = rows[i].alu_op_mul;
-            polys.alu_op_not[i] = rows[i].alu_op_not;
-            polys.alu_op_shl[i] = rows[i].alu_op_shl;
-            polys.alu_op_shr[i] = rows[i].alu_op_shr;
-            polys.alu_op_sub[i] = rows[i].alu_op_sub;
-            polys.alu_p_a_borrow[i] = rows[i].alu_p_a_borrow;
-            polys.alu_p_b_borrow[i] = rows[i].alu_p_b_borrow;
-            polys.alu_p_sub_a_hi[i] = rows[i].alu_p_sub_a_hi;
-            polys.alu_p_sub_a_lo[i] = rows[i].alu_p_sub_a_lo;
-            polys.alu_p_sub_b_hi[i] = rows[i].alu_p_sub_b_hi;
-            polys.alu_p_sub_b_lo[i] = rows[i].alu_p_sub_b_lo;
-            polys.alu_partial_prod_hi[i] = rows[i].alu_partial_prod_hi;
-            polys.alu_partial_prod_lo[i] = rows[i].alu_partial_prod_lo;
-            polys.alu_quotient_hi[i] = rows[i].alu_quotient_hi;
-            polys.alu_quotient_lo[i] = rows[i].alu_quotient_lo;
-            polys.alu_remainder[i] = rows[i].alu_remainder;
-            polys.alu_res_hi[i] = rows[i].alu_res_hi;
-            polys.alu_res_lo[i] = rows[i].alu_res_lo;
-            polys.alu_rng_chk_lookup_selector[i] = rows[i].alu_rng_chk_lookup_selector;
-            polys.alu_rng_chk_sel[i] = rows[i].alu_rng_chk_sel;
-            polys.alu_shift_lt_bit_len[i] = rows[i].alu_shift_lt_bit_len;
-            polys.alu_shift_sel[i] = rows[i].alu_shift_sel;
-            polys.alu_t_sub_s_bits[i] = rows[i].alu_t_sub_s_bits;
-            polys.alu_two_pow_s[i] = rows[i].alu_two_pow_s;
-            polys.alu_two_pow_t_sub_s[i] = rows[i].alu_two_pow_t_sub_s;
-            polys.alu_u128_tag[i] = rows[i].alu_u128_tag;
-            polys.alu_u16_r0[i] = rows[i].alu_u16_r0;
-            polys.alu_u16_r1[i] = rows[i].alu_u16_r1;
-            polys.alu_u16_r10[i] = rows[i].alu_u16_r10;
-            polys.alu_u16_r11[i] = rows[i].alu_u16_r11;
-            polys.alu_u16_r12[i] = rows[i].alu_u16_r12;
-            polys.alu_u16_r13[i] = rows[i].alu_u16_r13;
-            polys.alu_u16_r14[i] = rows[i].alu_u16_r14;
-            polys.alu_u16_r2[i] = rows[i].alu_u16_r2;
-            polys.alu_u16_r3[i] = rows[i].alu_u16_r3;
-            polys.alu_u16_r4[i] = rows[i].alu_u16_r4;
-            polys.alu_u16_r5[i] = rows[i].alu_u16_r5;
-            polys.alu_u16_r6[i] = rows[i].alu_u16_r6;
-            polys.alu_u16_r7[i] = rows[i].alu_u16_r7;
-            polys.alu_u16_r8[i] = rows[i].alu_u16_r8;
-            polys.alu_u16_r9[i] = rows[i].alu_u16_r9;
-            polys.alu_u16_tag[i] = rows[i].alu_u16_tag;
-            polys.alu_u32_tag[i] = rows[i].alu_u32_tag;
-            polys.alu_u64_tag[i] = rows[i].alu_u64_tag;
-            polys.alu_u8_r0[i] = rows[i].alu_u8_r0;
-            polys.alu_u8_r1[i] = rows[i].alu_u8_r1;
-            polys.alu_u8_tag[i] = rows[i].alu_u8_tag;
-            polys.binary_acc_ia[i] = rows[i].binary_acc_ia;
-            polys.binary_acc_ib[i] = rows[i].binary_acc_ib;
-            polys.binary_acc_ic[i] = rows[i].binary_acc_ic;
-            polys.binary_bin_sel[i] = rows[i].binary_bin_sel;
-            polys.binary_clk[i] = rows[i].binary_clk;
-            polys.binary_ia_bytes[i] = rows[i].binary_ia_bytes;
-            polys.binary_ib_bytes[i] = rows[i].binary_ib_bytes;
-            polys.binary_ic_bytes[i] = rows[i].binary_ic_bytes;
-            polys.binary_in_tag[i] = rows[i].binary_in_tag;
-            polys.binary_mem_tag_ctr[i] = rows[i].binary_mem_tag_ctr;
-            polys.binary_mem_tag_ctr_inv[i] = rows[i].binary_mem_tag_ctr_inv;
-            polys.binary_op_id[i] = rows[i].binary_op_id;
-            polys.binary_start[i] = rows[i].binary_start;
-            polys.byte_lookup_bin_sel[i] = rows[i].byte_lookup_bin_sel;
-            polys.byte_lookup_table_byte_lengths[i] = rows[i].byte_lookup_table_byte_lengths;
-            polys.byte_lookup_table_in_tags[i] = rows[i].byte_lookup_table_in_tags;
-            polys.byte_lookup_table_input_a[i] = rows[i].byte_lookup_table_input_a;
-            polys.byte_lookup_table_input_b[i] = rows[i].byte_lookup_table_input_b;
-            polys.byte_lookup_table_op_id[i] = rows[i].byte_lookup_table_op_id;
-            polys.byte_lookup_table_output[i] = rows[i].byte_lookup_table_output;
-            polys.conversion_clk[i] = rows[i].conversion_clk;
-            polys.conversion_input[i] = rows[i].conversion_input;
-            polys.conversion_num_limbs[i] = rows[i].conversion_num_limbs;
-            polys.conversion_radix[i] = rows[i].conversion_radix;
-            polys.conversion_to_radix_le_sel[i] = rows[i].conversion_to_radix_le_sel;
-            polys.gas_da_gas_fixed_table[i] = rows[i].gas_da_gas_fixed_table;
-            polys.gas_gas_cost_sel[i] = rows[i].gas_gas_cost_sel;
-            polys.gas_l2_gas_fixed_table[i] = rows[i].gas_l2_gas_fixed_table;
-            polys.keccakf1600_clk[i] = rows[i].keccakf1600_clk;
-            polys.keccakf1600_input[i] = rows[i].keccakf1600_input;
-            polys.keccakf1600_keccakf1600_sel[i] = rows[i].keccakf1600_keccakf1600_sel;
-            polys.keccakf1600_output[i] = rows[i].keccakf1600_output;
-            polys.kernel_emit_l2_to_l1_msg_write_offset[i] = rows[i].kernel_emit_l2_to_l1_msg_write_offset;
-            polys.kernel_emit_note_hash_write_offset[i] = rows[i].kernel_emit_note_hash_write_offset;
-            polys.kernel_emit_nullifier_write_offset[i] = rows[i].kernel_emit_nullifier_write_offset;
-            polys.kernel_emit_unencrypted_log_write_offset[i] = rows[i].kernel_emit_unencrypted_log_write_offset;
-            polys.kernel_kernel_in_offset[i] = rows[i].kernel_kernel_in_offset;
-            polys.kernel_kernel_inputs[i] = rows[i].kernel_kernel_inputs;
-            polys.kernel_kernel_metadata_out[i] = rows[i].kernel_kernel_metadata_out;
-            polys.kernel_kernel_out_offset[i] = rows[i].kernel_kernel_out_offset;
-            polys.kernel_kernel_side_effect_out[i] = rows[i].kernel_kernel_side_effect_out;
-            polys.kernel_kernel_value_out[i] = rows[i].kernel_kernel_value_out;
-            polys.kernel_l1_to_l2_msg_exists_write_offset[i] = rows[i].kernel_l1_to_l2_msg_exists_write_offset;
-            polys.kernel_note_hash_exist_write_offset[i] = rows[i].kernel_note_hash_exist_write_offset;
-            polys.kernel_nullifier_exists_write_offset[i] = rows[i].kernel_nullifier_exists_write_offset;
-            polys.kernel_nullifier_non_exists_write_offset[i] = rows[i].kernel_nullifier_non_exists_write_offset;
-            polys.kernel_q_public_input_kernel_add_to_table[i] = rows[i].kernel_q_public_input_kernel_add_to_table;
-            polys.kernel_q_public_input_kernel_out_add_to_table[i] =
-                rows[i].kernel_q_public_input_kernel_out_add_to_table;
-            polys.kernel_side_effect_counter[i] = rows[i].kernel_side_effect_counter;
-            polys.kernel_sload_write_offset[i] = rows[i].kernel_sload_write_offset;
-            polys.kernel_sstore_write_offset[i] = rows[i].kernel_sstore_write_offset;
-            polys.main_abs_da_rem_gas_hi[i] = rows[i].main_abs_da_rem_gas_hi;
-            polys.main_abs_da_rem_gas_lo[i] = rows[i].main_abs_da_rem_gas_lo;
-            polys.main_abs_l2_rem_gas_hi[i] = rows[i].main_abs_l2_rem_gas_hi;
-            polys.main_abs_l2_rem_gas_lo[i] = rows[i].main_abs_l2_rem_gas_lo;
-            polys.main_alu_in_tag[i] = rows[i].main_alu_in_tag;
-            polys.main_alu_sel[i] = rows[i].main_alu_sel;
-            polys.main_bin_op_id[i] = rows[i].main_bin_op_id;
-            polys.main_bin_sel[i] = rows[i].main_bin_sel;
-            polys.main_call_ptr[i] = rows[i].main_call_ptr;
-            polys.main_da_gas_op[i] = rows[i].main_da_gas_op;
-            polys.main_da_gas_remaining[i] = rows[i].main_da_gas_remaining;
-            polys.main_da_out_of_gas[i] = rows[i].main_da_out_of_gas;
-            polys.main_gas_cost_active[i] = rows[i].main_gas_cost_active;
-            polys.main_ia[i] = rows[i].main_ia;
-            polys.main_ib[i] = rows[i].main_ib;
-            polys.main_ic[i] = rows[i].main_ic;
-            polys.main_id[i] = rows[i].main_id;
-            polys.main_id_zero[i] = rows[i].main_id_zero;
-            polys.main_ind_a[i] = rows[i].main_ind_a;
-            polys.main_ind_b[i] = rows[i].main_ind_b;
-            polys.main_ind_c[i] = rows[i].main_ind_c;
-            polys.main_ind_d[i] = rows[i].main_ind_d;
-            polys.main_ind_op_a[i] = rows[i].main_ind_op_a;
-            polys.main_ind_op_b[i] = rows[i].main_ind_op_b;
-            polys.main_ind_op_c[i] = rows[i].main_ind_op_c;
-            polys.main_ind_op_d[i] = rows[i].main_ind_op_d;
-            polys.main_internal_return_ptr[i] = rows[i].main_internal_return_ptr;
-            polys.main_inv[i] = rows[i].main_inv;
-            polys.main_l2_gas_op[i] = rows[i].main_l2_gas_op;
-            polys.main_l2_gas_remaining[i] = rows[i].main_l2_gas_remaining;
-            polys.main_l2_out_of_gas[i] = rows[i].main_l2_out_of_gas;
-            polys.main_last[i] = rows[i].main_last;
-            polys.main_mem_idx_a[i] = rows[i].main_mem_idx_a;
-            polys.main_mem_idx_b[i] = rows[i].main_mem_idx_b;
-            polys.main_mem_idx_c[i] = rows[i].main_mem_idx_c;
-            polys.main_mem_idx_d[i] = rows[i].main_mem_idx_d;
-            polys.main_mem_op_a[i] = rows[i].main_mem_op_a;
-            polys.main_mem_op_activate_gas[i] = rows[i].main_mem_op_activate_gas;
-            polys.main_mem_op_b[i] = rows[i].main_mem_op_b;
-            polys.main_mem_op_c[i] = rows[i].main_mem_op_c;
-            polys.main_mem_op_d[i] = rows[i].main_mem_op_d;
-            polys.main_op_err[i] = rows[i].main_op_err;
-            polys.main_opcode_val[i] = rows[i].main_opcode_val;
-            polys.main_pc[i] = rows[i].main_pc;
-            polys.main_q_kernel_lookup[i] = rows[i].main_q_kernel_lookup;
-            polys.main_q_kernel_output_lookup[i] = rows[i].main_q_kernel_output_lookup;
-            polys.main_r_in_tag[i] = rows[i].main_r_in_tag;
-            polys.main_rwa[i] = rows[i].main_rwa;
-            polys.main_rwb[i] = rows[i].main_rwb;
-            polys.main_rwc[i] = rows[i].main_rwc;
-            polys.main_rwd[i] = rows[i].main_rwd;
-            polys.main_sel_cmov[i] = rows[i].main_sel_cmov;
-            polys.main_sel_external_call[i] = rows[i].main_sel_external_call;
-            polys.main_sel_halt[i] = rows[i].main_sel_halt;
-            polys.main_sel_internal_call[i] = rows[i].main_sel_internal_call;
-            polys.main_sel_internal_return[i] = rows[i].main_sel_internal_return;
-            polys.main_sel_jump[i] = rows[i].main_sel_jump;
-            polys.main_sel_jumpi[i] = rows[i].main_sel_jumpi;
-            polys.main_sel_mov[i] = rows[i].main_sel_mov;
-            polys.main_sel_mov_a[i] = rows[i].main_sel_mov_a;
-            polys.main_sel_mov_b[i] = rows[i].main_sel_mov_b;
-            polys.main_sel_op_add[i] = rows[i].main_sel_op_add;
-            polys.main_sel_op_address[i] = rows[i].main_sel_op_address;
-            polys.main_sel_op_and[i] = rows[i].main_sel_op_and;
-            polys.main_sel_op_block_number[i] = rows[i].main_sel_op_block_number;
-            polys.main_sel_op_cast[i] = rows[i].main_sel_op_cast;
-            polys.main_sel_op_chain_id[i] = rows[i].main_sel_op_chain_id;
-            polys.main_sel_op_coinbase[i] = rows[i].main_sel_op_coinbase;
-            polys.main_sel_op_dagasleft[i] = rows[i].main_sel_op_dagasleft;
-            polys.main_sel_op_div[i] = rows[i].main_sel_op_div;
-            polys.main_sel_op_emit_l2_to_l1_msg[i] = rows[i].main_sel_op_emit_l2_to_l1_msg;
-            polys.main_sel_op_emit_note_hash[i] = rows[i].main_sel_op_emit_note_hash;
-            polys.main_sel_op_emit_nullifier[i] = rows[i].main_sel_op_emit_nullifier;
-            polys.main_sel_op_emit_unencrypted_log[i] = rows[i].main_sel_op_emit_unencrypted_log;
-            polys.main_sel_op_eq[i] = rows[i].main_sel_op_eq;
-            polys.main_sel_op_fdiv[i] = rows[i].main_sel_op_fdiv;
-            polys.main_sel_op_fee_per_da_gas[i] = rows[i].main_sel_op_fee_per_da_gas;
-            polys.main_sel_op_fee_per_l2_gas[i] = rows[i].main_sel_op_fee_per_l2_gas;
-            polys.main_sel_op_get_contract_instance[i] = rows[i].main_sel_op_get_contract_instance;
-            polys.main_sel_op_keccak[i] = rows[i].main_sel_op_keccak;
-            polys.main_sel_op_l1_to_l2_msg_exists[i] = rows[i].main_sel_op_l1_to_l2_msg_exists;
-            polys.main_sel_op_l2gasleft[i] = rows[i].main_sel_op_l2gasleft;
-            polys.main_sel_op_lt[i] = rows[i].main_sel_op_lt;
-            polys.main_sel_op_lte[i] = rows[i].main_sel_op_lte;
-            polys.main_sel_op_mul[i] = rows[i].main_sel_op_mul;
-            polys.main_sel_op_not[i] = rows[i].main_sel_op_not;
-            polys.main_sel_op_note_hash_exists[i] = rows[i].main_sel_op_note_hash_exists;
-            polys.main_sel_op_nullifier_exists[i] = rows[i].main_sel_op_nullifier_exists;
-            polys.main_sel_op_or[i] = rows[i].main_sel_op_or;
-            polys.main_sel_op_pedersen[i] = rows[i].main_sel_op_pedersen;
-            polys.main_sel_op_poseidon2[i] = rows[i].main_sel_op_poseidon2;
-            polys.main_sel_op_radix_le[i] = rows[i].main_sel_op_radix_le;
-            polys.main_sel_op_sender[i] = rows[i].main_sel_op_sender;
-            polys.main_sel_op_sha256[i] = rows[i].main_sel_op_sha256;
-            polys.main_sel_op_shl[i] = rows[i].main_sel_op_shl;
-            polys.main_sel_op_shr[i] = rows[i].main_sel_op_shr;
-            polys.main_sel_op_sload[i] = rows[i].main_sel_op_sload;
-            polys.main_sel_op_sstore[i] = rows[i].main_sel_op_sstore;
-            polys.main_sel_op_storage_address[i] = rows[i].main_sel_op_storage_address;
-            polys.main_sel_op_sub[i] = rows[i].main_sel_op_sub;
-            polys.main_sel_op_timestamp[i] = rows[i].main_sel_op_timestamp;
-            polys.main_sel_op_transaction_fee[i] = rows[i].main_sel_op_transaction_fee;
-            polys.main_sel_op_version[i] = rows[i].main_sel_op_version;
-            polys.main_sel_op_xor[i] = rows[i].main_sel_op_xor;
-            polys.main_sel_rng_16[i] = rows[i].main_sel_rng_16;
-            polys.main_sel_rng_8[i] = rows[i].main_sel_rng_8;
-            polys.main_space_id[i] = rows[i].main_space_id;
-            polys.main_table_pow_2[i] = rows[i].main_table_pow_2;
-            polys.main_tag_err[i] = rows[i].main_tag_err;
-            polys.main_w_in_tag[i] = rows[i].main_w_in_tag;
-            polys.mem_addr[i] = rows[i].mem_addr;
-            polys.mem_clk[i] = rows[i].mem_clk;
-            polys.mem_diff_hi[i] = rows[i].mem_diff_hi;
-            polys.mem_diff_lo[i] = rows[i].mem_diff_lo;
-            polys.mem_diff_mid[i] = rows[i].mem_diff_mid;
-            polys.mem_glob_addr[i] = rows[i].mem_glob_addr;
-            polys.mem_ind_op_a[i] = rows[i].mem_ind_op_a;
-            polys.mem_ind_op_b[i] = rows[i].mem_ind_op_b;
-            polys.mem_ind_op_c[i] = rows[i].mem_ind_op_c;
-            polys.mem_ind_op_d[i] = rows[i].mem_ind_op_d;
-            polys.mem_last[i] = rows[i].mem_last;
-            polys.mem_lastAccess[i] = rows[i].mem_lastAccess;
-            polys.mem_mem_sel[i] = rows[i].mem_mem_sel;
-            polys.mem_one_min_inv[i] = rows[i].mem_one_min_inv;
-            polys.mem_op_a[i] = rows[i].mem_op_a;
-            polys.mem_op_b[i] = rows[i].mem_op_b;
-            polys.mem_op_c[i] = rows[i].mem_op_c;
-            polys.mem_op_d[i] = rows[i].mem_op_d;
-            polys.mem_r_in_tag[i] = rows[i].mem_r_in_tag;
-            polys.mem_rng_chk_sel[i] = rows[i].mem_rng_chk_sel;
-            polys.mem_rw[i] = rows[i].mem_rw;
-            polys.mem_sel_cmov[i] = rows[i].mem_sel_cmov;
-            polys.mem_sel_mov_a[i] = rows[i].mem_sel_mov_a;
-            polys.mem_sel_mov_b[i] = rows[i].mem_sel_mov_b;
-            polys.mem_skip_check_tag[i] = rows[i].mem_skip_check_tag;
-            polys.mem_space_id[i] = rows[i].mem_space_id;
-            polys.mem_tag[i] = rows[i].mem_tag;
-            polys.mem_tag_err[i] = rows[i].mem_tag_err;
-            polys.mem_tsp[i] = rows[i].mem_tsp;
-            polys.mem_val[i] = rows[i].mem_val;
-            polys.mem_w_in_tag[i] = rows[i].mem_w_in_tag;
-            polys.pedersen_clk[i] = rows[i].pedersen_clk;
-            polys.pedersen_input[i] = rows[i].pedersen_input;
-            polys.pedersen_output[i] = rows[i].pedersen_output;
-            polys.pedersen_pedersen_sel[i] = rows[i].pedersen_pedersen_sel;
-            polys.poseidon2_clk[i] = rows[i].poseidon2_clk;
-            polys.poseidon2_input[i] = rows[i].poseidon2_input;
-            polys.poseidon2_output[i] = rows[i].poseidon2_output;
-            polys.poseidon2_poseidon_perm_sel[i] = rows[i].poseidon2_poseidon_perm_sel;
-            polys.sha256_clk[i] = rows[i].sha256_clk;
-            polys.sha256_input[i] = rows[i].sha256_input;
-            polys.sha256_output[i] = rows[i].sha256_output;
-            polys.sha256_sha256_compression_sel[i] = rows[i].sha256_sha256_compression_sel;
-            polys.sha256_state[i] = rows[i].sha256_state;
-            polys.lookup_byte_lengths_counts[i] = rows[i].lookup_byte_lengths_counts;
-            polys.lookup_byte_operations_counts[i] = rows[i].lookup_byte_operations_counts;
-            polys.lookup_opcode_gas_counts[i] = rows[i].lookup_opcode_gas_counts;
-            polys.range_check_l2_gas_hi_counts[i] = rows[i].range_check_l2_gas_hi_counts;
-            polys.range_check_l2_gas_lo_counts[i] = rows[i].range_check_l2_gas_lo_counts;
-            polys.range_check_da_gas_hi_counts[i] = rows[i].range_check_da_gas_hi_counts;
-            polys.range_check_da_gas_lo_counts[i] = rows[i].range_check_da_gas_lo_counts;
-            polys.kernel_output_lookup_counts[i] = rows[i].kernel_output_lookup_counts;
-            polys.lookup_into_kernel_counts[i] = rows[i].lookup_into_kernel_counts;
-            polys.incl_main_tag_err_counts[i] = rows[i].incl_main_tag_err_counts;
-            polys.incl_mem_tag_err_counts[i] = rows[i].incl_mem_tag_err_counts;
-            polys.lookup_mem_rng_chk_lo_counts[i] = rows[i].lookup_mem_rng_chk_lo_counts;
-            polys.lookup_mem_rng_chk_mid_counts[i] = rows[i].lookup_mem_rng_chk_mid_counts;
-            polys.lookup_mem_rng_chk_hi_counts[i] = rows[i].lookup_mem_rng_chk_hi_counts;
-            polys.lookup_pow_2_0_counts[i] = rows[i].lookup_pow_2_0_counts;
-            polys.lookup_pow_2_1_counts[i] = rows[i].lookup_pow_2_1_counts;
-            polys.lookup_u8_0_counts[i] = rows[i].lookup_u8_0_counts;
-            polys.lookup_u8_1_counts[i] = rows[i].lookup_u8_1_counts;
-            polys.lookup_u16_0_counts[i] = rows[i].lookup_u16_0_counts;
-            polys.lookup_u16_1_counts[i] = rows[i].lookup_u16_1_counts;
-            polys.lookup_u16_2_counts[i] = rows[i].lookup_u16_2_counts;
-            polys.lookup_u16_3_counts[i] = rows[i].lookup_u16_3_counts;
-            polys.lookup_u16_4_counts[i] = rows[i].lookup_u16_4_counts;
-            polys.lookup_u16_5_counts[i] = rows[i].lookup_u16_5_counts;
-            polys.lookup_u16_6_counts[i] = rows[i].lookup_u16_6_counts;
-            polys.lookup_u16_7_counts[i] = rows[i].lookup_u16_7_counts;
-            polys.lookup_u16_8_counts[i] = rows[i].lookup_u16_8_counts;
-            polys.lookup_u16_9_counts[i] = rows[i].lookup_u16_9_counts;
-            polys.lookup_u16_10_counts[i] = rows[i].lookup_u16_10_counts;
-            polys.lookup_u16_11_counts[i] = rows[i].lookup_u16_11_counts;
-            polys.lookup_u16_12_counts[i] = rows[i].lookup_u16_12_counts;
-            polys.lookup_u16_13_counts[i] = rows[i].lookup_u16_13_counts;
-            polys.lookup_u16_14_counts[i] = rows[i].lookup_u16_14_counts;
-            polys.lookup_div_u16_0_counts[i] = rows[i].lookup_div_u16_0_counts;
-            polys.lookup_div_u16_1_counts[i] = rows[i].lookup_div_u16_1_counts;
-            polys.lookup_div_u16_2_counts[i] = rows[i].lookup_div_u16_2_counts;
-            polys.lookup_div_u16_3_counts[i] = rows[i].lookup_div_u16_3_counts;
-            polys.lookup_div_u16_4_counts[i] = rows[i].lookup_div_u16_4_counts;
-            polys.lookup_div_u16_5_counts[i] = rows[i].lookup_div_u16_5_counts;
-            polys.lookup_div_u16_6_counts[i] = rows[i].lookup_div_u16_6_counts;
-            polys.lookup_div_u16_7_counts[i] = rows[i].lookup_div_u16_7_counts;
+        run_loop_in_parallel(rows.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                columns.main_clk[i] = rows[i].main_clk;
+                columns.main_first[i] = rows[i].main_first;
+                columns.alu_a_hi[i] = rows[i].alu_a_hi;
+                columns.alu_a_lo[i] = rows[i].alu_a_lo;
+                columns.alu_alu_sel[i] = rows[i].alu_alu_sel;
+                columns.alu_b_hi[i] = rows[i].alu_b_hi;
+                columns.alu_b_lo[i] = rows[i].alu_b_lo;
+                columns.alu_borrow[i] = rows[i].alu_borrow;
+                columns.alu_cf[i] = rows[i].alu_cf;
+                columns.alu_clk[i] = rows[i].alu_clk;
+                columns.alu_cmp_rng_ctr[i] = rows[i].alu_cmp_rng_ctr;
+                columns.alu_cmp_sel[i] = rows[i].alu_cmp_sel;
+                columns.alu_div_rng_chk_selector[i] = rows[i].alu_div_rng_chk_selector;
+                columns.alu_div_u16_r0[i] = rows[i].alu_div_u16_r0;
+                columns.alu_div_u16_r1[i] = rows[i].alu_div_u16_r1;
+                columns.alu_div_u16_r2[i] = rows[i].alu_div_u16_r2;
+                columns.alu_div_u16_r3[i] = rows[i].alu_div_u16_r3;
+                columns.alu_div_u16_r4[i] = rows[i].alu_div_u16_r4;
+                columns.alu_div_u16_r5[i] = rows[i].alu_div_u16_r5;
+                columns.alu_div_u16_r6[i] = rows[i].alu_div_u16_r6;
+                columns.alu_div_u16_r7[i] = rows[i].alu_div_u16_r7;
+                columns.alu_divisor_hi[i] = rows[i].alu_divisor_hi;
+                columns.alu_divisor_lo[i] = rows[i].alu_divisor_lo;
+                columns.alu_ff_tag[i] = rows[i].alu_ff_tag;
+                columns.alu_ia[i] = rows[i].alu_ia;
+                columns.alu_ib[i] = rows[i].alu_ib;
+                columns.alu_ic[i] = rows[i].alu_ic;
+                columns.alu_in_tag[i] = rows[i].alu_in_tag;
+                columns.alu_op_add[i] = rows[i].alu_op_add;
+                columns.alu_op_cast[i] = rows[i].alu_op_cast;
+                columns.alu_op_cast_prev[i] = rows[i].alu_op_cast_prev;
+                columns.alu_op_div[i] = rows[i].alu_op_div;
+                columns.alu_op_div_a_lt_b[i] = rows[i].alu_op_div_a_lt_b;
+                columns.alu_op_div_std[i] = rows[i].alu_op_div_std;
+                columns.alu_op_eq[i] = rows[i].alu_op_eq;
+                columns.alu_op_eq_diff_inv[i] = rows[i].alu_op_eq_diff_inv;
+                columns.alu_op_lt[i] = rows[i].alu_op_lt;
+                columns.alu_op_lte[i] = rows[i].alu_op_lte;
+                columns.alu_op_mul[i] = rows[i].alu_op_mul;
+                columns.alu_op_not[i] = rows[i].alu_op_not;
+                columns.alu_op_shl[i] = rows[i].alu_op_shl;
+                columns.alu_op_shr[i] = rows[i].alu_op_shr;
+                columns.alu_op_sub[i] = rows[i].alu_op_sub;
+                columns.alu_p_a_borrow[i] = rows[i].alu_p_a_borrow;
+                columns.alu_p_b_borrow[i] = rows[i].alu_p_b_borrow;
+                columns.alu_p_sub_a_hi[i] = rows[i].alu_p_sub_a_hi;
+                columns.alu_p_sub_a_lo[i] = rows[i].alu_p_sub_a_lo;
+                columns.alu_p_sub_b_hi[i] = rows[i].alu_p_sub_b_hi;
+                columns.alu_p_sub_b_lo[i] = rows[i].alu_p_sub_b_lo;
+                columns.alu_partial_prod_hi[i] = rows[i].alu_partial_prod_hi;
+                columns.alu_partial_prod_lo[i] = rows[i].alu_partial_prod_lo;
+                columns.alu_quotient_hi[i] = rows[i].alu_quotient_hi;
+                columns.alu_quotient_lo[i] = rows[i].alu_quotient_lo;
+                columns.alu_remainder[i] = rows[i].alu_remainder;
+                columns.alu_res_hi[i] = rows[i].alu_res_hi;
+                columns.alu_res_lo[i] = rows[i].alu_res_lo;
+                columns.alu_rng_chk_lookup_selector[i] = rows[i].alu_rng_chk_lookup_selector;
+                columns.alu_rng_chk_sel[i] = rows[i].alu_rng_chk_sel;
+                columns.alu_shift_lt_bit_len[i] = rows[i].alu_shift_lt_bit_len;
+                columns.alu_shift_sel[i] = rows[i].alu_shift_sel;
+                columns.alu_t_sub_s_bits[i] = rows[i].alu_t_sub_s_bits;
+                columns.alu_two_pow_s[i] = rows[i].alu_two_pow_s;
+                columns.alu_two_pow_t_sub_s[i] = rows[i].alu_two_pow_t_sub_s;
+                columns.alu_u128_tag[i] = rows[i].alu_u128_tag;
+                columns.alu_u16_r0[i] = rows[i].alu_u16_r0;
+                columns.alu_u16_r1[i] = rows[i].alu_u16_r1;
+                columns.alu_u16_r10[i] = rows[i].alu_u16_r10;
+                columns.alu_u16_r11[i] = rows[i].alu_u16_r11;
+                columns.alu_u16_r12[i] = rows[i].alu_u16_r12;
+                columns.alu_u16_r13[i] = rows[i].alu_u16_r13;
+                columns.alu_u16_r14[i] = rows[i].alu_u16_r14;
+                columns.alu_u16_r2[i] = rows[i].alu_u16_r2;
+                columns.alu_u16_r3[i] = rows[i].alu_u16_r3;
+                columns.alu_u16_r4[i] = rows[i].alu_u16_r4;
+                columns.alu_u16_r5[i] = rows[i].alu_u16_r5;
+                columns.alu_u16_r6[i] = rows[i].alu_u16_r6;
+                columns.alu_u16_r7[i] = rows[i].alu_u16_r7;
+                columns.alu_u16_r8[i] = rows[i].alu_u16_r8;
+                columns.alu_u16_r9[i] = rows[i].alu_u16_r9;
+                columns.alu_u16_tag[i] = rows[i].alu_u16_tag;
+                columns.alu_u32_tag[i] = rows[i].alu_u32_tag;
+                columns.alu_u64_tag[i] = rows[i].alu_u64_tag;
+                columns.alu_u8_r0[i] = rows[i].alu_u8_r0;
+                columns.alu_u8_r1[i] = rows[i].alu_u8_r1;
+                columns.alu_u8_tag[i] = rows[i].alu_u8_tag;
+                columns.binary_acc_ia[i] = rows[i].binary_acc_ia;
+                columns.binary_acc_ib[i] = rows[i].binary_acc_ib;
+                columns.binary_acc_ic[i] = rows[i].binary_acc_ic;
+                columns.binary_bin_sel[i] = rows[i].binary_bin_sel;
+                columns.binary_clk[i] = rows[i].binary_clk;
+                columns.binary_ia_bytes[i] = rows[i].binary_ia_bytes;
+                columns.binary_ib_bytes[i] = rows[i].binary_ib_bytes;
+                columns.binary_ic_bytes[i] = rows[i].binary_ic_bytes;
+                columns.binary_in_tag[i] = rows[i].binary_in_tag;
+                columns.binary_mem_tag_ctr[i] = rows[i].binary_mem_tag_ctr;
+                columns.binary_mem_tag_ctr_inv[i] = rows[i].binary_mem_tag_ctr_inv;
+                columns.binary_op_id[i] = rows[i].binary_op_id;
+                columns.binary_start[i] = rows[i].binary_start;
+                columns.byte_lookup_bin_sel[i] = rows[i].byte_lookup_bin_sel;
+                columns.byte_lookup_table_byte_lengths[i] = rows[i].byte_lookup_table_byte_lengths;
+                columns.byte_lookup_table_in_tags[i] = rows[i].byte_lookup_table_in_tags;
+                columns.byte_lookup_table_input_a[i] = rows[i].byte_lookup_table_input_a;
+                columns.byte_lookup_table_input_b[i] = rows[i].byte_lookup_table_input_b;
+                columns.byte_lookup_table_op_id[i] = rows[i].byte_lookup_table_op_id;
+                columns.byte_lookup_table_output[i] = rows[i].byte_lookup_table_output;
+                columns.conversion_clk[i] = rows[i].conversion_clk;
+                columns.conversion_input[i] = rows[i].conversion_input;
+                columns.conversion_num_limbs[i] = rows[i].conversion_num_limbs;
+                columns.conversion_radix[i] = rows[i].conversion_radix;
+                columns.conversion_to_radix_le_sel[i] = rows[i].conversion_to_radix_le_sel;
+                columns.gas_da_gas_fixed_table[i] = rows[i].gas_da_gas_fixed_table;
+                columns.gas_gas_cost_sel[i] = rows[i].gas_gas_cost_sel;
+                columns.gas_l2_gas_fixed_table[i] = rows[i].gas_l2_gas_fixed_table;
+                columns.keccakf1600_clk[i] = rows[i].keccakf1600_clk;
+                columns.keccakf1600_input[i] = rows[i].keccakf1600_input;
+                columns.keccakf1600_keccakf1600_sel[i] = rows[i].keccakf1600_keccakf1600_sel;
+                columns.keccakf1600_output[i] = rows[i].keccakf1600_output;
+                columns.kernel_emit_l2_to_l1_msg_write_offset[i] = rows[i].kernel_emit_l2_to_l1_msg_write_offset;
+                columns.kernel_emit_note_hash_write_offset[i] = rows[i].kernel_emit_note_hash_write_offset;
+                columns.kernel_emit_nullifier_write_offset[i] = rows[i].kernel_emit_nullifier_write_offset;
+                columns.kernel_emit_unencrypted_log_write_offset[i] = rows[i].kernel_emit_unencrypted_log_write_offset;
+                columns.kernel_kernel_in_offset[i] = rows[i].kernel_kernel_in_offset;
+                columns.kernel_kernel_inputs[i] = rows[i].kernel_kernel_inputs;
+                columns.kernel_kernel_metadata_out[i] = rows[i].kernel_kernel_metadata_out;
+                columns.kernel_kernel_out_offset[i] = rows[i].kernel_kernel_out_offset;
+                columns.kernel_kernel_side_effect_out[i] = rows[i].kernel_kernel_side_effect_out;
+                columns.kernel_kernel_value_out[i] = rows[i].kernel_kernel_value_out;
+                columns.kernel_l1_to_l2_msg_exists_write_offset[i] = rows[i].kernel_l1_to_l2_msg_exists_write_offset;
+                columns.kernel_note_hash_exist_write_offset[i] = rows[i].kernel_note_hash_exist_write_offset;
+                columns.kernel_nullifier_exists_write_offset[i] = rows[i].kernel_nullifier_exists_write_offset;
+                columns.kernel_nullifier_non_exists_write_offset[i] = rows[i].kernel_nullifier_non_exists_write_offset;
+                columns.kernel_q_public_input_kernel_add_to_table[i] =
+                    rows[i].kernel_q_public_input_kernel_add_to_table;
+                columns.kernel_q_public_input_kernel_out_add_to_table[i] =
+                    rows[i].kernel_q_public_input_kernel_out_add_to_table;
+                columns.kernel_side_effect_counter[i] = rows[i].kernel_side_effect_counter;
+                columns.kernel_sload_write_offset[i] = rows[i].kernel_sload_write_offset;
+                columns.kernel_sstore_write_offset[i] = rows[i].kernel_sstore_write_offset;
+                columns.main_abs_da_rem_gas_hi[i] = rows[i].main_abs_da_rem_gas_hi;
+                columns.main_abs_da_rem_gas_lo[i] = rows[i].main_abs_da_rem_gas_lo;
+                columns.main_abs_l2_rem_gas_hi[i] = rows[i].main_abs_l2_rem_gas_hi;
+                columns.main_abs_l2_rem_gas_lo[i] = rows[i].main_abs_l2_rem_gas_lo;
+                columns.main_alu_in_tag[i] = rows[i].main_alu_in_tag;
+                columns.main_alu_sel[i] = rows[i].main_alu_sel;
+                columns.main_bin_op_id[i] = rows[i].main_bin_op_id;
+                columns.main_bin_sel[i] = rows[i].main_bin_sel;
+                columns.main_call_ptr[i] = rows[i].main_call_ptr;
+                columns.main_da_gas_op[i] = rows[i].main_da_gas_op;
+                columns.main_da_gas_remaining[i] = rows[i].main_da_gas_remaining;
+                columns.main_da_out_of_gas[i] = rows[i].main_da_out_of_gas;
+                columns.main_gas_cost_active[i] = rows[i].main_gas_cost_active;
+                columns.main_ia[i] = rows[i].main_ia;
+                columns.main_ib[i] = rows[i].main_ib;
+                columns.main_ic[i] = rows[i].main_ic;
+                columns.main_id[i] = rows[i].main_id;
+                columns.main_id_zero[i] = rows[i].main_id_zero;
+                columns.main_ind_a[i] = rows[i].main_ind_a;
+                columns.main_ind_b[i] = rows[i].main_ind_b;
+                columns.main_ind_c[i] = rows[i].main_ind_c;
+                columns.main_ind_d[i] = rows[i].main_ind_d;
+                columns.main_ind_op_a[i] = rows[i].main_ind_op_a;
+                columns.main_ind_op_b[i] = rows[i].main_ind_op_b;
+                columns.main_ind_op_c[i] = rows[i].main_ind_op_c;
+                columns.main_ind_op_d[i] = rows[i].main_ind_op_d;
+                columns.main_internal_return_ptr[i] = rows[i].main_internal_return_ptr;
+                columns.main_inv[i] = rows[i].main_inv;
+                columns.main_l2_gas_op[i] = rows[i].main_l2_gas_op;
+                columns.main_l2_gas_remaining[i] = rows[i].main_l2_gas_remaining;
+                columns.main_l2_out_of_gas[i] = rows[i].main_l2_out_of_gas;
+                columns.main_last[i] = rows[i].main_last;
+                columns.main_mem_idx_a[i] = rows[i].main_mem_idx_a;
+                columns.main_mem_idx_b[i] = rows[i].main_mem_idx_b;
+                columns.main_mem_idx_c[i] = rows[i].main_mem_idx_c;
+                columns.main_mem_idx_d[i] = rows[i].main_mem_idx_d;
+                columns.main_mem_op_a[i] = rows[i].main_mem_op_a;
+                columns.main_mem_op_activate_gas[i] = rows[i].main_mem_op_activate_gas;
+                columns.main_mem_op_b[i] = rows[i].main_mem_op_b;
+                columns.main_mem_op_c[i] = rows[i].main_mem_op_c;
+                columns.main_mem_op_d[i] = rows[i].main_mem_op_d;
+                columns.main_op_err[i] = rows[i].main_op_err;
+                columns.main_opcode_val[i] = rows[i].main_opcode_val;
+                columns.main_pc[i] = rows[i].main_pc;
+                columns.main_q_kernel_lookup[i] = rows[i].main_q_kernel_lookup;
+                columns.main_q_kernel_output_lookup[i] = rows[i].main_q_kernel_output_lookup;
+                columns.main_r_in_tag[i] = rows[i].main_r_in_tag;
+                columns.main_rwa[i] = rows[i].main_rwa;
+                columns.main_rwb[i] = rows[i].main_rwb;
+                columns.main_rwc[i] = rows[i].main_rwc;
+                columns.main_rwd[i] = rows[i].main_rwd;
+                columns.main_sel_cmov[i] = rows[i].main_sel_cmov;
+                columns.main_sel_external_call[i] = rows[i].main_sel_external_call;
+                columns.main_sel_halt[i] = rows[i].main_sel_halt;
+                columns.main_sel_internal_call[i] = rows[i].main_sel_internal_call;
+                columns.main_sel_internal_return[i] = rows[i].main_sel_internal_return;
+                columns.main_sel_jump[i] = rows[i].main_sel_jump;
+                columns.main_sel_jumpi[i] = rows[i].main_sel_jumpi;
+                columns.main_sel_mov[i] = rows[i].main_sel_mov;
+                columns.main_sel_mov_a[i] = rows[i].main_sel_mov_a;
+                columns.main_sel_mov_b[i] = rows[i].main_sel_mov_b;
+                columns.main_sel_op_add[i] = rows[i].main_sel_op_add;
+                columns.main_sel_op_address[i] = rows[i].main_sel_op_address;
+                columns.main_sel_op_and[i] = rows[i].main_sel_op_and;
+                columns.main_sel_op_block_number[i] = rows[i].main_sel_op_block_number;
+                columns.main_sel_op_cast[i] = rows[i].main_sel_op_cast;
+                columns.main_sel_op_chain_id[i] = rows[i].main_sel_op_chain_id;
+                columns.main_sel_op_coinbase[i] = rows[i].main_sel_op_coinbase;
+                columns.main_sel_op_dagasleft[i] = rows[i].main_sel_op_dagasleft;
+                columns.main_sel_op_div[i] = rows[i].main_sel_op_div;
+                columns.main_sel_op_emit_l2_to_l1_msg[i] = rows[i].main_sel_op_emit_l2_to_l1_msg;
+                columns.main_sel_op_emit_note_hash[i] = rows[i].main_sel_op_emit_note_hash;
+                columns.main_sel_op_emit_nullifier[i] = rows[i].main_sel_op_emit_nullifier;
+                columns.main_sel_op_emit_unencrypted_log[i] = rows[i].main_sel_op_emit_unencrypted_log;
+                columns.main_sel_op_eq[i] = rows[i].main_sel_op_eq;
+                columns.main_sel_op_fdiv[i] = rows[i].main_sel_op_fdiv;
+                columns.main_sel_op_fee_per_da_gas[i] = rows[i].main_sel_op_fee_per_da_gas;
+                columns.main_sel_op_fee_per_l2_gas[i] = rows[i].main_sel_op_fee_per_l2_gas;
+                columns.main_sel_op_get_contract_instance[i] = rows[i].main_sel_op_get_contract_instance;
+                columns.main_sel_op_keccak[i] = rows[i].main_sel_op_keccak;
+                columns.main_sel_op_l1_to_l2_msg_exists[i] = rows[i].main_sel_op_l1_to_l2_msg_exists;
+                columns.main_sel_op_l2gasleft[i] = rows[i].main_sel_op_l2gasleft;
+                columns.main_sel_op_lt[i] = rows[i].main_sel_op_lt;
+                columns.main_sel_op_lte[i] = rows[i].main_sel_op_lte;
+                columns.main_sel_op_mul[i] = rows[i].main_sel_op_mul;
+                columns.main_sel_op_not[i] = rows[i].main_sel_op_not;
+                columns.main_sel_op_note_hash_exists[i] = rows[i].main_sel_op_note_hash_exists;
+                columns.main_sel_op_nullifier_exists[i] = rows[i].main_sel_op_nullifier_exists;
+                columns.main_sel_op_or[i] = rows[i].main_sel_op_or;
+                columns.main_sel_op_pedersen[i] = rows[i].main_sel_op_pedersen;
+                columns.main_sel_op_poseidon2[i] = rows[i].main_sel_op_poseidon2;
+                columns.main_sel_op_radix_le[i] = rows[i].main_sel_op_radix_le;
+                columns.main_sel_op_sender[i] = rows[i].main_sel_op_sender;
+                columns.main_sel_op_sha256[i] = rows[i].main_sel_op_sha256;
+                columns.main_sel_op_shl[i] = rows[i].main_sel_op_shl;
+                columns.main_sel_op_shr[i] = rows[i].main_sel_op_shr;
+                columns.main_sel_op_sload[i] = rows[i].main_sel_op_sload;
+                columns.main_sel_op_sstore[i] = rows[i].main_sel_op_sstore;
+                columns.main_sel_op_storage_address[i] = rows[i].main_sel_op_storage_address;
+                columns.main_sel_op_sub[i] = rows[i].main_sel_op_sub;
+                columns.main_sel_op_timestamp[i] = rows[i].main_sel_op_timestamp;
+                columns.main_sel_op_transaction_fee[i] = rows[i].main_sel_op_transaction_fee;
+                columns.main_sel_op_version[i] = rows[i].main_sel_op_version;
+                columns.main_sel_op_xor[i] = rows[i].main_sel_op_xor;
+                columns.main_sel_rng_16[i] = rows[i].main_sel_rng_16;
+                columns.main_sel_rng_8[i] = rows[i].main_sel_rng_8;
+                columns.main_space_id[i] = rows[i].main_space_id;
+                columns.main_table_pow_2[i] = rows[i].main_table_pow_2;
+                columns.main_tag_err[i] = rows[i].main_tag_err;
+                columns.main_w_in_tag[i] = rows[i].main_w_in_tag;
+                columns.mem_addr[i] = rows[i].mem_addr;
+                columns.mem_clk[i] = rows[i].mem_clk;
+                columns.mem_diff_hi[i] = rows[i].mem_diff_hi;
+                columns.mem_diff_lo[i] = rows[i].mem_diff_lo;
+                columns.mem_diff_mid[i] = rows[i].mem_diff_mid;
+                columns.mem_glob_addr[i] = rows[i].mem_glob_addr;
+                columns.mem_ind_op_a[i] = rows[i].mem_ind_op_a;
+                columns.mem_ind_op_b[i] = rows[i].mem_ind_op_b;
+                columns.mem_ind_op_c[i] = rows[i].mem_ind_op_c;
+                columns.mem_ind_op_d[i] = rows[i].mem_ind_op_d;
+                columns.mem_last[i] = rows[i].mem_last;
+                columns.mem_lastAccess[i] = rows[i].mem_lastAccess;
+                columns.mem_mem_sel[i] = rows[i].mem_mem_sel;
+                columns.mem_one_min_inv[i] = rows[i].mem_one_min_inv;
+                columns.mem_op_a[i] = rows[i].mem_op_a;
+                columns.mem_op_b[i] = rows[i].mem_op_b;
+                columns.mem_op_c[i] = rows[i].mem_op_c;
+                columns.mem_op_d[i] = rows[i].mem_op_d;
+                columns.mem_r_in_tag[i] = rows[i].mem_r_in_tag;
+                columns.mem_rng_chk_sel[i] = rows[i].mem_rng_chk_sel;
+                columns.mem_rw[i] = rows[i].mem_rw;
+                columns.mem_sel_cmov[i] = rows[i].mem_sel_cmov;
+                columns.mem_sel_mov_a[i] = rows[i].mem_sel_mov_a;
+                columns.mem_sel_mov_b[i] = rows[i].mem_sel_mov_b;
+                columns.mem_skip_check_tag[i] = rows[i].mem_skip_check_tag;
+                columns.mem_space_id[i] = rows[i].mem_space_id;
+                columns.mem_tag[i] = rows[i].mem_tag;
+                columns.mem_tag_err[i] = rows[i].mem_tag_err;
+                columns.mem_tsp[i] = rows[i].mem_tsp;
+                columns.mem_val[i] = rows[i].mem_val;
+                columns.mem_w_in_tag[i] = rows[i].mem_w_in_tag;
+                columns.pedersen_clk[i] = rows[i].pedersen_clk;
+                columns.pedersen_input[i] = rows[i].pedersen_input;
+                columns.pedersen_output[i] = rows[i].pedersen_output;
+                columns.pedersen_pedersen_sel[i] = rows[i].pedersen_pedersen_sel;
+                columns.poseidon2_clk[i] = rows[i].poseidon2_clk;
+                columns.poseidon2_input[i] = rows[i].poseidon2_input;
+                columns.poseidon2_output[i] = rows[i].poseidon2_output;
+                columns.poseidon2_poseidon_perm_sel[i] = rows[i].poseidon2_poseidon_perm_sel;
+                columns.sha256_clk[i] = rows[i].sha256_clk;
+                columns.sha256_input[i] = rows[i].sha256_input;
+                columns.sha256_output[i] = rows[i].sha256_output;
+                columns.sha256_sha256_compression_sel[i] = rows[i].sha256_sha256_compression_sel;
+                columns.sha256_state[i] = rows[i].sha256_state;
+                columns.lookup_byte_lengths_counts[i] = rows[i].lookup_byte_lengths_counts;
+                columns.lookup_byte_operations_counts[i] = rows[i].lookup_byte_operations_counts;
+                columns.lookup_opcode_gas_counts[i] = rows[i].lookup_opcode_gas_counts;
+                columns.range_check_l2_gas_hi_counts[i] = rows[i].range_check_l2_gas_hi_counts;
+                columns.range_check_l2_gas_lo_counts[i] = rows[i].range_check_l2_gas_lo_counts;
+                columns.range_check_da_gas_hi_counts[i] = rows[i].range_check_da_gas_hi_counts;
+                columns.range_check_da_gas_lo_counts[i] = rows[i].range_check_da_gas_lo_counts;
+                columns.kernel_output_lookup_counts[i] = rows[i].kernel_output_lookup_counts;
+                columns.lookup_into_kernel_counts[i] = rows[i].lookup_into_kernel_counts;
+                columns.incl_main_tag_err_counts[i] = rows[i].incl_main_tag_err_counts;
+                columns.incl_mem_tag_err_counts[i] = rows[i].incl_mem_tag_err_counts;
+                columns.lookup_mem_rng_chk_lo_counts[i] = rows[i].lookup_mem_rng_chk_lo_counts;
+                columns.lookup_mem_rng_chk_mid_counts[i] = rows[i].lookup_mem_rng_chk_mid_counts;
+                columns.lookup_mem_rng_chk_hi_counts[i] = rows[i].lookup_mem_rng_chk_hi_counts;
+                columns.lookup_pow_2_0_counts[i] = rows[i].lookup_pow_2_0_counts;
+                columns.lookup_pow_2_1_counts[i] = rows[i].lookup_pow_2_1_counts;
+                columns.lookup_u8_0_counts[i] = rows[i].lookup_u8_0_counts;
+                columns.lookup_u8_1_counts[i] = rows[i].lookup_u8_1_counts;
+                columns.lookup_u16_0_counts[i] = rows[i].lookup_u16_0_counts;
+                columns.lookup_u16_1_counts[i] = rows[i].lookup_u16_1_counts;
+                columns.lookup_u16_2_counts[i] = rows[i].lookup_u16_2_counts;
+                columns.lookup_u16_3_counts[i] = rows[i].lookup_u16_3_counts;
+                columns.lookup_u16_4_counts[i] = rows[i].lookup_u16_4_counts;
+                columns.lookup_u16_5_counts[i] = rows[i].lookup_u16_5_counts;
+                columns.lookup_u16_6_counts[i] = rows[i].lookup_u16_6_counts;
+                columns.lookup_u16_7_counts[i] = rows[i].lookup_u16_7_counts;
+                columns.lookup_u16_8_counts[i] = rows[i].lookup_u16_8_counts;
+                columns.lookup_u16_9_counts[i] = rows[i].lookup_u16_9_counts;
+                columns.lookup_u16_10_counts[i] = rows[i].lookup_u16_10_counts;
+                columns.lookup_u16_11_counts[i] = rows[i].lookup_u16_11_counts;
+                columns.lookup_u16_12_counts[i] = rows[i].lookup_u16_12_counts;
+                columns.lookup_u16_13_counts[i] = rows[i].lookup_u16_13_counts;
+                columns.lookup_u16_14_counts[i] = rows[i].lookup_u16_14_counts;
+                columns.lookup_div_u16_0_counts[i] = rows[i].lookup_div_u16_0_counts;
+                columns.lookup_div_u16_1_counts[i] = rows[i].lookup_div_u16_1_counts;
+                columns.lookup_div_u16_2_counts[i] = rows[i].lookup_div_u16_2_counts;
+                columns.lookup_div_u16_3_counts[i] = rows[i].lookup_div_u16_3_counts;
+                columns.lookup_div_u16_4_counts[i] = rows[i].lookup_div_u16_4_counts;
+                columns.lookup_div_u16_5_counts[i] = rows[i].lookup_div_u16_5_counts;
+                columns.lookup_div_u16_6_counts[i] = rows[i].lookup_div_u16_6_counts;
+                columns.lookup_div_u16_7_counts[i] = rows[i].lookup_div_u16_7_counts;
+            }
+        });
+    }
+
+    /**
+     * @brief The prover polynomials of the trace. They share the memory of its columns, which this does not copy.
+     */
+    ProverPolynomials compute_polynomials()
+    {
+        ProverPolynomials polys;
+        for (auto [poly, column] : zip_view(polys.get_unshifted(), columns.get_unshifted())) {
+            poly = column.share();
         }
 
-        polys.alu_a_hi_shift = Polynomial(polys.alu_a_hi.shifted());
-        polys.alu_a_lo_shift = Polynomial(polys.alu_a_lo.shifted());
-        polys.alu_alu_sel_shift = Polynomial(polys.alu_alu_sel.shifted());
-        polys.alu_b_hi_shift = Polynomial(polys.alu_b_hi.shifted());
-        polys.alu_b_lo_shift = Polynomial(polys.alu_b_lo.shifted());
-        polys.alu_cmp_rng_ctr_shift = Polynomial(polys.alu_cmp_rng_ctr.shifted());
-        polys.alu_cmp_sel_shift = Polynomial(polys.alu_cmp_sel.shifted());
-        polys.alu_div_rng_chk_selector_shift = Polynomial(polys.alu_div_rng_chk_selector.shifted());
-        polys.alu_div_u16_r0_shift = Polynomial(polys.alu_div_u16_r0.shifted());
-        polys.alu_div_u16_r1_shift = Polynomial(polys.alu_div_u16_r1.shifted());
-        polys.alu_div_u16_r2_shift = Polynomial(polys.alu_div_u16_r2.shifted());
-        polys.alu_div_u16_r3_shift = Polynomial(polys.alu_div_u16_r3.shifted());
-        polys.alu_div_u16_r4_shift = Polynomial(polys.alu_div_u16_r4.shifted());
-        polys.alu_div_u16_r5_shift = Polynomial(polys.alu_div_u16_r5.shifted());
-        polys.alu_div_u16_r6_shift = Polynomial(polys.alu_div_u16_r6.shifted());
-        polys.alu_div_u16_r7_shift = Polynomial(polys.alu_div_u16_r7.shifted());
-        polys.alu_op_add_shift = Polynomial(polys.alu_op_add.shifted());
-        polys.alu_op_cast_prev_shift = Polynomial(polys.alu_op_cast_prev.shifted());
-        polys.alu_op_cast_shift = Polynomial(polys.alu_op_cast.shifted());
-        polys.alu_op_div_shift = Polynomial(polys.alu_op_div.shifted());
-        polys.alu_op_mul_shift = Polynomial(polys.alu_op_mul.shifted());
-        polys.alu_op_shl_shift = Polynomial(polys.alu_op_shl.shifted());
-        polys.alu_op_shr_shift = Polynomial(polys.alu_op_shr.shifted());
-        polys.alu_op_sub_shift = Polynomial(polys.alu_op_sub.shifted());
-        polys.alu_p_sub_a_hi_shift = Polynomial(polys.alu_p_sub_a_hi.shifted());
-        polys.alu_p_sub_a_lo_shift = Polynomial(polys.alu_p_sub_a_lo.shifted());
-        polys.alu_p_sub_b_hi_shift = Polynomial(polys.alu_p_sub_b_hi.shifted());
-        polys.alu_p_sub_b_lo_shift = Polynomial(polys.alu_p_sub_b_lo.shifted());
-        polys.alu_rng_chk_lookup_selector_shift = Polynomial(polys.alu_rng_chk_lookup_selector.shifted());
-        polys.alu_rng_chk_sel_shift = Polynomial(polys.alu_rng_chk_sel.shifted());
-        polys.alu_u16_r0_shift = Polynomial(polys.alu_u16_r0.shifted());
-        polys.alu_u16_r1_shift = Polynomial(polys.alu_u16_r1.shifted());
-        polys.alu_u16_r2_shift = Polynomial(polys.alu_u16_r2.shifted());
-        polys.alu_u16_r3_shift = Polynomial(polys.alu_u16_r3.shifted());
-        polys.alu_u16_r4_shift = Polynomial(polys.alu_u16_r4.shifted());
-        polys.alu_u16_r5_shift = Polynomial(polys.alu_u16_r5.shifted());
-        polys.alu_u16_r6_shift = Polynomial(polys.alu_u16_r6.shifted());
-        polys.alu_u8_r0_shift = Polynomial(polys.alu_u8_r0.shifted());
-        polys.alu_u8_r1_shift = Polynomial(polys.alu_u8_r1.shifted());
-        polys.binary_acc_ia_shift = Polynomial(polys.binary_acc_ia.shifted());
-        polys.binary_acc_ib_shift = Polynomial(polys.binary_acc_ib.shifted());
-        polys.binary_acc_ic_shift = Polynomial(polys.binary_acc_ic.shifted());
-        polys.binary_mem_tag_ctr_shift = Polynomial(polys.binary_mem_tag_ctr.shifted());
-        polys.binary_op_id_shift = Polynomial(polys.binary_op_id.shifted());
-        polys.kernel_emit_l2_to_l1_msg_write_offset_shift =
-            Polynomial(polys.kernel_emit_l2_to_l1_msg_write_offset.shifted());
-        polys.kernel_emit_note_hash_write_offset_shift = Polynomial(polys.kernel_emit_note_hash_write_offset.shifted());
-        polys.kernel_emit_nullifier_write_offset_shift = Polynomial(polys.kernel_emit_nullifier_write_offset.shifted());
-        polys.kernel_emit_unencrypted_log_write_offset_shift =
-            Polynomial(polys.kernel_emit_unencrypted_log_write_offset.shifted());
-        polys.kernel_l1_to_l2_msg_exists_write_offset_shift =
-            Polynomial(polys.kernel_l1_to_l2_msg_exists_write_offset.shifted());
-        polys.kernel_note_hash_exist_write_offset_shift =
-            Polynomial(polys.kernel_note_hash_exist_write_offset.shifted());
-        polys.kernel_nullifier_exists_write_offset_shift =
-            Polynomial(polys.kernel_nullifier_exists_write_offset.shifted());
-        polys.kernel_nullifier_non_exists_write_offset_shift =
-            Polynomial(polys.kernel_nullifier_non_exists_write_offset.shifted());
-        polys.kernel_side_effect_counter_shift = Polynomial(polys.kernel_side_effect_counter.shifted());
-        polys.kernel_sload_write_offset_shift = Polynomial(polys.kernel_sload_write_offset.shifted());
-        polys.kernel_sstore_write_offset_shift = Polynomial(polys.kernel_sstore_write_offset.shifted());
-        polys.main_da_gas_remaining_shift = Polynomial(polys.main_da_gas_remaining.shifted());
-        polys.main_internal_return_ptr_shift = Polynomial(polys.main_internal_return_ptr.shifted());
-        polys.main_l2_gas_remaining_shift = Polynomial(polys.main_l2_gas_remaining.shifted());
-        polys.main_pc_shift = Polynomial(polys.main_pc.shifted());
-        polys.mem_glob_addr_shift = Polynomial(polys.mem_glob_addr.shifted());
-        polys.mem_mem_sel_shift = Polynomial(polys.mem_mem_sel.shifted());
-        polys.mem_rw_shift = Polynomial(polys.mem_rw.shifted());
-        polys.mem_tag_shift = Polynomial(polys.mem_tag.shifted());
-        polys.mem_tsp_shift = Polynomial(polys.mem_tsp.shifted());
-        polys.mem_val_shift = Polynomial(polys.mem_val.shifted());
+        polys.alu_a_hi_shift = polys.alu_a_hi.shifted();
+        polys.alu_a_lo_shift = polys.alu_a_lo.shifted();
+        polys.alu_alu_sel_shift = polys.alu_alu_sel.shifted();
+        polys.alu_b_hi_shift = polys.alu_b_hi.shifted();
+        polys.alu_b_lo_shift = polys.alu_b_lo.shifted();
+        polys.alu_cmp_rng_ctr_shift = polys.alu_cmp_rng_ctr.shifted();
+        polys.alu_cmp_sel_shift = polys.alu_cmp_sel.shifted();
+        polys.alu_div_rng_chk_selector_shift = polys.alu_div_rng_chk_selector.shifted();
+        polys.alu_div_u16_r0_shift = polys.alu_div_u16_r0.shifted();
+        polys.alu_div_u16_r1_shift = polys.alu_div_u16_r1.shifted();
+        polys.alu_div_u16_r2_shift = polys.alu_div_u16_r2.shifted();
+        polys.alu_div_u16_r3_shift = polys.alu_div_u16_r3.shifted();
+        polys.alu_div_u16_r4_shift = polys.alu_div_u16_r4.shifted();
+        polys.alu_div_u16_r5_shift = polys.alu_div_u16_r5.shifted();
+        polys.alu_div_u16_r6_shift = polys.alu_div_u16_r6.shifted();
+        polys.alu_div_u16_r7_shift = polys.alu_div_u16_r7.shifted();
+        polys.alu_op_add_shift = polys.alu_op_add.shifted();
+        polys.alu_op_cast_prev_shift = polys.alu_op_cast_prev.shifted();
+        polys.alu_op_cast_shift = polys.alu_op_cast.shifted();
+        polys.alu_op_div_shift = polys.alu_op_div.shifted();
+        polys.alu_op_mul_shift = polys.alu_op_mul.shifted();
+        polys.alu_op_shl_shift = polys.alu_op_shl.shifted();
+        polys.alu_op_shr_shift = polys.alu_op_shr.shifted();
+        polys.alu_op_sub_shift = polys.alu_op_sub.shifted();
+        polys.alu_p_sub_a_hi_shift = polys.alu_p_sub_a_hi.shifted();
+        polys.alu_p_sub_a_lo_shift = polys.alu_p_sub_a_lo.shifted();
+        polys.alu_p_sub_b_hi_shift = polys.alu_p_sub_b_hi.shifted();
+        polys.alu_p_sub_b_lo_shift = polys.alu_p_sub_b_lo.shifted();
+        polys.alu_rng_chk_lookup_selector_shift = polys.alu_rng_chk_lookup_selector.shifted();
+        polys.alu_rng_chk_sel_shift = polys.alu_rng_chk_sel.shifted();
+        polys.alu_u16_r0_shift = polys.alu_u16_r0.shifted();
+        polys.alu_u16_r1_shift = polys.alu_u16_r1.shifted();
+        polys.alu_u16_r2_shift = polys.alu_u16_r2.shifted();
+        polys.alu_u16_r3_shift = polys.alu_u16_r3.shifted();
+        polys.alu_u16_r4_shift = polys.alu_u16_r4.shifted();
+        polys.alu_u16_r5_shift = polys.alu_u16_r5.shifted();
+        polys.alu_u16_r6_shift = polys.alu_u16_r6.shifted();
+        polys.alu_u8_r0_shift = polys.alu_u8_r0.shifted();
+        polys.alu_u8_r1_shift = polys.alu_u8_r1.shifted();
+        polys.binary_acc_ia_shift = polys.binary_acc_ia.shifted();
+        polys.binary_acc_ib_shift = polys.binary_acc_ib.shifted();
+        polys.binary_acc_ic_shift = polys.binary_acc_ic.shifted();
+        polys.binary_mem_tag_ctr_shift = polys.binary_mem_tag_ctr.shifted();
+        polys.binary_op_id_shift = polys.binary_op_id.shifted();
+        polys.kernel_emit_l2_to_l1_msg_write_offset_shift = polys.kernel_emit_l2_to_l1_msg_write_offset.shifted();
+        polys.kernel_emit_note_hash_write_offset_shift = polys.kernel_emit_note_hash_write_offset.shifted();
+        polys.kernel_emit_nullifier_write_offset_shift = polys.kernel_emit_nullifier_write_offset.shifted();
+        polys.kernel_emit_unencrypted_log_write_offset_shift = polys.kernel_emit_unencrypted_log_write_offset.shifted();
+        polys.kernel_l1_to_l2_msg_exists_write_offset_shift = polys.kernel_l1_to_l2_msg_exists_write_offset.shifted();
+        polys.kernel_note_hash_exist_write_offset_shift = polys.kernel_note_hash_exist_write_offset.shifted();
+        polys.kernel_nullifier_exists_write_offset_shift = polys.kernel_nullifier_exists_write_offset.shifted();
+        polys.kernel_nullifier_non_exists_write_offset_shift = polys.kernel_nullifier_non_exists_write_offset.shifted();
+        polys.kernel_side_effect_counter_shift = polys.kernel_side_effect_counter.shifted();
+        polys.kernel_sload_write_offset_shift = polys.kernel_sload_write_offset.shifted();
+        polys.kernel_sstore_write_offset_shift = polys.kernel_sstore_write_offset.shifted();
+        polys.main_da_gas_remaining_shift = polys.main_da_gas_remaining.shifted();
+        polys.main_internal_return_ptr_shift = polys.main_internal_return_ptr.shifted();
+        polys.main_l2_gas_remaining_shift = polys.main_l2_gas_remaining.shifted();
+        polys.main_pc_shift = polys.main_pc.shifted();
+        polys.mem_glob_addr_shift = polys.mem_glob_addr.shifted();
+        polys.mem_mem_sel_shift = polys.mem_mem_sel.shifted();
+        polys.mem_rw_shift = polys.mem_rw.shifted();
+        polys.mem_tag_shift = polys.mem_tag.shifted();
+        polys.mem_tsp_shift = polys.mem_tsp.shifted();
+        polys.mem_val_shift = polys.mem_val.shifted();
 
         return polys;
     }
@@ -996,602 +1009,79 @@ class AvmCircuitBuilder {
         auto polys = compute_polynomials();
         const size_t num_rows = polys.get_polynomial_size();
 
-        const auto evaluate_relation = [&]<typename Relation>(const std::string& relation_name,
-                                                              std::string (*debug_label)(int)) {
-            typename Relation::SumcheckArrayOfValuesOverSubrelations result;
-            for (auto& r : result) {
-                r = 0;
-            }
-            constexpr size_t NUM_SUBRELATIONS = result.size();
-
-            for (size_t i = 0; i < num_rows; ++i) {
-                Relation::accumulate(result, polys.get_row(i), {}, 1);
-
-                bool x = true;
-                for (size_t j = 0; j < NUM_SUBRELATIONS; ++j) {
-                    if (result[j] != 0) {
-                        std::string row_name = debug_label(static_cast<int>(j));
-                        throw_or_abort(
-                            format("Relation ", relation_name, ", subrelation index ", row_name, " failed at row ", i));
-                        x = false;
-                    }
-                }
-                if (!x) {
-                    return false;
-                }
-            }
-            return true;
-        };
-
-        const auto evaluate_logderivative = [&]<typename LogDerivativeSettings>(const std::string& lookup_name) {
-            // Check the logderivative relation
-            bb::compute_logderivative_inverse<Flavor, LogDerivativeSettings>(polys, params, num_rows);
-
-            typename LogDerivativeSettings::SumcheckArrayOfValuesOverSubrelations lookup_result;
-
-            for (auto& r : lookup_result) {
-                r = 0;
-            }
-            for (size_t i = 0; i < num_rows; ++i) {
-                LogDerivativeSettings::accumulate(lookup_result, polys.get_row(i), params, 1);
-            }
-            for (auto r : lookup_result) {
-                if (r != 0) {
-                    throw_or_abort(format("Lookup ", lookup_name, " failed."));
-                    return false;
-                }
-            }
-            return true;
-        };
-
-        auto alu = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::alu<FF>>("alu", Avm_vm::get_relation_label_alu);
-        };
-
-        auto binary = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::binary<FF>>("binary",
-                                                                             Avm_vm::get_relation_label_binary);
-        };
-
-        auto conversion = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::conversion<FF>>("conversion",
-                                                                                 Avm_vm::get_relation_label_conversion);
-        };
-
-        auto keccakf1600 = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::keccakf1600<FF>>(
-                "keccakf1600", Avm_vm::get_relation_label_keccakf1600);
-        };
-
-        auto kernel = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::kernel<FF>>("kernel",
-                                                                             Avm_vm::get_relation_label_kernel);
-        };
-
-        auto main = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::main<FF>>("main", Avm_vm::get_relation_label_main);
-        };
-
-        auto mem = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::mem<FF>>("mem", Avm_vm::get_relation_label_mem);
-        };
-
-        auto pedersen = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::pedersen<FF>>("pedersen",
-                                                                               Avm_vm::get_relation_label_pedersen);
-        };
-
-        auto poseidon2 = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::poseidon2<FF>>("poseidon2",
-                                                                                Avm_vm::get_relation_label_poseidon2);
-        };
-
-        auto sha256 = [=]() {
-            return evaluate_relation.template operator()<Avm_vm::sha256<FF>>("sha256",
-                                                                             Avm_vm::get_relation_label_sha256);
-        };
-
-        auto perm_main_alu = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_alu_relation<FF>>("PERM_MAIN_ALU");
-        };
-
-        auto perm_main_bin = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_bin_relation<FF>>("PERM_MAIN_BIN");
-        };
-
-        auto perm_main_conv = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_conv_relation<FF>>("PERM_MAIN_CONV");
-        };
-
-        auto perm_main_pos2_perm = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_pos2_perm_relation<FF>>("PERM_MAIN_POS2_PERM");
-        };
-
-        auto perm_main_pedersen = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_pedersen_relation<FF>>("PERM_MAIN_PEDERSEN");
-        };
-
-        auto perm_main_mem_a = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_a_relation<FF>>("PERM_MAIN_MEM_A");
-        };
-
-        auto perm_main_mem_b = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_b_relation<FF>>("PERM_MAIN_MEM_B");
-        };
-
-        auto perm_main_mem_c = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_c_relation<FF>>("PERM_MAIN_MEM_C");
-        };
-
-        auto perm_main_mem_d = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_d_relation<FF>>("PERM_MAIN_MEM_D");
-        };
-
-        auto perm_main_mem_ind_a = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_ind_a_relation<FF>>("PERM_MAIN_MEM_IND_A");
-        };
-
-        auto perm_main_mem_ind_b = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_ind_b_relation<FF>>("PERM_MAIN_MEM_IND_B");
-        };
-
-        auto perm_main_mem_ind_c = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_ind_c_relation<FF>>("PERM_MAIN_MEM_IND_C");
-        };
-
-        auto perm_main_mem_ind_d = [=]() {
-            return evaluate_logderivative.template operator()<perm_main_mem_ind_d_relation<FF>>("PERM_MAIN_MEM_IND_D");
-        };
-
-        auto lookup_byte_lengths = [=]() {
-            return evaluate_logderivative.template operator()<lookup_byte_lengths_relation<FF>>("LOOKUP_BYTE_LENGTHS");
-        };
-
-        auto lookup_byte_operations = [=]() {
-            return evaluate_logderivative.template operator()<lookup_byte_operations_relation<FF>>(
-                "LOOKUP_BYTE_OPERATIONS");
-        };
-
-        auto lookup_opcode_gas = [=]() {
-            return evaluate_logderivative.template operator()<lookup_opcode_gas_relation<FF>>("LOOKUP_OPCODE_GAS");
-        };
-
-        auto range_check_l2_gas_hi = [=]() {
-            return evaluate_logderivative.template operator()<range_check_l2_gas_hi_relation<FF>>(
-                "RANGE_CHECK_L2_GAS_HI");
-        };
-
-        auto range_check_l2_gas_lo = [=]() {
-            return evaluate_logderivative.template operator()<range_check_l2_gas_lo_relation<FF>>(
-                "RANGE_CHECK_L2_GAS_LO");
-        };
-
-        auto range_check_da_gas_hi = [=]() {
-            return evaluate_logderivative.template operator()<range_check_da_gas_hi_relation<FF>>(
-                "RANGE_CHECK_DA_GAS_HI");
-        };
-
-        auto range_check_da_gas_lo = [=]() {
-            return evaluate_logderivative.template operator()<range_check_da_gas_lo_relation<FF>>(
-                "RANGE_CHECK_DA_GAS_LO");
-        };
-
-        auto kernel_output_lookup = [=]() {
-            return evaluate_logderivative.template operator()<kernel_output_lookup_relation<FF>>(
-                "KERNEL_OUTPUT_LOOKUP");
-        };
-
-        auto lookup_into_kernel = [=]() {
-            return evaluate_logderivative.template operator()<lookup_into_kernel_relation<FF>>("LOOKUP_INTO_KERNEL");
-        };
-
-        auto incl_main_tag_err = [=]() {
-            return evaluate_logderivative.template operator()<incl_main_tag_err_relation<FF>>("INCL_MAIN_TAG_ERR");
-        };
-
-        auto incl_mem_tag_err = [=]() {
-            return evaluate_logderivative.template operator()<incl_mem_tag_err_relation<FF>>("INCL_MEM_TAG_ERR");
-        };
-
-        auto lookup_mem_rng_chk_lo = [=]() {
-            return evaluate_logderivative.template operator()<lookup_mem_rng_chk_lo_relation<FF>>(
-                "LOOKUP_MEM_RNG_CHK_LO");
-        };
-
-        auto lookup_mem_rng_chk_mid = [=]() {
-            return evaluate_logderivative.template operator()<lookup_mem_rng_chk_mid_relation<FF>>(
-                "LOOKUP_MEM_RNG_CHK_MID");
-        };
-
-        auto lookup_mem_rng_chk_hi = [=]() {
-            return evaluate_logderivative.template operator()<lookup_mem_rng_chk_hi_relation<FF>>(
-                "LOOKUP_MEM_RNG_CHK_HI");
-        };
-
-        auto lookup_pow_2_0 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_pow_2_0_relation<FF>>("LOOKUP_POW_2_0");
-        };
-
-        auto lookup_pow_2_1 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_pow_2_1_relation<FF>>("LOOKUP_POW_2_1");
-        };
-
-        auto lookup_u8_0 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u8_0_relation<FF>>("LOOKUP_U8_0");
-        };
-
-        auto lookup_u8_1 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u8_1_relation<FF>>("LOOKUP_U8_1");
-        };
-
-        auto lookup_u16_0 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_0_relation<FF>>("LOOKUP_U16_0");
-        };
-
-        auto lookup_u16_1 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_1_relation<FF>>("LOOKUP_U16_1");
-        };
-
-        auto lookup_u16_2 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_2_relation<FF>>("LOOKUP_U16_2");
-        };
-
-        auto lookup_u16_3 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_3_relation<FF>>("LOOKUP_U16_3");
-        };
-
-        auto lookup_u16_4 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_4_relation<FF>>("LOOKUP_U16_4");
-        };
-
-        auto lookup_u16_5 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_5_relation<FF>>("LOOKUP_U16_5");
-        };
-
-        auto lookup_u16_6 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_6_relation<FF>>("LOOKUP_U16_6");
-        };
-
-        auto lookup_u16_7 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_7_relation<FF>>("LOOKUP_U16_7");
-        };
-
-        auto lookup_u16_8 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_8_relation<FF>>("LOOKUP_U16_8");
-        };
-
-        auto lookup_u16_9 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_9_relation<FF>>("LOOKUP_U16_9");
-        };
-
-        auto lookup_u16_10 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_10_relation<FF>>("LOOKUP_U16_10");
-        };
-
-        auto lookup_u16_11 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_11_relation<FF>>("LOOKUP_U16_11");
-        };
-
-        auto lookup_u16_12 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_12_relation<FF>>("LOOKUP_U16_12");
-        };
-
-        auto lookup_u16_13 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_13_relation<FF>>("LOOKUP_U16_13");
-        };
-
-        auto lookup_u16_14 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_u16_14_relation<FF>>("LOOKUP_U16_14");
-        };
-
-        auto lookup_div_u16_0 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_0_relation<FF>>("LOOKUP_DIV_U16_0");
-        };
-
-        auto lookup_div_u16_1 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_1_relation<FF>>("LOOKUP_DIV_U16_1");
-        };
-
-        auto lookup_div_u16_2 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_2_relation<FF>>("LOOKUP_DIV_U16_2");
-        };
-
-        auto lookup_div_u16_3 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_3_relation<FF>>("LOOKUP_DIV_U16_3");
-        };
-
-        auto lookup_div_u16_4 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_4_relation<FF>>("LOOKUP_DIV_U16_4");
-        };
-
-        auto lookup_div_u16_5 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_5_relation<FF>>("LOOKUP_DIV_U16_5");
-        };
-
-        auto lookup_div_u16_6 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_6_relation<FF>>("LOOKUP_DIV_U16_6");
-        };
-
-        auto lookup_div_u16_7 = [=]() {
-            return evaluate_logderivative.template operator()<lookup_div_u16_7_relation<FF>>("LOOKUP_DIV_U16_7");
-        };
-
-#ifndef __wasm__
-
-        // Evaluate check circuit closures as futures
-        std::vector<std::future<bool>> relation_futures;
-
-        relation_futures.emplace_back(std::async(std::launch::async, alu));
-
-        relation_futures.emplace_back(std::async(std::launch::async, binary));
-
-        relation_futures.emplace_back(std::async(std::launch::async, conversion));
-
-        relation_futures.emplace_back(std::async(std::launch::async, keccakf1600));
-
-        relation_futures.emplace_back(std::async(std::launch::async, kernel));
-
-        relation_futures.emplace_back(std::async(std::launch::async, main));
-
-        relation_futures.emplace_back(std::async(std::launch::async, mem));
-
-        relation_futures.emplace_back(std::async(std::launch::async, pedersen));
-
-        relation_futures.emplace_back(std::async(std::launch::async, poseidon2));
-
-        relation_futures.emplace_back(std::async(std::launch::async, sha256));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_alu));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_bin));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_conv));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_pos2_perm));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_pedersen));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_a));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_b));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_c));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_d));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_ind_a));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_ind_b));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_ind_c));
-
-        relation_futures.emplace_back(std::async(std::launch::async, perm_main_mem_ind_d));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_byte_lengths));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_byte_operations));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_opcode_gas));
-
-        relation_futures.emplace_back(std::async(std::launch::async, range_check_l2_gas_hi));
-
-        relation_futures.emplace_back(std::async(std::launch::async, range_check_l2_gas_lo));
-
-        relation_futures.emplace_back(std::async(std::launch::async, range_check_da_gas_hi));
-
-        relation_futures.emplace_back(std::async(std::launch::async, range_check_da_gas_lo));
-
-        relation_futures.emplace_back(std::async(std::launch::async, kernel_output_lookup));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_into_kernel));
-
-        relation_futures.emplace_back(std::async(std::launch::async, incl_main_tag_err));
-
-        relation_futures.emplace_back(std::async(std::launch::async, incl_mem_tag_err));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_mem_rng_chk_lo));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_mem_rng_chk_mid));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_mem_rng_chk_hi));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_pow_2_0));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_pow_2_1));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u8_0));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u8_1));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_0));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_1));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_2));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_3));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_4));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_5));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_6));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_7));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_8));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_9));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_10));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_11));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_12));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_13));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_u16_14));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_0));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_1));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_2));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_3));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_4));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_5));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_6));
-
-        relation_futures.emplace_back(std::async(std::launch::async, lookup_div_u16_7));
-
-        // Wait for lookup evaluations to complete
-        for (auto& future : relation_futures) {
-            int result = future.get();
-            if (!result) {
-                return false;
-            }
-        }
-#else
-
-        alu();
-
-        binary();
-
-        conversion();
-
-        keccakf1600();
-
-        kernel();
-
-        main();
-
-        mem();
-
-        pedersen();
-
-        poseidon2();
-
-        sha256();
-
-        perm_main_alu();
-
-        perm_main_bin();
-
-        perm_main_conv();
-
-        perm_main_pos2_perm();
-
-        perm_main_pedersen();
-
-        perm_main_mem_a();
-
-        perm_main_mem_b();
-
-        perm_main_mem_c();
-
-        perm_main_mem_d();
-
-        perm_main_mem_ind_a();
-
-        perm_main_mem_ind_b();
-
-        perm_main_mem_ind_c();
-
-        perm_main_mem_ind_d();
-
-        lookup_byte_lengths();
-
-        lookup_byte_operations();
-
-        lookup_opcode_gas();
-
-        range_check_l2_gas_hi();
-
-        range_check_l2_gas_lo();
-
-        range_check_da_gas_hi();
-
-        range_check_da_gas_lo();
-
-        kernel_output_lookup();
-
-        lookup_into_kernel();
-
-        incl_main_tag_err();
-
-        incl_mem_tag_err();
-
-        lookup_mem_rng_chk_lo();
-
-        lookup_mem_rng_chk_mid();
-
-        lookup_mem_rng_chk_hi();
-
-        lookup_pow_2_0();
-
-        lookup_pow_2_1();
-
-        lookup_u8_0();
-
-        lookup_u8_1();
-
-        lookup_u16_0();
-
-        lookup_u16_1();
-
-        lookup_u16_2();
-
-        lookup_u16_3();
-
-        lookup_u16_4();
-
-        lookup_u16_5();
-
-        lookup_u16_6();
-
-        lookup_u16_7();
-
-        lookup_u16_8();
-
-        lookup_u16_9();
-
-        lookup_u16_10();
-
-        lookup_u16_11();
-
-        lookup_u16_12();
-
-        lookup_u16_13();
-
-        lookup_u16_14();
-
-        lookup_div_u16_0();
-
-        lookup_div_u16_1();
-
-        lookup_div_u16_2();
-
-        lookup_div_u16_3();
-
-        lookup_div_u16_4();
-
-        lookup_div_u16_5();
-
-        lookup_div_u16_6();
-
-        lookup_div_u16_7();
-
-#endif
-
-        return true;
+        // The relations and lookups are checked concurrently, each in parallel over the rows. The lookups compute their
+        // inverse polynomials in the trace columns, which the prover recomputes on the same rows.
+        RelationChecker<Flavor> checker(polys, num_rows);
+
+        checker.add_relation<Avm_vm::alu<FF>>("alu", Avm_vm::get_relation_label_alu);
+        checker.add_relation<Avm_vm::binary<FF>>("binary", Avm_vm::get_relation_label_binary);
+        checker.add_relation<Avm_vm::conversion<FF>>("conversion", Avm_vm::get_relation_label_conversion);
+        checker.add_relation<Avm_vm::keccakf1600<FF>>("keccakf1600", Avm_vm::get_relation_label_keccakf1600);
+        checker.add_relation<Avm_vm::kernel<FF>>("kernel", Avm_vm::get_relation_label_kernel);
+        checker.add_relation<Avm_vm::main<FF>>("main", Avm_vm::get_relation_label_main);
+        checker.add_relation<Avm_vm::mem<FF>>("mem", Avm_vm::get_relation_label_mem);
+        checker.add_relation<Avm_vm::pedersen<FF>>("pedersen", Avm_vm::get_relation_label_pedersen);
+        checker.add_relation<Avm_vm::poseidon2<FF>>("poseidon2", Avm_vm::get_relation_label_poseidon2);
+        checker.add_relation<Avm_vm::sha256<FF>>("sha256", Avm_vm::get_relation_label_sha256);
+        checker.add_logderivative<perm_main_alu_relation<FF>>("PERM_MAIN_ALU", params);
+        checker.add_logderivative<perm_main_bin_relation<FF>>("PERM_MAIN_BIN", params);
+        checker.add_logderivative<perm_main_conv_relation<FF>>("PERM_MAIN_CONV", params);
+        checker.add_logderivative<perm_main_pos2_perm_relation<FF>>("PERM_MAIN_POS2_PERM", params);
+        checker.add_logderivative<perm_main_pedersen_relation<FF>>("PERM_MAIN_PEDERSEN", params);
+        checker.add_logderivative<perm_main_mem_a_relation<FF>>("PERM_MAIN_MEM_A", params);
+        checker.add_logderivative<perm_main_mem_b_relation<FF>>("PERM_MAIN_MEM_B", params);
+        checker.add_logderivative<perm_main_mem_c_relation<FF>>("PERM_MAIN_MEM_C", params);
+        checker.add_logderivative<perm_main_mem_d_relation<FF>>("PERM_MAIN_MEM_D", params);
+        checker.add_logderivative<perm_main_mem_ind_a_relation<FF>>("PERM_MAIN_MEM_IND_A", params);
+        checker.add_logderivative<perm_main_mem_ind_b_relation<FF>>("PERM_MAIN_MEM_IND_B", params);
+        checker.add_logderivative<perm_main_mem_ind_c_relation<FF>>("PERM_MAIN_MEM_IND_C", params);
+        checker.add_logderivative<perm_main_mem_ind_d_relation<FF>>("PERM_MAIN_MEM_IND_D", params);
+        checker.add_logderivative<lookup_byte_lengths_relation<FF>>("LOOKUP_BYTE_LENGTHS", params);
+        checker.add_logderivative<lookup_byte_operations_relation<FF>>("LOOKUP_BYTE_OPERATIONS", params);
+        checker.add_logderivative<lookup_opcode_gas_relation<FF>>("LOOKUP_OPCODE_GAS", params);
+        checker.add_logderivative<range_check_l2_gas_hi_relation<FF>>("RANGE_CHECK_L2_GAS_HI", params);
+        checker.add_logderivative<range_check_l2_gas_lo_relation<FF>>("RANGE_CHECK_L2_GAS_LO", params);
+        checker.add_logderivative<range_check_da_gas_hi_relation<FF>>("RANGE_CHECK_DA_GAS_HI", params);
+        checker.add_logderivative<range_check_da_gas_lo_relation<FF>>("RANGE_CHECK_DA_GAS_LO", params);
+        checker.add_logderivative<kernel_output_lookup_relation<FF>>("KERNEL_OUTPUT_LOOKUP", params);
+        checker.add_logderivative<lookup_into_kernel_relation<FF>>("LOOKUP_INTO_KERNEL", params);
+        checker.add_logderivative<incl_main_tag_err_relation<FF>>("INCL_MAIN_TAG_ERR", params);
+        checker.add_logderivative<incl_mem_tag_err_relation<FF>>("INCL_MEM_TAG_ERR", params);
+        checker.add_logderivative<lookup_mem_rng_chk_lo_relation<FF>>("LOOKUP_MEM_RNG_CHK_LO", params);
+        checker.add_logderivative<lookup_mem_rng_chk_mid_relation<FF>>("LOOKUP_MEM_RNG_CHK_MID", params);
+        checker.add_logderivative<lookup_mem_rng_chk_hi_relation<FF>>("LOOKUP_MEM_RNG_CHK_HI", params);
+        checker.add_logderivative<lookup_pow_2_0_relation<FF>>("LOOKUP_POW_2_0", params);
+        checker.add_logderivative<lookup_pow_2_1_relation<FF>>("LOOKUP_POW_2_1", params);
+        checker.add_logderivative<lookup_u8_0_relation<FF>>("LOOKUP_U8_0", params);
+        checker.add_logderivative<lookup_u8_1_relation<FF>>("LOOKUP_U8_1", params);
+        checker.add_logderivative<lookup_u16_0_relation<FF>>("LOOKUP_U16_0", params);
+        checker.add_logderivative<lookup_u16_1_relation<FF>>("LOOKUP_U16_1", params);
+        checker.add_logderivative<lookup_u16_2_relation<FF>>("LOOKUP_U16_2", params);
+        checker.add_logderivative<lookup_u16_3_relation<FF>>("LOOKUP_U16_3", params);
+        checker.add_logderivative<lookup_u16_4_relation<FF>>("LOOKUP_U16_4", params);
+        checker.add_logderivative<lookup_u16_5_relation<FF>>("LOOKUP_U16_5", params);
+        checker.add_logderivative<lookup_u16_6_relation<FF>>("LOOKUP_U16_6", params);
+        checker.add_logderivative<lookup_u16_7_relation<FF>>("LOOKUP_U16_7", params);
+        checker.add_logderivative<lookup_u16_8_relation<FF>>("LOOKUP_U16_8", params);
+        checker.add_logderivative<lookup_u16_9_relation<FF>>("LOOKUP_U16_9", params);
+        checker.add_logderivative<lookup_u16_10_relation<FF>>("LOOKUP_U16_10", params);
+        checker.add_logderivative<lookup_u16_11_relation<FF>>("LOOKUP_U16_11", params);
+        checker.add_logderivative<lookup_u16_12_relation<FF>>("LOOKUP_U16_12", params);
+        checker.add_logderivative<lookup_u16_13_relation<FF>>("LOOKUP_U16_13", params);
+        checker.add_logderivative<lookup_u16_14_relation<FF>>("LOOKUP_U16_14", params);
+        checker.add_logderivative<lookup_div_u16_0_relation<FF>>("LOOKUP_DIV_U16_0", params);
+        checker.add_logderivative<lookup_div_u16_1_relation<FF>>("LOOKUP_DIV_U16_1", params);
+        checker.add_logderivative<lookup_div_u16_2_relation<FF>>("LOOKUP_DIV_U16_2", params);
+        checker.add_logderivative<lookup_div_u16_3_relation<FF>>("LOOKUP_DIV_U16_3", params);
+        checker.add_logderivative<lookup_div_u16_4_relation<FF>>("LOOKUP_DIV_U16_4", params);
+        checker.add_logderivative<lookup_div_u16_5_relation<FF>>("LOOKUP_DIV_U16_5", params);
+        checker.add_logderivative<lookup_div_u16_6_relation<FF>>("LOOKUP_DIV_U16_6", params);
+        checker.add_logderivative<lookup_div_u16_7_relation<FF>>("LOOKUP_DIV_U16_7", params);
+
+        return checker.check();
     }
 
-    [[nodiscard]] size_t get_num_gates() const { return rows.size(); }
+    [[nodiscard]] size_t get_num_gates() const { return num_gates; }
 
     [[nodiscard]] size_t get_circuit_subgroup_size() const
     {
@@ -1600,5 +1090,10 @@ class AvmCircuitBuilder {
         size_t num_rows_pow2 = 1UL << (num_rows_log2 + (1UL << num_rows_log2 == num_rows ? 0 : 1));
         return num_rows_pow2;
     }
+
+  private:
+    // The trace, by column. Only the unshifted polynomials are used.
+    ProverPolynomials columns;
+    size_t num_gates = 0;
 };
 } // namespace bb
@@ -15,11 +15,12 @@ void AvmComposer::compute_witness(CircuitConstructor& circuit)
         return;
     }
 
+    // The polynomials share the memory of the trace columns held by the circuit builder, and so do the key's
     auto polynomials = circuit.compute_polynomials();
 
     for (auto [key_poly, prover_poly] : zip_view(proving_key->get_all(), polynomials.get_unshifted())) {
         ASSERT(flavor_get_label(*proving_key, key_poly) == flavor_get_label(polynomials, prover_poly));
-        key_poly = prover_poly;
+        key_poly = prover_poly.share();
     }
 
     computed_witness = true;
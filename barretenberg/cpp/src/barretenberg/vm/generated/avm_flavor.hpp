@@ -11,6 +11,7 @@
 
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/flavor/flavor_macros.hpp"
+#include "barretenberg/flavor/row_view.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/relations/generated/avm/alu.hpp"
@@ -2661,6 +2662,11 @@ class AvmFlavor {
         using Base::Base;
     };
 
+    /**
+     * @brief A row of the prover polynomials, read in place rather than copied as by ProverPolynomials::get_row.
+     */
+    using RowView = bb::RowView<FF, AllEntities>;
+
     /**
      * @brief A container for the prover polynomials handles.
      */